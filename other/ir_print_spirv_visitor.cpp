@@ -24,6 +24,7 @@
 #include "ir_print_spirv_visitor.h"
 #include "compiler/glsl_types.h"
 #include "glsl_parser_extras.h"
+#include "ir_variable_refcount.h"
 #include "main/macros.h"
 #include "util/hash_table.h"
 #include "util/u_string.h"
@@ -281,17 +282,39 @@ spirv_buffer::spirv_buffer()
    memset((char*)this + offsetof(spirv_buffer, memory_begin), 0, offsetof(spirv_buffer, memory_end) - offsetof(spirv_buffer, memory_begin));
 }
 
+spirv_buffer::~spirv_buffer()
+{
+   ralloc_free(uniform_layout);
+}
+
 extern "C" {
 void
 _mesa_print_spirv(spirv_buffer *f, exec_list *instructions, struct _mesa_glsl_parse_state* state, unsigned binding)
 {
-   gl_shader_stage stage = state->stage;
-   unsigned version = state->language_version;
-   bool es = state->es_shader;
+   _mesa_print_spirv_stage(f, instructions, state->stage, state->language_version, state->es_shader, false, binding);
+}
+
+unsigned
+_mesa_spirv_first_free_binding(exec_list *instructions, unsigned binding)
+{
+   foreach_in_list(ir_instruction, node, instructions) {
+      ir_variable *var = node->as_variable();
+      if (var == NULL || var->data.mode != ir_var_uniform || !var->data.explicit_binding)
+         continue;
+      if (var->type->is_image() || var->type->is_sampler())
+         binding = MAX2(binding, (unsigned) var->data.binding + 1);
+   }
 
+   return binding;
+}
+
+void
+_mesa_print_spirv_stage(spirv_buffer *f, exec_list *instructions, gl_shader_stage stage, unsigned version, bool es, bool linked, unsigned binding)
+{
    f->shader_stage = stage;
+   f->linked = linked;
    f->id = 1;
-   f->binding_id = binding;
+   f->binding_id = _mesa_spirv_first_free_binding(instructions, binding);
 
    // ExtInstImport
    f->ext_inst_import_id = f->id++;
@@ -312,6 +335,8 @@ _mesa_print_spirv(spirv_buffer *f, exec_list *instructions, struct _mesa_glsl_pa
    // spirv visitor
    ir_print_spirv_visitor v(f);
 
+   v.visit_uniform_layout(instructions);
+
    foreach_in_list(ir_instruction, ir, instructions) {
       ir->accept(&v);
    }
@@ -369,6 +394,13 @@ _mesa_print_spirv(spirv_buffer *f, exec_list *instructions, struct _mesa_glsl_pa
       f->opcode(4, SpvOpVariable, f->uniform_pointer_id, f->uniform_id, SpvStorageClassUniform);
    }
 
+   // PushConstant
+   if (f->push_constants.count() != 0) {
+      f->opcode(2, SpvOpTypeStruct, f->push_constant_struct_id, f->push_constants);
+      f->opcode(4, SpvOpTypePointer, f->push_constant_pointer_id, SpvStorageClassPushConstant, f->push_constant_struct_id);
+      f->opcode(4, SpvOpVariable, f->push_constant_pointer_id, f->push_constant_id, SpvStorageClassPushConstant);
+   }
+
    // gl_PerVertex
    if (f->per_vertices.count() != 0) {
       f->opcode(2, SpvOpTypeStruct, f->gl_per_vertex_name_id, f->per_vertices);
@@ -399,6 +431,15 @@ ir_print_spirv_visitor::~ir_print_spirv_visitor()
    ralloc_free(mem_ctx);
 }
 
+unsigned int
+ir_print_spirv_visitor::pointer_mode(ir_variable *var)
+{
+   if (var->data.mode == ir_var_uniform && f->push_constant_id != 0 && var->ir_pointer == f->push_constant_id)
+      return ir_var_const_in;
+
+   return var->data.mode;
+}
+
 unsigned int
 ir_print_spirv_visitor::unique_name(ir_variable *var)
 {
@@ -765,6 +806,37 @@ ir_print_spirv_visitor::visit_value(ir_rvalue *ir)
    }
 }
 
+unsigned int
+ir_print_spirv_visitor::visit_splat(const struct glsl_type *type, unsigned int type_id, unsigned int scalar_id)
+{
+   /* A matrix is made of columns rather than of scalars. */
+   unsigned int id = scalar_id;
+   if (type->is_matrix()) {
+      const struct glsl_type *column_type = type->column_type();
+      unsigned int column_type_id = visit_type(column_type);
+      id = f->id++;
+
+      f->codes.push(SpvOpCompositeConstruct, column_type->vector_elements + 3);
+      f->codes.push(column_type_id);
+      f->codes.push(id);
+      for (unsigned int i = 0; i < column_type->vector_elements; ++i) {
+         f->codes.push(scalar_id);
+      }
+   }
+
+   unsigned int count = type->is_matrix() ? type->matrix_columns : type->vector_elements;
+   unsigned int value_id = f->id++;
+
+   f->codes.push(SpvOpCompositeConstruct, count + 3);
+   f->codes.push(type_id);
+   f->codes.push(value_id);
+   for (unsigned int i = 0; i < count; ++i) {
+      f->codes.push(id);
+   }
+
+   return value_id;
+}
+
 void
 ir_print_spirv_visitor::visit_precision(unsigned int id, unsigned int type, unsigned int precision)
 {
@@ -785,6 +857,204 @@ ir_print_spirv_visitor::visit_precision(unsigned int id, unsigned int type, unsi
    }
 }
 
+/**
+ * Give offsets from \c offset on to the \c count uniforms in \c vars, which
+ * are sorted by alignment, and return the offset past the last of them.
+ *
+ * Where a uniform leaves a gap, such as the tail of a vec3, the first of the
+ * smaller uniforms that fits in it is moved up, so \c vars is reordered to
+ * match the offsets.
+ */
+static unsigned int
+layout_uniforms(ir_variable **vars, unsigned int count, unsigned int offset, unsigned int *offsets)
+{
+   for (unsigned int i = 0; i < count; i++) {
+      for (unsigned int j = i; j < count; j++) {
+         if (offset % vars[j]->type->std430_base_alignment(false) == 0) {
+            ir_variable *var = vars[j];
+            memmove(vars + i + 1, vars + i, (j - i) * sizeof(ir_variable *));
+            vars[i] = var;
+            break;
+         }
+      }
+
+      offset = ALIGN(offset, vars[i]->type->std430_base_alignment(false));
+      if (offsets)
+         offsets[i] = offset;
+      offset += vars[i]->type->std430_size(false);
+   }
+
+   return offset;
+}
+
+/**
+ * Insert \c var into the \c count uniforms in \c vars, after the ones of the
+ * same or a larger alignment.
+ */
+static void
+insert_uniform(ir_variable **vars, unsigned int count, ir_variable *var)
+{
+   unsigned int align = var->type->std430_base_alignment(false);
+   unsigned int i = count;
+   while (i > 0 && vars[i - 1]->type->std430_base_alignment(false) < align) {
+      vars[i] = vars[i - 1];
+      i--;
+   }
+   vars[i] = var;
+}
+
+void
+ir_print_spirv_visitor::visit_uniform_layout(exec_list *instructions)
+{
+   ir_variable_refcount_visitor refs;
+   refs.run(instructions);
+
+   unsigned int length = instructions->length();
+   ir_variable **vars = ralloc_array(mem_ctx, ir_variable *, length);
+   unsigned int count = 0;
+
+   foreach_in_list(ir_instruction, node, instructions) {
+      ir_variable *var = node->as_variable();
+      if (var == NULL || var->data.mode != ir_var_uniform || is_gl_identifier(var->name))
+         continue;
+      if (var->type->is_image() || var->type->is_sampler() || var->type->is_subroutine())
+         continue;
+      if (refs.get_variable_entry(var)->referenced_count == 0)
+         continue;
+
+      insert_uniform(vars, count++, var);
+   }
+
+   /* Move the uniforms that are read most often, and the smallest of those
+    * that are read as often, into the push constants while they fit.
+    */
+   ir_variable **push_vars = ralloc_array(mem_ctx, ir_variable *, length);
+   unsigned int push_count = 0;
+
+   if (f->push_constant_budget && count) {
+      ir_variable **ranked = ralloc_array(mem_ctx, ir_variable *, count);
+      ir_variable **scratch = ralloc_array(mem_ctx, ir_variable *, count);
+
+      for (unsigned int i = 0; i < count; i++) {
+         ir_variable *var = vars[i];
+         unsigned int var_refs = refs.get_variable_entry(var)->referenced_count;
+         unsigned int var_size = var->type->std430_size(false);
+         unsigned int j = i;
+         while (j > 0) {
+            unsigned int other_refs = refs.get_variable_entry(ranked[j - 1])->referenced_count;
+            unsigned int other_size = ranked[j - 1]->type->std430_size(false);
+            if (other_refs > var_refs || (other_refs == var_refs && other_size <= var_size))
+               break;
+            ranked[j] = ranked[j - 1];
+            j--;
+         }
+         ranked[j] = var;
+      }
+
+      for (unsigned int i = 0; i < count; i++) {
+         insert_uniform(push_vars, push_count, ranked[i]);
+         memcpy(scratch, push_vars, (push_count + 1) * sizeof(ir_variable *));
+         if (layout_uniforms(scratch, push_count + 1, f->push_constant_offset, NULL) <= f->push_constant_budget) {
+            push_count++;
+            continue;
+         }
+
+         /* Doesn't fit, take it out again. */
+         unsigned int j = 0;
+         while (push_vars[j] != ranked[i])
+            j++;
+         memmove(push_vars + j, push_vars + j + 1, (push_count - j) * sizeof(ir_variable *));
+      }
+
+      unsigned int kept = 0;
+      for (unsigned int i = 0; i < count; i++) {
+         bool pushed = false;
+         for (unsigned int j = 0; j < push_count; j++)
+            pushed |= push_vars[j] == vars[i];
+         if (!pushed)
+            vars[kept++] = vars[i];
+      }
+      count = kept;
+   }
+
+   f->uniform_count = count + push_count;
+   if (f->uniform_count == 0)
+      return;
+
+   f->uniform_layout = ralloc_array(NULL, spirv_uniform, f->uniform_count);
+
+   const char *suffix = "";
+   switch (f->shader_stage) {
+   case MESA_SHADER_VERTEX:
+      suffix = "VS";
+      break;
+   case MESA_SHADER_FRAGMENT:
+      suffix = "FS";
+      break;
+   default:
+      break;
+   }
+
+   if (count) {
+      f->uniform_struct_id = f->id++;
+      f->uniform_pointer_id = f->id++;
+      f->uniform_id = f->id++;
+      f->uniform_binding = f->binding_id++;
+
+      f->names.text(SpvOpName, f->uniform_struct_id, ralloc_asprintf(mem_ctx, "Global%s", suffix));
+      f->names.text(SpvOpName, f->uniform_id, "");
+      f->decorates.opcode(3, SpvOpDecorate, f->uniform_struct_id, SpvDecorationBlock);
+      f->decorates.opcode(4, SpvOpDecorate, f->uniform_id, SpvDecorationDescriptorSet, 0);
+      f->decorates.opcode(4, SpvOpDecorate, f->uniform_id, SpvDecorationBinding, f->uniform_binding);
+
+      f->uniform_offset = visit_uniform_block(vars, count, f->uniform_struct_id, f->uniform_id, 0, f->uniforms, f->uniform_layout);
+   }
+
+   if (push_count) {
+      f->push_constant_struct_id = f->id++;
+      f->push_constant_pointer_id = f->id++;
+      f->push_constant_id = f->id++;
+
+      f->names.text(SpvOpName, f->push_constant_struct_id, ralloc_asprintf(mem_ctx, "PushConstant%s", suffix));
+      f->names.text(SpvOpName, f->push_constant_id, "");
+      f->decorates.opcode(3, SpvOpDecorate, f->push_constant_struct_id, SpvDecorationBlock);
+
+      f->push_constant_offset = visit_uniform_block(push_vars, push_count, f->push_constant_struct_id, f->push_constant_id, f->push_constant_offset, f->push_constants, f->uniform_layout + count);
+   }
+}
+
+unsigned int
+ir_print_spirv_visitor::visit_uniform_block(ir_variable **vars, unsigned int count, unsigned int struct_id, unsigned int block_id, unsigned int offset, binary_buffer &members, spirv_uniform *layout)
+{
+   unsigned int *offsets = ralloc_array(mem_ctx, unsigned int, count);
+   unsigned int end = layout_uniforms(vars, count, offset, offsets);
+
+   for (unsigned int i = 0; i < count; i++) {
+      ir_variable *var = vars[i];
+      unsigned int type_id = visit_type(var->type, var->data.image_format);
+
+      var->ir_uniform_location = i;
+      var->ir_pointer = block_id;
+      members.push(type_id);
+
+      f->names.text(SpvOpMemberName, struct_id, i, var->name);
+      f->decorates.opcode(5, SpvOpMemberDecorate, struct_id, i, SpvDecorationOffset, offsets[i]);
+
+      if (var->type->is_matrix()) {
+         f->decorates.opcode(4, SpvOpMemberDecorate, struct_id, i, SpvDecorationColMajor);
+         f->decorates.opcode(5, SpvOpMemberDecorate, struct_id, i, SpvDecorationMatrixStride, var->type->column_type()->std430_array_stride(false));
+      }
+
+      layout[i].name = ralloc_strdup(f->uniform_layout, var->name);
+      layout[i].type = var->type;
+      layout[i].offset = offsets[i];
+      layout[i].size = var->type->std430_size(false);
+      layout[i].push_constant = block_id == f->push_constant_id;
+   }
+
+   return end;
+}
+
 void
 ir_print_spirv_visitor::visit(ir_variable *ir)
 {
@@ -803,44 +1073,7 @@ ir_print_spirv_visitor::visit(ir_variable *ir)
            ir->ir_binding_point = f->binding_id++;
          }
       } else {
-         if (f->uniform_struct_id == 0) {
-            unsigned int uniform_struct_id = f->id++;
-            unsigned int uniform_pointer_id = f->id++;
-            unsigned int uniform_id = f->id++;
-            unsigned int binding_id = f->binding_id++;
-            const char *struct_name = "Global";
-
-            switch (f->shader_stage) {
-            case MESA_SHADER_VERTEX:
-               struct_name = "GlobalVS";
-               break;
-            case MESA_SHADER_FRAGMENT:
-               struct_name = "GlobalFS";
-               break;
-            }
-
-            f->names.text(SpvOpName, uniform_struct_id, struct_name);
-            f->names.text(SpvOpName, uniform_id, "");
-            f->decorates.opcode(3, SpvOpDecorate, uniform_struct_id, SpvDecorationBlock);
-            f->decorates.opcode(4, SpvOpDecorate, uniform_id, SpvDecorationDescriptorSet, 0);
-            f->decorates.opcode(4, SpvOpDecorate, uniform_id, SpvDecorationBinding, binding_id);
-
-            f->uniform_struct_id = uniform_struct_id;
-            f->uniform_pointer_id = uniform_pointer_id;
-            f->uniform_id = uniform_id;
-         }
-         ir->ir_uniform_location = f->uniforms.count();
-         f->uniforms.push(type_id);
-
-         f->names.text(SpvOpMemberName, f->uniform_struct_id, ir->ir_uniform_location, ir->name);
-         f->decorates.opcode(5, SpvOpMemberDecorate, f->uniform_struct_id, ir->ir_uniform_location, SpvDecorationOffset, f->uniform_offset);
-
-         if (ir->type->is_matrix()) {
-            f->decorates.opcode(4, SpvOpMemberDecorate, f->uniform_struct_id, ir->ir_uniform_location, SpvDecorationColMajor);
-            f->decorates.opcode(5, SpvOpMemberDecorate, f->uniform_struct_id, ir->ir_uniform_location, SpvDecorationMatrixStride, 16);
-         }
-
-         f->uniform_offset += ir->type->std430_array_stride(false);
+         /* Already a member of the block, see visit_uniform_layout(). */
       }
    } else {
       unsigned int pointer_id = visit_type_pointer(ir->type, ir->data.mode, type_id);
@@ -859,30 +1092,28 @@ ir_print_spirv_visitor::visit(ir_variable *ir)
          f->inouts.push(name_id);
 
          unsigned int loc_id;
-         if (ir->data.explicit_location) {
-            switch (f->shader_stage) {
-            case MESA_SHADER_VERTEX:
-               loc_id = (ir->data.mode == ir_var_shader_in)
-                  ? (ir->data.location - VERT_ATTRIB_GENERIC0)
-                  : (ir->data.location - VARYING_SLOT_VAR0);
-               break;
-
-            case MESA_SHADER_FRAGMENT:
-               loc_id = (ir->data.mode == ir_var_shader_out)
-                  ? (ir->data.location - FRAG_RESULT_DATA0)
-                  : (ir->data.location - VARYING_SLOT_VAR0);
-               break;
-
-            default:
-               unreachable("Unexpected shader type");
-               break;
-            }
+         if (ir->data.explicit_location || (f->linked && ir->data.location >= 0)) {
+            if (f->shader_stage == MESA_SHADER_VERTEX && ir->data.mode == ir_var_shader_in)
+               loc_id = ir->data.location - VERT_ATTRIB_GENERIC0;
+            else if (f->shader_stage == MESA_SHADER_FRAGMENT && ir->data.mode == ir_var_shader_out)
+               loc_id = ir->data.location - FRAG_RESULT_DATA0;
+            else if (ir->data.patch)
+               loc_id = ir->data.location - VARYING_SLOT_PATCH0;
+            else
+               loc_id = ir->data.location - VARYING_SLOT_VAR0;
          }
          else {
             loc_id = ir->data.mode == ir_var_shader_in ? f->input_loc++ : f->output_loc++;
          }
 
          f->decorates.opcode(4, SpvOpDecorate, name_id, SpvDecorationLocation, loc_id);
+         if (ir->data.patch)
+            f->decorates.opcode(3, SpvOpDecorate, name_id, SpvDecorationPatch);
+
+         /* Varyings that share a location with others start past them. */
+         if (ir->data.location_frac && (ir->data.explicit_component || f->linked)) {
+            f->decorates.opcode(4, SpvOpDecorate, name_id, SpvDecorationComponent, ir->data.location_frac);
+         }
       }
    }
 }
@@ -1127,6 +1358,12 @@ ir_print_spirv_visitor::visit(ir_expression *ir)
          }
          f->codes.opcode(4, opcode, type_id, value_id, operands[0]);
          break;
+      case ir_unop_bitcast_i2f:
+      case ir_unop_bitcast_f2i:
+      case ir_unop_bitcast_u2f:
+      case ir_unop_bitcast_f2u:
+         f->codes.opcode(4, SpvOpBitcast, type_id, value_id, operands[0]);
+         break;
       }
 
       ir->ir_value = value_id;
@@ -1147,10 +1384,7 @@ ir_print_spirv_visitor::visit(ir_expression *ir)
             if (ir->operands[i]->type == ir->type) {
                operands[i] = ir->operands[i]->ir_value;
             } else if (ir->operands[i]->type->components() == 1) {
-               operands[i] = f->id++;
-
-               unsigned int id = ir->operands[i]->ir_value;
-               f->codes.opcode(3 + ir->type->components(), SpvOpCompositeConstruct, type_id, operands[i], id, id, id, id);
+               operands[i] = visit_splat(ir->type, type_id, ir->operands[i]->ir_value);
             } else {
                unreachable("operands must match result or be scalar");
             }
@@ -1245,10 +1479,7 @@ ir_print_spirv_visitor::visit(ir_expression *ir)
             if (ir->operands[i]->type == ir->type) {
                operands[i] = ir->operands[i]->ir_value;
             } else if (ir->operands[i]->type->components() == 1) {
-               operands[i] = f->id++;
-
-               unsigned int id = ir->operands[i]->ir_value;
-               f->codes.opcode(3 + ir->type->components(), SpvOpCompositeConstruct, type_id, operands[i], id, id, id, id);
+               operands[i] = visit_splat(ir->type, type_id, ir->operands[i]->ir_value);
             } else {
                unreachable("operands must match result or be scalar");
             }
@@ -1565,11 +1796,11 @@ ir_print_spirv_visitor::visit(ir_dereference_variable *ir)
          break;
       } else {
          unsigned int uniform_type_id = visit_type(var->type);
-         unsigned int uniform_pointer_id = visit_type_pointer(var->type, ir_var_uniform, uniform_type_id);
+         unsigned int uniform_pointer_id = visit_type_pointer(var->type, pointer_mode(var), uniform_type_id);
          unsigned int pointer_id = f->id++;
          unsigned int index_id = visit_constant_value(var->ir_uniform_location);
 
-         f->codes.opcode(5, SpvOpAccessChain, uniform_pointer_id, pointer_id, f->uniform_id, index_id);
+         f->codes.opcode(5, SpvOpAccessChain, uniform_pointer_id, pointer_id, var->ir_pointer, index_id);
 
          ir->ir_pointer = pointer_id;
          break;
@@ -1695,7 +1926,7 @@ ir_print_spirv_visitor::visit(ir_dereference_array *ir)
    }
    ir_dereference_variable *var = array->as_dereference_variable();
 
-   unsigned int variable_mode = (var && var->var) ? var->var->data.mode : ir_var_auto;
+   unsigned int variable_mode = (var && var->var) ? pointer_mode(var->var) : ir_var_auto;
    unsigned int type_id = visit_type(ir->type);
    unsigned int type_pointer_id = visit_type_pointer(ir->type, variable_mode, type_id);
    unsigned int pointer_id = f->id++;
@@ -60,9 +60,21 @@ protected:
    unsigned int capacity;
 };
 
+/**
+ * A member of the block that holds the default-block uniforms of a stage.
+ */
+struct spirv_uniform {
+   const char *name;
+   const struct glsl_type *type;
+   unsigned int offset;
+   unsigned int size;
+   bool push_constant;
+};
+
 class spirv_buffer : public binary_buffer {
 public:
    spirv_buffer();
+   virtual ~spirv_buffer();
 
    binary_buffer names;
    binary_buffer decorates;
@@ -74,10 +86,14 @@ public:
 
    binary_buffer inouts;
    binary_buffer uniforms;
+   binary_buffer push_constants;
    binary_buffer per_vertices;
 
    gl_shader_stage shader_stage;
 
+   /** The inputs and outputs were given their locations by the linker. */
+   bool linked;
+
    unsigned int id;
    unsigned int binding_id;
 
@@ -86,6 +102,19 @@ public:
 
    void *memory_begin;
 
+   /**
+    * Largest offset that the push constants of the stage may end at, or 0
+    * to keep every uniform in the uniform buffer.
+    */
+   unsigned int push_constant_budget;
+
+   /**
+    * Offset that the push constants of the stage start at, and end at once
+    * the stage has been printed.  Stages of a program share the push
+    * constant range, so each one starts where the previous one ended.
+    */
+   unsigned int push_constant_offset;
+
    bool capability_draw_parameters;
    bool capability_geometry;
    bool capability_image_query;
@@ -97,7 +126,15 @@ public:
    unsigned int uniform_struct_id;
    unsigned int uniform_id;
    unsigned int uniform_pointer_id;
+   unsigned int uniform_binding;
    unsigned int uniform_offset;
+   unsigned int push_constant_struct_id;
+   unsigned int push_constant_id;
+   unsigned int push_constant_pointer_id;
+
+   /** The members of the uniform block, followed by the push constants. */
+   unsigned int uniform_count;
+   spirv_uniform *uniform_layout;
    unsigned int function_id;
    unsigned int main_id;
 
@@ -177,8 +214,21 @@ public:
    unsigned int visit_constant_value(int value);
    unsigned int visit_constant_value(unsigned int value);
    void visit_value(ir_rvalue *ir);
+   unsigned int visit_splat(const struct glsl_type *type, unsigned int type_id, unsigned int scalar_id);
    void visit_precision(unsigned int id, unsigned int type, unsigned int precision);
 
+   /**
+    * Lay out the block of default-block uniforms before any of \c instructions
+    * is printed.
+    *
+    * Uniforms that are never read are left out, and the others are ordered
+    * by alignment so that as little of the block as possible is padding.
+    * With a push constant budget, the uniforms that are referenced most
+    * often go to a push constant block instead, as long as they fit.
+    */
+   void visit_uniform_layout(exec_list *instructions);
+   unsigned int visit_uniform_block(ir_variable **vars, unsigned int count, unsigned int struct_id, unsigned int block_id, unsigned int offset, binary_buffer &members, spirv_uniform *layout);
+
 private:
    /**
     * Fetch/generate a unique name for ir_variable.
@@ -188,6 +238,12 @@ private:
     */
    unsigned int unique_name(ir_variable *var);
 
+   /**
+    * The mode to look up pointer types of \c var with, which for uniforms
+    * that are push constants is ir_var_const_in.
+    */
+   unsigned int pointer_mode(ir_variable *var);
+
    /** A mapping from ir_variable * -> unique printable names. */
    int parameter_number;
    int name_number;
@@ -203,6 +259,23 @@ private:
 extern "C" {
 void
 _mesa_print_spirv(spirv_buffer *f, exec_list *instructions, struct _mesa_glsl_parse_state* state, unsigned binding);
+
+/**
+ * Print the IR of a shader of \c stage without its parse state, such as a
+ * linked shader.  With \c linked, every input and output is placed at the
+ * location assigned to it by the linker.
+ */
+void
+_mesa_print_spirv_stage(spirv_buffer *f, exec_list *instructions, gl_shader_stage stage, unsigned version, bool es, bool linked, unsigned binding);
+
+/**
+ * First binding from \c binding on that is above the explicit binding of
+ * every sampler and image in \c instructions.  The bindings that the
+ * printer assigns itself start there, so that they never take one that a
+ * shader asked for.
+ */
+unsigned
+_mesa_spirv_first_free_binding(exec_list *instructions, unsigned binding);
 }
 
 #endif /* IR_PRINT_SPIRV_VISITOR_H */
@@ -0,0 +1,429 @@
+/*
+ * Copyright © 2026 xxGLSLCompiler contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file program_reflection.cpp
+ *
+ * The records are built once, in their binary form, and the JSON writer
+ * reads them back, so that both outputs always describe the same thing.
+ */
+
+#include <stdio.h>
+
+#include "program_reflection.h"
+#include "ir_print_spirv_visitor.h"
+#include "ir_uniform.h"
+#include "compiler/shader_enums.h"
+#include "main/mtypes.h"
+#include "util/blob.h"
+#include "util/macros.h"
+#include "util/ralloc.h"
+
+struct program_reflection {
+   struct blob strings;
+   struct blob resources;
+   struct blob stages;
+   struct blob members;
+   struct blob bindings;
+};
+
+static const char *const interface_names[] = {
+   "program_input",
+   "program_output",
+   "uniform",
+   "uniform_block",
+   "buffer_variable",
+   "shader_storage_block",
+   "atomic_counter_buffer",
+};
+
+static void
+reflection_destructor(void *ptr)
+{
+   struct program_reflection *reflection = (struct program_reflection *) ptr;
+
+   blob_finish(&reflection->strings);
+   blob_finish(&reflection->resources);
+   blob_finish(&reflection->stages);
+   blob_finish(&reflection->members);
+   blob_finish(&reflection->bindings);
+}
+
+static uint32_t
+add_string(struct program_reflection *reflection, const char *str)
+{
+   uint32_t offset = reflection->strings.size;
+   blob_write_string(&reflection->strings, str ? str : "");
+   return offset;
+}
+
+static void
+add_resource(struct program_reflection *reflection,
+             enum reflect_interface interface, const char *name,
+             const glsl_type *type, unsigned stages)
+{
+   struct reflect_resource resource;
+
+   resource.interface = interface;
+   resource.name = add_string(reflection, name);
+   resource.type = add_string(reflection, type ? type->name : NULL);
+   resource.location = -1;
+   resource.component = -1;
+   resource.block_index = -1;
+   resource.offset = -1;
+   resource.array_size = type && type->is_array() ? type->length : -1;
+   resource.binding = -1;
+   resource.size = -1;
+   resource.stages = stages;
+
+   blob_write_bytes(&reflection->resources, &resource, sizeof(resource));
+}
+
+static struct reflect_resource *
+last_resource(struct program_reflection *reflection)
+{
+   return (struct reflect_resource *)
+      (reflection->resources.data + reflection->resources.size) - 1;
+}
+
+static void
+add_variable(struct program_reflection *reflection,
+             enum reflect_interface interface,
+             const gl_shader_variable *var, unsigned stages)
+{
+   add_resource(reflection, interface, var->name, var->type, stages);
+
+   struct reflect_resource *resource = last_resource(reflection);
+   resource->location = var->location;
+   resource->component = var->component;
+}
+
+static void
+add_uniform(struct program_reflection *reflection,
+            enum reflect_interface interface,
+            const gl_uniform_storage *uniform, unsigned stages)
+{
+   add_resource(reflection, interface, uniform->name, uniform->type, stages);
+
+   struct reflect_resource *resource = last_resource(reflection);
+   if (uniform->remap_location != ~0u)
+      resource->location = uniform->remap_location;
+   resource->block_index = uniform->block_index;
+   if (uniform->block_index != -1)
+      resource->offset = uniform->offset;
+   if (uniform->array_elements)
+      resource->array_size = uniform->array_elements;
+}
+
+static void
+add_block(struct program_reflection *reflection,
+          enum reflect_interface interface, const gl_uniform_block *block)
+{
+   add_resource(reflection, interface, block->Name, NULL, block->stageref);
+
+   struct reflect_resource *resource = last_resource(reflection);
+   resource->binding = block->Binding;
+   resource->size = block->UniformBufferSize;
+}
+
+struct program_reflection *
+program_reflection_create(void *mem_ctx, struct gl_shader_program *prog)
+{
+   struct program_reflection *reflection =
+      rzalloc(mem_ctx, struct program_reflection);
+
+   blob_init(&reflection->strings);
+   blob_init(&reflection->resources);
+   blob_init(&reflection->stages);
+   blob_init(&reflection->members);
+   blob_init(&reflection->bindings);
+   ralloc_set_destructor(reflection, reflection_destructor);
+
+   /* Offset 0 is the empty string. */
+   add_string(reflection, "");
+
+   for (unsigned i = 0; i < prog->data->NumProgramResourceList; i++) {
+      const gl_program_resource *res = &prog->data->ProgramResourceList[i];
+
+      switch (res->Type) {
+      case GL_PROGRAM_INPUT:
+         add_variable(reflection, REFLECT_PROGRAM_INPUT,
+                      (const gl_shader_variable *) res->Data,
+                      res->StageReferences);
+         break;
+      case GL_PROGRAM_OUTPUT:
+         add_variable(reflection, REFLECT_PROGRAM_OUTPUT,
+                      (const gl_shader_variable *) res->Data,
+                      res->StageReferences);
+         break;
+      case GL_UNIFORM:
+         add_uniform(reflection, REFLECT_UNIFORM,
+                     (const gl_uniform_storage *) res->Data,
+                     res->StageReferences);
+         break;
+      case GL_BUFFER_VARIABLE:
+         add_uniform(reflection, REFLECT_BUFFER_VARIABLE,
+                     (const gl_uniform_storage *) res->Data,
+                     res->StageReferences);
+         break;
+      case GL_UNIFORM_BLOCK:
+         add_block(reflection, REFLECT_UNIFORM_BLOCK,
+                   (const gl_uniform_block *) res->Data);
+         break;
+      case GL_SHADER_STORAGE_BLOCK:
+         add_block(reflection, REFLECT_SHADER_STORAGE_BLOCK,
+                   (const gl_uniform_block *) res->Data);
+         break;
+      case GL_ATOMIC_COUNTER_BUFFER: {
+         const gl_active_atomic_buffer *buffer =
+            (const gl_active_atomic_buffer *) res->Data;
+         unsigned stages = 0;
+         for (unsigned j = 0; j < MESA_SHADER_STAGES; j++)
+            stages |= buffer->StageReferences[j] << j;
+
+         add_resource(reflection, REFLECT_ATOMIC_COUNTER_BUFFER, NULL, NULL,
+                      stages);
+
+         struct reflect_resource *resource = last_resource(reflection);
+         resource->binding = buffer->Binding;
+         resource->size = buffer->MinimumSize;
+         break;
+      }
+      default:
+         /* Transform feedback and subroutines are of no use to a Vulkan
+          * application.
+          */
+         break;
+      }
+   }
+
+   return reflection;
+}
+
+void
+program_reflection_add_stage(struct program_reflection *reflection,
+                             unsigned stage, spirv_buffer *buffer,
+                             exec_list *instructions, const char *module)
+{
+   struct reflect_stage info;
+
+   info.stage = stage;
+   info.module = add_string(reflection, module);
+   info.uniform_binding = buffer->uniform_struct_id ? (int32_t) buffer->uniform_binding : -1;
+   info.uniform_size = buffer->uniform_offset;
+   info.push_constant_begin = buffer->push_constant_offset;
+   info.push_constant_end = buffer->push_constant_offset;
+   info.first_member = reflection->members.size / sizeof(struct reflect_member);
+   info.num_members = buffer->uniform_count;
+   info.first_binding = reflection->bindings.size / sizeof(struct reflect_binding);
+   info.num_bindings = 0;
+
+   for (unsigned i = 0; i < buffer->uniform_count; i++) {
+      const spirv_uniform *uniform = &buffer->uniform_layout[i];
+      struct reflect_member member;
+
+      member.name = add_string(reflection, uniform->name);
+      member.type = add_string(reflection, uniform->type->name);
+      member.offset = uniform->offset;
+      member.size = uniform->size;
+      member.push_constant = uniform->push_constant;
+
+      if (uniform->push_constant)
+         info.push_constant_begin = MIN2(info.push_constant_begin, uniform->offset);
+
+      blob_write_bytes(&reflection->members, &member, sizeof(member));
+   }
+
+   /* Only the samplers and images that the module declares have bindings. */
+   foreach_in_list(ir_instruction, node, instructions) {
+      ir_variable *var = node->as_variable();
+      if (var == NULL || var->data.mode != ir_var_uniform || var->ir_pointer == 0)
+         continue;
+      if (!var->type->is_image() && !var->type->is_sampler())
+         continue;
+
+      struct reflect_binding binding;
+
+      binding.name = add_string(reflection, var->name);
+      binding.type = add_string(reflection, var->type->name);
+      binding.binding = var->ir_binding_point;
+
+      blob_write_bytes(&reflection->bindings, &binding, sizeof(binding));
+      info.num_bindings++;
+   }
+
+   blob_write_bytes(&reflection->stages, &info, sizeof(info));
+}
+
+static const char *
+string(struct program_reflection *reflection, uint32_t offset)
+{
+   return (const char *) reflection->strings.data + offset;
+}
+
+static void
+write_stage_mask(FILE *f, uint32_t stages)
+{
+   bool first = true;
+
+   fprintf(f, "[");
+   for (unsigned i = 0; i < MESA_SHADER_STAGES; i++) {
+      if (stages & (1 << i)) {
+         fprintf(f, "%s\"%s\"", first ? "" : ", ",
+                 _mesa_shader_stage_to_string(i));
+         first = false;
+      }
+   }
+   fprintf(f, "]");
+}
+
+bool
+program_reflection_write_json(struct program_reflection *reflection,
+                              const char *file_name)
+{
+   FILE *f = fopen(file_name, "w");
+   if (!f)
+      return false;
+
+   const struct reflect_resource *resources =
+      (const struct reflect_resource *) reflection->resources.data;
+   unsigned num_resources =
+      reflection->resources.size / sizeof(struct reflect_resource);
+
+   fprintf(f, "{\n");
+   fprintf(f, "  \"resources\": [");
+   for (unsigned i = 0; i < num_resources; i++) {
+      const struct reflect_resource *res = &resources[i];
+
+      fprintf(f, "%s\n    { \"interface\": \"%s\", \"name\": \"%s\"",
+              i ? "," : "", interface_names[res->interface],
+              string(reflection, res->name));
+      if (res->type)
+         fprintf(f, ", \"type\": \"%s\"", string(reflection, res->type));
+      if (res->location != -1)
+         fprintf(f, ", \"location\": %d", res->location);
+      if (res->component > 0)
+         fprintf(f, ", \"component\": %d", res->component);
+      if (res->block_index != -1)
+         fprintf(f, ", \"block_index\": %d, \"offset\": %d",
+                 res->block_index, res->offset);
+      if (res->array_size != -1)
+         fprintf(f, ", \"array_size\": %d", res->array_size);
+      if (res->binding != -1)
+         fprintf(f, ", \"binding\": %d, \"size\": %d",
+                 res->binding, res->size);
+      fprintf(f, ", \"stages\": ");
+      write_stage_mask(f, res->stages);
+      fprintf(f, " }");
+   }
+   fprintf(f, "%s],\n", num_resources ? "\n  " : "");
+
+   const struct reflect_stage *stages =
+      (const struct reflect_stage *) reflection->stages.data;
+   const struct reflect_member *members =
+      (const struct reflect_member *) reflection->members.data;
+   const struct reflect_binding *bindings =
+      (const struct reflect_binding *) reflection->bindings.data;
+   unsigned num_stages = reflection->stages.size / sizeof(struct reflect_stage);
+
+   fprintf(f, "  \"stages\": [");
+   for (unsigned i = 0; i < num_stages; i++) {
+      const struct reflect_stage *stage = &stages[i];
+
+      fprintf(f, "%s\n    {\n", i ? "," : "");
+      fprintf(f, "      \"stage\": \"%s\",\n",
+              _mesa_shader_stage_to_string(stage->stage));
+      fprintf(f, "      \"module\": \"%s\",\n",
+              string(reflection, stage->module));
+      if (stage->uniform_binding != -1)
+         fprintf(f, "      \"uniform_binding\": %d,\n", stage->uniform_binding);
+      fprintf(f, "      \"uniform_size\": %u,\n", stage->uniform_size);
+      fprintf(f, "      \"push_constant_range\": [%u, %u],\n",
+              stage->push_constant_begin, stage->push_constant_end);
+
+      fprintf(f, "      \"members\": [");
+      for (unsigned j = 0; j < stage->num_members; j++) {
+         const struct reflect_member *member = &members[stage->first_member + j];
+
+         fprintf(f, "%s\n        { \"name\": \"%s\", \"type\": \"%s\", "
+                 "\"offset\": %u, \"size\": %u, \"push_constant\": %s }",
+                 j ? "," : "", string(reflection, member->name),
+                 string(reflection, member->type), member->offset,
+                 member->size, member->push_constant ? "true" : "false");
+      }
+      fprintf(f, "%s],\n", stage->num_members ? "\n      " : "");
+
+      fprintf(f, "      \"bindings\": [");
+      for (unsigned j = 0; j < stage->num_bindings; j++) {
+         const struct reflect_binding *binding = &bindings[stage->first_binding + j];
+
+         fprintf(f, "%s\n        { \"name\": \"%s\", \"type\": \"%s\", "
+                 "\"binding\": %u }",
+                 j ? "," : "", string(reflection, binding->name),
+                 string(reflection, binding->type), binding->binding);
+      }
+      fprintf(f, "%s]\n", stage->num_bindings ? "\n      " : "");
+      fprintf(f, "    }");
+   }
+   fprintf(f, "%s]\n", num_stages ? "\n  " : "");
+   fprintf(f, "}\n");
+
+   fclose(f);
+   return true;
+}
+
+bool
+program_reflection_write_binary(struct program_reflection *reflection,
+                                const char *file_name)
+{
+   struct reflect_header header;
+
+   header.magic = REFLECT_MAGIC;
+   header.version = REFLECT_VERSION;
+   header.num_resources = reflection->resources.size / sizeof(struct reflect_resource);
+   header.num_stages = reflection->stages.size / sizeof(struct reflect_stage);
+   header.num_members = reflection->members.size / sizeof(struct reflect_member);
+   header.num_bindings = reflection->bindings.size / sizeof(struct reflect_binding);
+   header.string_table_size = ALIGN_POT(reflection->strings.size, sizeof(uint32_t));
+   header.size = sizeof(header) + reflection->resources.size +
+                 reflection->stages.size + reflection->members.size +
+                 reflection->bindings.size + header.string_table_size;
+
+   FILE *f = fopen(file_name, "wb");
+   if (!f)
+      return false;
+
+   static const uint32_t padding = 0;
+
+   fwrite(&header, sizeof(header), 1, f);
+   fwrite(reflection->resources.data, 1, reflection->resources.size, f);
+   fwrite(reflection->stages.data, 1, reflection->stages.size, f);
+   fwrite(reflection->members.data, 1, reflection->members.size, f);
+   fwrite(reflection->bindings.data, 1, reflection->bindings.size, f);
+   fwrite(reflection->strings.data, 1, reflection->strings.size, f);
+   fwrite(&padding, 1, header.string_table_size - reflection->strings.size, f);
+
+   bool ok = ferror(f) == 0;
+   fclose(f);
+   return ok;
+}
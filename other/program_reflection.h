@@ -0,0 +1,153 @@
+/* -*- c++ -*- */
+/*
+ * Copyright © 2026 xxGLSLCompiler contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file program_reflection.h
+ *
+ * Reflection of a linked program and of the SPIR-V modules printed for it.
+ *
+ * The resources come from the program resource list that the linker builds,
+ * and the bindings, block offsets and push constants from the SPIR-V printer,
+ * so that an application can look all of them up without reflecting the
+ * modules at load time.
+ *
+ * The reflection is written either as JSON or in the binary form described
+ * by the structures below.  The binary form is meant to be mapped into
+ * memory as it is: every field is a little-endian 32-bit word, the records
+ * follow the header in the order of its counts, and names are offsets into
+ * the string table at the end, which holds NUL-terminated strings.
+ */
+
+#pragma once
+#ifndef PROGRAM_REFLECTION_H
+#define PROGRAM_REFLECTION_H
+
+#include <stdint.h>
+
+#define REFLECT_MAGIC   0x46525858 /* "XXRF" */
+#define REFLECT_VERSION 1
+
+/** Program interface of a reflect_resource. */
+enum reflect_interface {
+   REFLECT_PROGRAM_INPUT,
+   REFLECT_PROGRAM_OUTPUT,
+   REFLECT_UNIFORM,
+   REFLECT_UNIFORM_BLOCK,
+   REFLECT_BUFFER_VARIABLE,
+   REFLECT_SHADER_STORAGE_BLOCK,
+   REFLECT_ATOMIC_COUNTER_BUFFER,
+};
+
+struct reflect_header {
+   uint32_t magic;
+   uint32_t version;
+   uint32_t num_resources;
+   uint32_t num_stages;
+   uint32_t num_members;
+   uint32_t num_bindings;
+   uint32_t string_table_size;
+   uint32_t size;
+};
+
+/**
+ * A resource of the program.  Fields that don't apply to the interface of
+ * the resource are -1.
+ */
+struct reflect_resource {
+   uint32_t interface;        /**< enum reflect_interface */
+   uint32_t name;
+   uint32_t type;             /**< GLSL type name, or "" for blocks */
+   int32_t location;
+   int32_t component;
+   int32_t block_index;       /**< Block that a uniform or variable is in */
+   int32_t offset;            /**< Offset in that block */
+   int32_t array_size;
+   int32_t binding;           /**< Binding of a block or buffer */
+   int32_t size;              /**< Size of a block or buffer */
+   uint32_t stages;           /**< Mask of the stages that use it */
+};
+
+/**
+ * The SPIR-V module of a stage.  Its uniform buffer members and push
+ * constants are the reflect_member records from \c first_member on, and the
+ * bindings of its samplers and images the reflect_binding records from
+ * \c first_binding on.
+ */
+struct reflect_stage {
+   uint32_t stage;            /**< gl_shader_stage */
+   uint32_t module;           /**< File name of the module */
+   int32_t uniform_binding;   /**< Binding of the uniform buffer, or -1 */
+   uint32_t uniform_size;
+   uint32_t push_constant_begin;
+   uint32_t push_constant_end;
+   uint32_t first_member;
+   uint32_t num_members;
+   uint32_t first_binding;
+   uint32_t num_bindings;
+};
+
+struct reflect_member {
+   uint32_t name;
+   uint32_t type;
+   uint32_t offset;
+   uint32_t size;
+   uint32_t push_constant;
+};
+
+struct reflect_binding {
+   uint32_t name;
+   uint32_t type;
+   uint32_t binding;
+};
+
+struct exec_list;
+struct gl_shader_program;
+struct program_reflection;
+class spirv_buffer;
+
+/**
+ * Start the reflection of \c prog, which must have been linked and have had
+ * its program resource list built.
+ */
+struct program_reflection *
+program_reflection_create(void *mem_ctx, struct gl_shader_program *prog);
+
+/**
+ * Add the SPIR-V module that \c buffer holds for \c stage, printed from
+ * \c instructions to \c module.
+ */
+void
+program_reflection_add_stage(struct program_reflection *reflection,
+                             unsigned stage, spirv_buffer *buffer,
+                             exec_list *instructions, const char *module);
+
+bool
+program_reflection_write_json(struct program_reflection *reflection,
+                              const char *file_name);
+
+bool
+program_reflection_write_binary(struct program_reflection *reflection,
+                                const char *file_name);
+
+#endif /* PROGRAM_REFLECTION_H */
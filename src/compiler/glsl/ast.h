@@ -1359,6 +1359,23 @@ private:
 extern void
 _mesa_ast_to_hir(exec_list *instructions, struct _mesa_glsl_parse_state *state);
 
+/**
+ * \name Piecewise AST to HIR conversion
+ *
+ * _mesa_ast_to_hir() is _mesa_ast_to_hir_begin(), the \c hir method of each
+ * external declaration in order, then _mesa_ast_to_hir_end().  Splitting it
+ * up lets declarations be converted while the parser is still running.
+ */
+/*@{*/
+extern void
+_mesa_ast_to_hir_begin(exec_list *instructions,
+                       struct _mesa_glsl_parse_state *state);
+
+extern void
+_mesa_ast_to_hir_end(exec_list *instructions,
+                     struct _mesa_glsl_parse_state *state);
+/*@}*/
+
 extern ir_rvalue *
 _mesa_ast_field_selection_to_hir(const ast_expression *expr,
 				 exec_list *instructions,
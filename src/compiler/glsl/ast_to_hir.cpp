@@ -127,6 +127,18 @@ private:
 
 void
 _mesa_ast_to_hir(exec_list *instructions, struct _mesa_glsl_parse_state *state)
+{
+   _mesa_ast_to_hir_begin(instructions, state);
+
+   foreach_list_typed (ast_node, ast, link, & state->translation_unit)
+      ast->hir(instructions, state);
+
+   _mesa_ast_to_hir_end(instructions, state);
+}
+
+void
+_mesa_ast_to_hir_begin(exec_list *instructions,
+                       struct _mesa_glsl_parse_state *state)
 {
    _mesa_glsl_initialize_variables(instructions, state);
 
@@ -154,14 +166,21 @@ _mesa_ast_to_hir(exec_list *instructions, struct _mesa_glsl_parse_state *state)
     * by the linker.
     */
    state->symbols->push_scope();
+}
 
-   foreach_list_typed (ast_node, ast, link, & state->translation_unit)
-      ast->hir(instructions, state);
-
+void
+_mesa_ast_to_hir_end(exec_list *instructions,
+                     struct _mesa_glsl_parse_state *state)
+{
    verify_subroutine_associated_funcs(state);
    detect_recursion_unlinked(state, instructions);
    detect_conflicting_assignments(state, instructions);
 
+   /* Built-in variables that weren't referenced by the shader stay out of
+    * its IR; the lookups below only ask about the ones that were.
+    */
+   state->symbols->builtin_instructions = NULL;
+
    state->toplevel_ir = NULL;
 
    /* Move all of the variable declarations to the front of the IR list, and
@@ -8464,7 +8483,12 @@ ast_interface_block::hir(exec_list *instructions,
           * validate_intrastage_interface_blocks() from getting confused and
           * thinking there are conflicting definitions of gl_PerVertex in the
           * shader.
+          *
+          * Members that haven't been referenced yet have to be declared
+          * first, so that they are disabled along with the others.
           */
+         state->symbols->declare_builtin_interface(earlier_per_vertex,
+                                                   var_mode);
          foreach_in_list_safe(ir_instruction, node, instructions) {
             ir_variable *const var = node->as_variable();
             if (var != NULL &&
@@ -8517,8 +8541,10 @@ ast_tcs_output_layout::hir(exec_list *instructions,
    state->tcs_output_vertices_specified = true;
 
    /* If any shader outputs occurred before this declaration and did not
-    * specify an array size, their size is determined now.
+    * specify an array size, their size is determined now.  gl_out is one of
+    * them even if it hasn't been referenced yet.
     */
+   state->symbols->declare_builtin_unsized_arrays(ir_var_shader_out);
    foreach_in_list (ir_instruction, node, instructions) {
       ir_variable *var = node->as_variable();
       if (var == NULL || var->data.mode != ir_var_shader_out)
@@ -8570,8 +8596,10 @@ ast_gs_input_layout::hir(exec_list *instructions,
    state->gs_input_prim_type_specified = true;
 
    /* If any shader inputs occurred before this declaration and did not
-    * specify an array size, their size is determined now.
+    * specify an array size, their size is determined now.  gl_in is one of
+    * them even if it hasn't been referenced yet.
     */
+   state->symbols->declare_builtin_unsized_arrays(ir_var_shader_in);
    foreach_in_list(ir_instruction, node, instructions) {
       ir_variable *var = node->as_variable();
       if (var == NULL || var->data.mode != ir_var_shader_in)
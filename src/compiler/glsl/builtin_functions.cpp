@@ -1300,7 +1300,7 @@ builtin_builder::initialize()
 
    glsl_type_singleton_init_or_ref();
 
-   mem_ctx = ralloc_context(NULL);
+   mem_ctx = ralloc_arena_context(NULL);
    create_shader();
    create_intrinsics();
    create_builtins();
@@ -7679,8 +7679,10 @@ _mesa_glsl_builtin_functions_decref()
 {
    mtx_lock(&builtins_lock);
    assert(builtin_users != 0);
-   if (--builtin_users == 0)
+   if (--builtin_users == 0) {
       builtins.release();
+      _mesa_glsl_release_builtin_scopes();
+   }
    mtx_unlock(&builtins_lock);
 }
 
@@ -29,9 +29,9 @@
  * accessors (such as glsl_type::float_type).  Those global variables are
  * declared and initialized in this file.
  *
- * This also contains _mesa_glsl_initialize_types(), a function which populates
- * a symbol table with the available built-in types for a particular language
- * version and set of enabled extensions.
+ * This also contains _mesa_glsl_add_builtin_types(), a function which
+ * populates a symbol table with the available built-in types for a particular
+ * language version and set of enabled extensions.
  */
 
 #include "compiler/glsl_types.h"
@@ -272,12 +272,26 @@ add_type(glsl_symbol_table *symbols, const glsl_type *const type)
 }
 
 /**
- * Populate the symbol table with available built-in types.
+ * Make the available built-in types visible in the parser's symbol table.
  */
 void
 _mesa_glsl_initialize_types(struct _mesa_glsl_parse_state *state)
 {
-   struct glsl_symbol_table *symbols = state->symbols;
+   glsl_builtin_scope *builtins = _mesa_glsl_get_builtin_scope(state);
+
+   state->symbols->builtins = builtins;
+
+   /* Identifiers naming built-ins then share the scope's copy of the name. */
+   _mesa_atom_table_set_parent(state->atoms, builtins->atoms);
+}
+
+/**
+ * Populate a symbol table with available built-in types.
+ */
+void
+_mesa_glsl_add_builtin_types(struct _mesa_glsl_parse_state *state,
+                             struct glsl_symbol_table *symbols)
+{
 
    for (unsigned i = 0; i < ARRAY_SIZE(builtin_type_versions); i++) {
       const struct builtin_type_versions *const t = &builtin_type_versions[i];
@@ -373,6 +373,7 @@ class builtin_variable_generator
 {
 public:
    builtin_variable_generator(exec_list *instructions,
+                              glsl_symbol_table *symtab,
                               struct _mesa_glsl_parse_state *state);
    void generate_constants();
    void generate_uniforms();
@@ -490,8 +491,9 @@ private:
 
 
 builtin_variable_generator::builtin_variable_generator(
-   exec_list *instructions, struct _mesa_glsl_parse_state *state)
-   : instructions(instructions), state(state), symtab(state->symbols),
+   exec_list *instructions, glsl_symbol_table *symtab,
+   struct _mesa_glsl_parse_state *state)
+   : instructions(instructions), state(state), symtab(symtab),
      compatibility(state->compat_shader || state->ARB_compatibility_enable),
      bool_t(glsl_type::bool_type), int_t(glsl_type::int_type),
      uint_t(glsl_type::uint_type),
@@ -1543,11 +1545,78 @@ builtin_variable_generator::generate_varyings()
 }; /* Anonymous namespace */
 
 
+/**
+ * Make the built-in variables visible to the shader being compiled.
+ *
+ * Nothing is declared up front: each built-in variable is copied from the
+ * shared built-in scope into \c instructions when it is first referenced.
+ */
 void
 _mesa_glsl_initialize_variables(exec_list *instructions,
 				struct _mesa_glsl_parse_state *state)
 {
-   builtin_variable_generator gen(instructions, state);
+   state->symbols->builtin_instructions = instructions;
+}
+
+
+namespace {
+
+/**
+ * Everything the contents of a built-in scope depend on
+ *
+ * The context itself isn't part of it: another context may later be
+ * allocated at the same address, and contexts with the same limits can
+ * share their scopes.  Only the context's values that the generator and
+ * _mesa_glsl_add_builtin_types() read are.
+ */
+struct builtin_scope_key {
+   gl_shader_stage stage;
+   unsigned language_version;
+   unsigned forced_language_version;
+   bool es_shader;
+   bool compat_shader;
+   BITSET_DECLARE(extensions, GLSL_EXTENSION_FLAG_BITS);
+
+   decltype(_mesa_glsl_parse_state::Const) Const;
+
+   unsigned MaxVertexOutputComponents;
+   unsigned MaxFragmentInputComponents;
+   unsigned MaxVarying;
+   bool NoPrimitiveBoundingBoxOutput;
+   bool GLSLTessLevelsAsInputs;
+   bool GLSLFragCoordIsSysVal;
+   bool GLSLFrontFacingIsSysVal;
+   bool GLSLPointCoordIsSysVal;
+   bool PositionAlwaysInvariant;
+
+   bool EXT_texture_array;
+   bool EXT_texture_buffer_object;
+   bool EXT_texture_integer;
+   bool NV_texture_rectangle;
+};
+
+struct builtin_scope_entry {
+   builtin_scope_key key;
+   glsl_builtin_scope *scope;
+   builtin_scope_entry *next;
+};
+
+} /* anonymous namespace */
+
+static mtx_t builtin_scopes_lock = _MTX_INITIALIZER_NP;
+static void *builtin_scopes_mem_ctx = NULL;
+static builtin_scope_entry *builtin_scopes = NULL;
+
+static glsl_builtin_scope *
+create_builtin_scope(void *mem_ctx, struct _mesa_glsl_parse_state *state)
+{
+   glsl_builtin_scope *scope = new(mem_ctx) glsl_builtin_scope;
+   scope->atoms = _mesa_atom_table_ctor(scope);
+   scope->symbols = new(scope) glsl_symbol_table(scope->atoms);
+
+   _mesa_glsl_add_builtin_types(state, scope->symbols);
+
+   builtin_variable_generator gen(&scope->variables, scope->symbols, state);
 
    gen.generate_constants();
    gen.generate_uniforms();
@@ -1577,4 +1646,78 @@ _mesa_glsl_initialize_variables(exec_list *instructions,
    default:
       break;
    }
+
+   return scope;
+}
+
+glsl_builtin_scope *
+_mesa_glsl_get_builtin_scope(struct _mesa_glsl_parse_state *state)
+{
+   const struct gl_context *ctx = state->ctx;
+   builtin_scope_key key;
+
+   /* Zero the padding too, since keys are compared with memcmp.  The limits
+    * are copied with their padding, which is zero as the state is
+    * rzalloc'ed.
+    */
+   memset(&key, 0, sizeof(key));
+   key.stage = state->stage;
+   key.language_version = state->language_version;
+   key.forced_language_version = state->forced_language_version;
+   key.es_shader = state->es_shader;
+   key.compat_shader = state->compat_shader;
+   _mesa_glsl_get_extension_flags(state, key.extensions);
+
+   memcpy(&key.Const, &state->Const, sizeof(key.Const));
+
+   key.MaxVertexOutputComponents =
+      ctx->Const.Program[MESA_SHADER_VERTEX].MaxOutputComponents;
+   key.MaxFragmentInputComponents =
+      ctx->Const.Program[MESA_SHADER_FRAGMENT].MaxInputComponents;
+   key.MaxVarying = ctx->Const.MaxVarying;
+   key.NoPrimitiveBoundingBoxOutput = ctx->Const.NoPrimitiveBoundingBoxOutput;
+   key.GLSLTessLevelsAsInputs = ctx->Const.GLSLTessLevelsAsInputs;
+   key.GLSLFragCoordIsSysVal = ctx->Const.GLSLFragCoordIsSysVal;
+   key.GLSLFrontFacingIsSysVal = ctx->Const.GLSLFrontFacingIsSysVal;
+   key.GLSLPointCoordIsSysVal = ctx->Const.GLSLPointCoordIsSysVal;
+   key.PositionAlwaysInvariant =
+      ctx->Const.ShaderCompilerOptions[state->stage].PositionAlwaysInvariant;
+
+   key.EXT_texture_array = ctx->Extensions.EXT_texture_array;
+   key.EXT_texture_buffer_object = ctx->Extensions.EXT_texture_buffer_object;
+   key.EXT_texture_integer = ctx->Extensions.EXT_texture_integer;
+   key.NV_texture_rectangle = ctx->Extensions.NV_texture_rectangle;
+
+   mtx_lock(&builtin_scopes_lock);
+
+   builtin_scope_entry *entry;
+   for (entry = builtin_scopes; entry != NULL; entry = entry->next) {
+      if (memcmp(&entry->key, &key, sizeof(key)) == 0)
+         break;
+   }
+
+   if (entry == NULL) {
+      if (builtin_scopes_mem_ctx == NULL)
+         builtin_scopes_mem_ctx = ralloc_context(NULL);
+
+      entry = ralloc(builtin_scopes_mem_ctx, builtin_scope_entry);
+      entry->key = key;
+      entry->scope = create_builtin_scope(builtin_scopes_mem_ctx, state);
+      entry->next = builtin_scopes;
+      builtin_scopes = entry;
+   }
+
+   mtx_unlock(&builtin_scopes_lock);
+
+   return entry->scope;
+}
+
+void
+_mesa_glsl_release_builtin_scopes(void)
+{
+   mtx_lock(&builtin_scopes_lock);
+   ralloc_free(builtin_scopes_mem_ctx);
+   builtin_scopes_mem_ctx = NULL;
+   builtin_scopes = NULL;
+   mtx_unlock(&builtin_scopes_lock);
 }
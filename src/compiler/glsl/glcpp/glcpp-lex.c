@@ -887,6 +887,20 @@ void glcpp_set_column (int  column_no , yyscan_t yyscanner);
 
 #define YY_NO_INPUT
 
+/* Read the shader a block at a time straight out of the span given to
+ * glcpp_lex_set_source(), rather than first copying all of it into a
+ * buffer of the scanner's own.  The span needn't be NUL-terminated.
+ */
+#define YY_INPUT(buf, result, max_size)					\
+	do {								\
+		size_t remaining = yyextra->source_end - yyextra->source; \
+		if (remaining > (size_t) (max_size))			\
+			remaining = (max_size);				\
+		memcpy((buf), yyextra->source, remaining);		\
+		yyextra->source += remaining;				\
+		(result) = (int) remaining;				\
+	} while (0)
+
 #define YY_USER_ACTION							\
 	do {								\
 		if (parser->has_new_line_number)			\
@@ -1012,8 +1026,8 @@ glcpp_lex_update_state_per_token (glcpp_parser_t *parser, int token)
 }
 
 
-#line 1015 "glcpp-lex.c"
-#line 178 "glcpp-lex.l"
+#line 1029 "glcpp-lex.c"
+#line 192 "glcpp-lex.l"
 	/* Note: When adding any start conditions to this list, you must also
 	 * update the "Internal compiler error" catch-all rule near the end of
 	 * this file. */
@@ -1024,7 +1038,7 @@ match longer strings take priority over those matching shorter
 strings, we have to be careful to avoid OTHER matching and hiding
 something that CPP does care about. So we simply exclude all
 characters that appear in any other expressions. */
-#line 1027 "glcpp-lex.c"
+#line 1041 "glcpp-lex.c"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1318,7 +1332,7 @@ YY_DECL
 		}
 
 	{
-#line 208 "glcpp-lex.l"
+#line 222 "glcpp-lex.l"
 
 
 	glcpp_parser_t *parser = yyextra;
@@ -1379,7 +1393,7 @@ YY_DECL
 	}
 
 	/* Single-line comments */
-#line 1382 "glcpp-lex.c"
+#line 1396 "glcpp-lex.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1434,41 +1448,41 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 268 "glcpp-lex.l"
+#line 282 "glcpp-lex.l"
 {
 }
 	YY_BREAK
 /* Multi-line comments */
 case 2:
 YY_RULE_SETUP
-#line 272 "glcpp-lex.l"
+#line 286 "glcpp-lex.l"
 { yy_push_state(COMMENT, yyscanner); }
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 273 "glcpp-lex.l"
+#line 287 "glcpp-lex.l"
 
 	YY_BREAK
 case 4:
 /* rule 4 can match eol */
 YY_RULE_SETUP
-#line 274 "glcpp-lex.l"
+#line 288 "glcpp-lex.l"
 { yylineno++; yycolumn = 0; parser->commented_newlines++; }
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 275 "glcpp-lex.l"
+#line 289 "glcpp-lex.l"
 
 	YY_BREAK
 case 6:
 /* rule 6 can match eol */
 YY_RULE_SETUP
-#line 276 "glcpp-lex.l"
+#line 290 "glcpp-lex.l"
 { yylineno++; yycolumn = 0; parser->commented_newlines++; }
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 277 "glcpp-lex.l"
+#line 291 "glcpp-lex.l"
 {
 	yy_pop_state(yyscanner);
 	/* In the <HASH> start condition, we don't want any SPACE token. */
@@ -1478,7 +1492,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 284 "glcpp-lex.l"
+#line 298 "glcpp-lex.l"
 {
 
 	/* If the '#' is the first non-whitespace, non-comment token on this
@@ -1497,7 +1511,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 300 "glcpp-lex.l"
+#line 314 "glcpp-lex.l"
 {
 	BEGIN INITIAL;
 	yyextra->space_tokens = 0;
@@ -1520,7 +1534,7 @@ YY_LINENO_REWIND_TO(yy_cp - 1);
 yyg->yy_c_buf_p = yy_cp -= 1;
 YY_DO_BEFORE_ACTION; /* set up yytext again */
 YY_RULE_SETUP
-#line 315 "glcpp-lex.l"
+#line 329 "glcpp-lex.l"
 {
 	BEGIN INITIAL;
 }
@@ -1529,7 +1543,7 @@ YY_RULE_SETUP
 	 * Simply pass them through to the main compiler's lexer/parser. */
 case 11:
 YY_RULE_SETUP
-#line 321 "glcpp-lex.l"
+#line 335 "glcpp-lex.l"
 {
 	BEGIN INITIAL;
 	RETURN_STRING_TOKEN (PRAGMA);
@@ -1537,7 +1551,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 326 "glcpp-lex.l"
+#line 340 "glcpp-lex.l"
 {
 	BEGIN INITIAL;
 	RETURN_STRING_TOKEN (INCLUDE);
@@ -1545,7 +1559,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 331 "glcpp-lex.l"
+#line 345 "glcpp-lex.l"
 {
 	BEGIN INITIAL;
 	RETURN_TOKEN (LINE);
@@ -1554,7 +1568,7 @@ YY_RULE_SETUP
 case 14:
 /* rule 14 can match eol */
 YY_RULE_SETUP
-#line 336 "glcpp-lex.l"
+#line 350 "glcpp-lex.l"
 {
 	BEGIN INITIAL;
 	yyextra->space_tokens = 0;
@@ -1567,7 +1581,7 @@ YY_RULE_SETUP
 	 * even when we are otherwise skipping. */
 case 15:
 YY_RULE_SETUP
-#line 346 "glcpp-lex.l"
+#line 360 "glcpp-lex.l"
 {
 	if (!yyextra->in_define) {
 		BEGIN INITIAL;
@@ -1579,7 +1593,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 355 "glcpp-lex.l"
+#line 369 "glcpp-lex.l"
 {
 	if (!yyextra->in_define) {
 		BEGIN INITIAL;
@@ -1596,7 +1610,7 @@ YY_LINENO_REWIND_TO(yy_bp + 2);
 yyg->yy_c_buf_p = yy_cp = yy_bp + 2;
 YY_DO_BEFORE_ACTION; /* set up yytext again */
 YY_RULE_SETUP
-#line 364 "glcpp-lex.l"
+#line 378 "glcpp-lex.l"
 {
 	if (!yyextra->in_define) {
 		BEGIN INITIAL;
@@ -1613,7 +1627,7 @@ YY_LINENO_REWIND_TO(yy_bp + 4);
 yyg->yy_c_buf_p = yy_cp = yy_bp + 4;
 YY_DO_BEFORE_ACTION; /* set up yytext again */
 YY_RULE_SETUP
-#line 373 "glcpp-lex.l"
+#line 387 "glcpp-lex.l"
 {
 	if (!yyextra->in_define) {
 		BEGIN INITIAL;
@@ -1625,7 +1639,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 382 "glcpp-lex.l"
+#line 396 "glcpp-lex.l"
 {
 	if (!yyextra->in_define) {
 		BEGIN INITIAL;
@@ -1636,7 +1650,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 390 "glcpp-lex.l"
+#line 404 "glcpp-lex.l"
 {
 	if (!yyextra->in_define) {
 		BEGIN INITIAL;
@@ -1647,7 +1661,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 398 "glcpp-lex.l"
+#line 412 "glcpp-lex.l"
 {
 	BEGIN INITIAL;
 	RETURN_STRING_TOKEN (ERROR_TOKEN);
@@ -1673,7 +1687,7 @@ YY_RULE_SETUP
 	 */
 case 22:
 YY_RULE_SETUP
-#line 421 "glcpp-lex.l"
+#line 435 "glcpp-lex.l"
 {
 	yyextra->in_define = true;
 	if (!parser->skipping) {
@@ -1685,7 +1699,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 430 "glcpp-lex.l"
+#line 444 "glcpp-lex.l"
 {
 	BEGIN INITIAL;
 	yyextra->space_tokens = 0;
@@ -1694,7 +1708,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 436 "glcpp-lex.l"
+#line 450 "glcpp-lex.l"
 {
 	/* Nothing to do here. Importantly, don't leave the <HASH>
 	 * start condition, since it's legal to have space between the
@@ -1704,7 +1718,7 @@ YY_RULE_SETUP
 /* This will catch any non-directive garbage after a HASH */
 case 25:
 YY_RULE_SETUP
-#line 443 "glcpp-lex.l"
+#line 457 "glcpp-lex.l"
 {
 	if (!parser->skipping) {
 		BEGIN INITIAL;
@@ -1718,7 +1732,7 @@ case 26:
 yyg->yy_c_buf_p = yy_cp -= 1;
 YY_DO_BEFORE_ACTION; /* set up yytext again */
 YY_RULE_SETUP
-#line 451 "glcpp-lex.l"
+#line 465 "glcpp-lex.l"
 {
 	BEGIN INITIAL;
 	RETURN_STRING_TOKEN (FUNC_IDENTIFIER);
@@ -1727,7 +1741,7 @@ YY_RULE_SETUP
 /* An identifier not immediately followed by '(' */
 case 27:
 YY_RULE_SETUP
-#line 457 "glcpp-lex.l"
+#line 471 "glcpp-lex.l"
 {
 	BEGIN INITIAL;
 	RETURN_STRING_TOKEN (OBJ_IDENTIFIER);
@@ -1736,7 +1750,7 @@ YY_RULE_SETUP
 /* Whitespace */
 case 28:
 YY_RULE_SETUP
-#line 463 "glcpp-lex.l"
+#line 477 "glcpp-lex.l"
 {
 	/* Just ignore it. Nothing to do here. */
 }
@@ -1745,7 +1759,7 @@ YY_RULE_SETUP
 case 29:
 /* rule 29 can match eol */
 YY_RULE_SETUP
-#line 468 "glcpp-lex.l"
+#line 482 "glcpp-lex.l"
 {
 	BEGIN INITIAL;
 	glcpp_error(yylloc, yyextra, "#define followed by a non-identifier: %s", yytext);
@@ -1756,7 +1770,7 @@ YY_RULE_SETUP
 	 * space. This is an error. */
 case 30:
 YY_RULE_SETUP
-#line 476 "glcpp-lex.l"
+#line 490 "glcpp-lex.l"
 {
 	BEGIN INITIAL;
 	glcpp_error(yylloc, yyextra, "#define followed by a non-identifier: %s", yytext);
@@ -1765,98 +1779,98 @@ YY_RULE_SETUP
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 482 "glcpp-lex.l"
+#line 496 "glcpp-lex.l"
 {
 	RETURN_STRING_TOKEN (INTEGER_STRING);
 }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 486 "glcpp-lex.l"
+#line 500 "glcpp-lex.l"
 {
 	RETURN_STRING_TOKEN (INTEGER_STRING);
 }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-#line 490 "glcpp-lex.l"
+#line 504 "glcpp-lex.l"
 {
 	RETURN_STRING_TOKEN (INTEGER_STRING);
 }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-#line 494 "glcpp-lex.l"
+#line 508 "glcpp-lex.l"
 {
 	RETURN_TOKEN (LEFT_SHIFT);
 }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-#line 498 "glcpp-lex.l"
+#line 512 "glcpp-lex.l"
 {
 	RETURN_TOKEN (RIGHT_SHIFT);
 }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-#line 502 "glcpp-lex.l"
+#line 516 "glcpp-lex.l"
 {
 	RETURN_TOKEN (LESS_OR_EQUAL);
 }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
-#line 506 "glcpp-lex.l"
+#line 520 "glcpp-lex.l"
 {
 	RETURN_TOKEN (GREATER_OR_EQUAL);
 }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
-#line 510 "glcpp-lex.l"
+#line 524 "glcpp-lex.l"
 {
 	RETURN_TOKEN (EQUAL);
 }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-#line 514 "glcpp-lex.l"
+#line 528 "glcpp-lex.l"
 {
 	RETURN_TOKEN (NOT_EQUAL);
 }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
-#line 518 "glcpp-lex.l"
+#line 532 "glcpp-lex.l"
 {
 	RETURN_TOKEN (AND);
 }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-#line 522 "glcpp-lex.l"
+#line 536 "glcpp-lex.l"
 {
 	RETURN_TOKEN (OR);
 }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 526 "glcpp-lex.l"
+#line 540 "glcpp-lex.l"
 {
 	RETURN_TOKEN (PLUS_PLUS);
 }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
-#line 530 "glcpp-lex.l"
+#line 544 "glcpp-lex.l"
 {
 	RETURN_TOKEN (MINUS_MINUS);
 }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-#line 534 "glcpp-lex.l"
+#line 548 "glcpp-lex.l"
 {
 	if (! parser->skipping) {
 		if (parser->is_gles)
@@ -1867,42 +1881,42 @@ YY_RULE_SETUP
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-#line 542 "glcpp-lex.l"
+#line 556 "glcpp-lex.l"
 {
 	RETURN_TOKEN (DEFINED);
 }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 546 "glcpp-lex.l"
+#line 560 "glcpp-lex.l"
 {
 	RETURN_STRING_TOKEN (IDENTIFIER);
 }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
-#line 550 "glcpp-lex.l"
+#line 564 "glcpp-lex.l"
 {
 	RETURN_STRING_TOKEN (OTHER);
 }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 554 "glcpp-lex.l"
+#line 568 "glcpp-lex.l"
 {
 	RETURN_TOKEN (yytext[0]);
 }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 558 "glcpp-lex.l"
+#line 572 "glcpp-lex.l"
 {
 	RETURN_STRING_TOKEN (OTHER);
 }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
-#line 562 "glcpp-lex.l"
+#line 576 "glcpp-lex.l"
 {
 	if (yyextra->space_tokens) {
 		RETURN_TOKEN (SPACE);
@@ -1911,7 +1925,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
-#line 568 "glcpp-lex.l"
+#line 582 "glcpp-lex.l"
 {
 	RETURN_STRING_TOKEN (PATH);
 }
@@ -1921,7 +1935,7 @@ YY_RULE_SETUP
 case 52:
 /* rule 52 can match eol */
 YY_RULE_SETUP
-#line 574 "glcpp-lex.l"
+#line 588 "glcpp-lex.l"
 {
 	if (parser->commented_newlines) {
 		BEGIN NEWLINE_CATCHUP;
@@ -1940,7 +1954,7 @@ case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(COMMENT):
 case YY_STATE_EOF(DEFINE):
 case YY_STATE_EOF(HASH):
-#line 588 "glcpp-lex.l"
+#line 602 "glcpp-lex.l"
 {
 	if (YY_START == COMMENT)
 		glcpp_error(yylloc, yyextra, "Unterminated comment");
@@ -1957,7 +1971,7 @@ case YY_STATE_EOF(HASH):
 	 * of the preceding patterns to match that input. */
 case 53:
 YY_RULE_SETUP
-#line 603 "glcpp-lex.l"
+#line 617 "glcpp-lex.l"
 {
 	glcpp_error(yylloc, yyextra, "Internal compiler error: Unexpected character: %s", yytext);
 
@@ -1973,10 +1987,10 @@ YY_RULE_SETUP
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
-#line 616 "glcpp-lex.l"
+#line 630 "glcpp-lex.l"
 YY_FATAL_ERROR( "flex scanner jammed" );
 	YY_BREAK
-#line 1979 "glcpp-lex.c"
+#line 1993 "glcpp-lex.c"
 case YY_STATE_EOF(DONE):
 case YY_STATE_EOF(NEWLINE_CATCHUP):
 case YY_STATE_EOF(UNREACHABLE):
@@ -3213,12 +3227,16 @@ void yyfree (void * ptr , yyscan_t yyscanner)
 
 #define YYTABLES_NAME "yytables"
 
-#line 616 "glcpp-lex.l"
+#line 630 "glcpp-lex.l"
 
 
 void
-glcpp_lex_set_source_string(glcpp_parser_t *parser, const char *shader)
+glcpp_lex_set_source(glcpp_parser_t *parser, const char *shader,
+		     size_t length)
 {
-	yy_scan_string(shader, parser->scanner);
+	parser->source = shader;
+	parser->source_end = shader + length;
+	yy_switch_to_buffer(yy_create_buffer(NULL, YY_BUF_SIZE, parser->scanner),
+			    parser->scanner);
 }
 
@@ -2077,7 +2077,7 @@ yyreduce:
 			tmp_parser->version = parser->version;
 
 			/* Set the shader source and run the lexer */
-			glcpp_lex_set_source_string(tmp_parser, shader);
+			glcpp_lex_set_source(tmp_parser, shader, strlen(shader));
 
 			/* Copy any existing define macros to the temporary
 			 * shade include parser.
@@ -187,6 +187,8 @@ typedef void (*glcpp_extension_iterator)(
 struct glcpp_parser {
 	void *linalloc;
 	yyscan_t scanner;
+	const char *source;
+	const char *source_end;
 	struct hash_table *defines;
 	active_list_t *active;
 	int lexing_directive;
@@ -261,7 +263,8 @@ int
 glcpp_lex_init_extra (glcpp_parser_t *parser, yyscan_t* scanner);
 
 void
-glcpp_lex_set_source_string(glcpp_parser_t *parser, const char *shader);
+glcpp_lex_set_source(glcpp_parser_t *parser, const char *shader,
+		     size_t length);
 
 int
 glcpp_lex (YYSTYPE *lvalp, YYLTYPE *llocp, yyscan_t scanner);
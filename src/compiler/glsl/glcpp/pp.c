@@ -233,7 +233,7 @@ glcpp_preprocess(void *ralloc_ctx, const char **shader, char **info_log,
 	if (! gl_ctx->Const.DisableGLSLLineContinuations)
 		*shader = remove_line_continuations(parser, *shader);
 
-	glcpp_lex_set_source_string (parser, *shader);
+	glcpp_lex_set_source (parser, *shader, strlen(*shader));
 
 	glcpp_parser_parse (parser);
 
@@ -0,0 +1,664 @@
+/*
+ * Copyright © 2026 xxGLSLCompiler contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file glsl_keywords.cpp
+ *
+ * The keyword table used by the lexer.
+ *
+ * Giving every keyword a rule of its own made the scanner's DFA several
+ * times larger than what the rest of the language needs, since each prefix
+ * of each keyword was a state.  Instead, words are scanned as identifiers
+ * and looked up here with a perfect hash: hashing the word picks a bucket,
+ * and each bucket has a displacement that was chosen so that the keywords
+ * of all buckets land in different slots.  A lookup is then one hash of
+ * the word and one string compare.
+ */
+
+#include <string.h>
+#include "c11/threads.h"
+#include "util/macros.h"
+#include "main/mtypes.h"
+#include "ast.h"
+#include "glsl_keywords.h"
+#include "glsl_parser_extras.h"
+#include "glsl_parser.h"
+
+namespace {
+
+/**
+ * Extensions that make a word a keyword independently of the version.
+ */
+enum glsl_keyword_alt {
+   GLSL_KEYWORD_ALT_NONE,
+   GLSL_KEYWORD_ALT_ALWAYS,
+   GLSL_KEYWORD_ALT_PRE_ES_300,
+   GLSL_KEYWORD_ALT_ATOMIC_COUNTERS,
+   GLSL_KEYWORD_ALT_COMPUTE,
+   GLSL_KEYWORD_ALT_CUBE_MAP_ARRAY,
+   GLSL_KEYWORD_ALT_DEMOTE,
+   GLSL_KEYWORD_ALT_EXTERNAL_IMAGE,
+   GLSL_KEYWORD_ALT_FP64,
+   GLSL_KEYWORD_ALT_GPU_SHADER4,
+   GLSL_KEYWORD_ALT_GPU_SHADER4_ARRAY,
+   GLSL_KEYWORD_ALT_GPU_SHADER4_INTEGER,
+   GLSL_KEYWORD_ALT_GPU_SHADER4_INTEGER_ARRAY,
+   GLSL_KEYWORD_ALT_GPU_SHADER4_INTEGER_RECT,
+   GLSL_KEYWORD_ALT_GPU_SHADER5,
+   GLSL_KEYWORD_ALT_IMAGE_BUFFER,
+   GLSL_KEYWORD_ALT_IMAGE_CUBE_MAP_ARRAY,
+   GLSL_KEYWORD_ALT_IMAGE_LOAD_STORE,
+   GLSL_KEYWORD_ALT_INT64,
+   GLSL_KEYWORD_ALT_INTEGER_TEXTURE_BUFFER,
+   GLSL_KEYWORD_ALT_LAYOUT,
+   GLSL_KEYWORD_ALT_MEMORY_ACCESS_QUALIFIER,
+   GLSL_KEYWORD_ALT_MEMORY_QUALIFIER,
+   GLSL_KEYWORD_ALT_MULTISAMPLE,
+   GLSL_KEYWORD_ALT_MULTISAMPLE_ARRAY,
+   GLSL_KEYWORD_ALT_SAMPLE_INTERPOLATION,
+   GLSL_KEYWORD_ALT_SSBO,
+   GLSL_KEYWORD_ALT_SUBROUTINE,
+   GLSL_KEYWORD_ALT_TESSELLATION,
+   GLSL_KEYWORD_ALT_TEXTURE_BUFFER,
+   GLSL_KEYWORD_ALT_TEXTURE_RECTANGLE,
+   GLSL_KEYWORD_ALT_UBO,
+   GLSL_KEYWORD_ALT_UBO_DESKTOP,
+};
+
+} /* anonymous namespace */
+
+static bool
+keyword_alt_enabled(unsigned alt, const struct _mesa_glsl_parse_state *state)
+{
+   const struct gl_extensions *exts = &state->ctx->Extensions;
+
+   switch (alt) {
+   case GLSL_KEYWORD_ALT_NONE:
+      return false;
+   case GLSL_KEYWORD_ALT_ALWAYS:
+      return true;
+   case GLSL_KEYWORD_ALT_PRE_ES_300:
+      return !state->is_version(0, 300);
+   case GLSL_KEYWORD_ALT_ATOMIC_COUNTERS:
+      return state->ARB_shader_atomic_counters_enable;
+   case GLSL_KEYWORD_ALT_COMPUTE:
+      return state->ARB_compute_shader_enable;
+   case GLSL_KEYWORD_ALT_CUBE_MAP_ARRAY:
+      return state->ARB_texture_cube_map_array_enable ||
+             state->OES_texture_cube_map_array_enable ||
+             state->EXT_texture_cube_map_array_enable;
+   case GLSL_KEYWORD_ALT_DEMOTE:
+      return state->EXT_demote_to_helper_invocation_enable;
+   case GLSL_KEYWORD_ALT_EXTERNAL_IMAGE:
+      return state->OES_EGL_image_external_enable ||
+             state->OES_EGL_image_external_essl3_enable;
+   case GLSL_KEYWORD_ALT_FP64:
+      return state->ARB_gpu_shader_fp64_enable;
+   case GLSL_KEYWORD_ALT_GPU_SHADER4:
+      return state->EXT_gpu_shader4_enable;
+   case GLSL_KEYWORD_ALT_GPU_SHADER4_ARRAY:
+      return state->EXT_gpu_shader4_enable && exts->EXT_texture_array;
+   case GLSL_KEYWORD_ALT_GPU_SHADER4_INTEGER:
+      return state->EXT_gpu_shader4_enable && exts->EXT_texture_integer;
+   case GLSL_KEYWORD_ALT_GPU_SHADER4_INTEGER_ARRAY:
+      return state->EXT_gpu_shader4_enable && exts->EXT_texture_integer &&
+             exts->EXT_texture_array;
+   case GLSL_KEYWORD_ALT_GPU_SHADER4_INTEGER_RECT:
+      return state->EXT_gpu_shader4_enable && exts->NV_texture_rectangle &&
+             exts->EXT_texture_integer;
+   case GLSL_KEYWORD_ALT_GPU_SHADER5:
+      return state->ARB_gpu_shader5_enable ||
+             state->EXT_gpu_shader5_enable ||
+             state->OES_gpu_shader5_enable;
+   case GLSL_KEYWORD_ALT_IMAGE_BUFFER:
+      return state->ARB_shader_image_load_store_enable ||
+             state->EXT_shader_image_load_store_enable ||
+             state->EXT_texture_buffer_enable ||
+             state->OES_texture_buffer_enable;
+   case GLSL_KEYWORD_ALT_IMAGE_CUBE_MAP_ARRAY:
+      return state->ARB_shader_image_load_store_enable ||
+             state->EXT_shader_image_load_store_enable ||
+             state->OES_texture_cube_map_array_enable ||
+             state->EXT_texture_cube_map_array_enable;
+   case GLSL_KEYWORD_ALT_IMAGE_LOAD_STORE:
+      return state->ARB_shader_image_load_store_enable ||
+             state->EXT_shader_image_load_store_enable;
+   case GLSL_KEYWORD_ALT_INT64:
+      return state->ARB_gpu_shader_int64_enable ||
+             state->AMD_gpu_shader_int64_enable;
+   case GLSL_KEYWORD_ALT_INTEGER_TEXTURE_BUFFER:
+      return state->EXT_texture_buffer_enable ||
+             state->OES_texture_buffer_enable ||
+             (state->EXT_gpu_shader4_enable &&
+              exts->EXT_texture_buffer_object && exts->EXT_texture_integer);
+   case GLSL_KEYWORD_ALT_LAYOUT:
+      return state->ARB_bindless_texture_enable ||
+             state->KHR_blend_equation_advanced_enable ||
+             state->AMD_conservative_depth_enable ||
+             state->ARB_conservative_depth_enable ||
+             state->ARB_explicit_attrib_location_enable ||
+             state->ARB_explicit_uniform_location_enable ||
+             state->ARB_post_depth_coverage_enable ||
+             state->has_separate_shader_objects() ||
+             state->ARB_uniform_buffer_object_enable ||
+             state->ARB_fragment_coord_conventions_enable ||
+             state->ARB_shading_language_420pack_enable ||
+             state->ARB_compute_shader_enable ||
+             state->ARB_tessellation_shader_enable ||
+             state->EXT_shader_framebuffer_fetch_non_coherent_enable;
+   case GLSL_KEYWORD_ALT_MEMORY_ACCESS_QUALIFIER:
+      return state->ARB_shader_image_load_store_enable ||
+             state->ARB_shader_storage_buffer_object_enable;
+   case GLSL_KEYWORD_ALT_MEMORY_QUALIFIER:
+      return state->ARB_shader_image_load_store_enable ||
+             state->EXT_shader_image_load_store_enable ||
+             state->ARB_shader_storage_buffer_object_enable;
+   case GLSL_KEYWORD_ALT_MULTISAMPLE:
+      return state->ARB_texture_multisample_enable;
+   case GLSL_KEYWORD_ALT_MULTISAMPLE_ARRAY:
+      return state->ARB_texture_multisample_enable ||
+             state->OES_texture_storage_multisample_2d_array_enable;
+   case GLSL_KEYWORD_ALT_SAMPLE_INTERPOLATION:
+      return state->ARB_gpu_shader5_enable ||
+             state->OES_shader_multisample_interpolation_enable;
+   case GLSL_KEYWORD_ALT_SSBO:
+      return state->ARB_shader_storage_buffer_object_enable;
+   case GLSL_KEYWORD_ALT_SUBROUTINE:
+      return state->ARB_shader_subroutine_enable;
+   case GLSL_KEYWORD_ALT_TESSELLATION:
+      return state->has_tessellation_shader();
+   case GLSL_KEYWORD_ALT_TEXTURE_BUFFER:
+      return state->EXT_texture_buffer_enable ||
+             state->OES_texture_buffer_enable ||
+             (state->EXT_gpu_shader4_enable &&
+              exts->EXT_texture_buffer_object);
+   case GLSL_KEYWORD_ALT_TEXTURE_RECTANGLE:
+      return state->ARB_texture_rectangle_enable;
+   case GLSL_KEYWORD_ALT_UBO:
+      return state->ARB_uniform_buffer_object_enable;
+   case GLSL_KEYWORD_ALT_UBO_DESKTOP:
+      return state->ARB_uniform_buffer_object_enable && !state->es_shader;
+   default:
+      unreachable("invalid keyword alternative");
+   }
+}
+
+/* The entries mirror the lexer macros that the rules of each word used to
+ * expand to.  A word is a keyword when the shader's version is at least
+ * allowed_glsl (or allowed_glsl_es), or when the alternative expression is
+ * true; otherwise it is an error to use if the version is at least
+ * reserved_glsl (or reserved_glsl_es), and an identifier if not.
+ */
+#define KEYWORD_WITH_ALT(name, reserved_glsl, reserved_glsl_es,		\
+                         allowed_glsl, allowed_glsl_es, alt, token)	\
+   { name, sizeof(name) - 1, GLSL_KEYWORD_TOKEN,			\
+     reserved_glsl, reserved_glsl_es, allowed_glsl, allowed_glsl_es,	\
+     GLSL_KEYWORD_ALT_##alt, token, NULL, 0 }
+
+#define KEYWORD(name, reserved_glsl, reserved_glsl_es,			\
+                allowed_glsl, allowed_glsl_es, token)			\
+   KEYWORD_WITH_ALT(name, reserved_glsl, reserved_glsl_es,		\
+                    allowed_glsl, allowed_glsl_es, NONE, token)
+
+#define KEYWORD_ALWAYS(name, token)					\
+   KEYWORD_WITH_ALT(name, 0, 0, 0, 0, ALWAYS, token)
+
+/** Keywords since GLSL's origin, that are reserved words in GLSL ES 3.00. */
+#define DEPRECATED_ES_KEYWORD(name, token)				\
+   KEYWORD_WITH_ALT(name, 0, 300, 0, 0, PRE_ES_300, token)
+
+#define TYPE_WITH_ALT(name, reserved_glsl, reserved_glsl_es,		\
+                      allowed_glsl, allowed_glsl_es, alt, gtype)	\
+   { name, sizeof(name) - 1, GLSL_KEYWORD_TYPE,				\
+     reserved_glsl, reserved_glsl_es, allowed_glsl, allowed_glsl_es,	\
+     GLSL_KEYWORD_ALT_##alt, BASIC_TYPE_TOK, &glsl_type::gtype##_type, 0 }
+
+#define TYPE(name, reserved_glsl, reserved_glsl_es,			\
+             allowed_glsl, allowed_glsl_es, gtype)			\
+   TYPE_WITH_ALT(name, reserved_glsl, reserved_glsl_es,			\
+                 allowed_glsl, allowed_glsl_es, NONE, gtype)
+
+#define TYPE_ALWAYS(name, gtype)					\
+   TYPE_WITH_ALT(name, 0, 0, 0, 0, ALWAYS, gtype)
+
+#define DEPRECATED_ES_TYPE(name, gtype)					\
+   TYPE_WITH_ALT(name, 0, 300, 0, 0, PRE_ES_300, gtype)
+
+#define BOOL(name, value)						\
+   { name, sizeof(name) - 1, GLSL_KEYWORD_BOOL, 0, 0, 0, 0,		\
+     GLSL_KEYWORD_ALT_ALWAYS, BOOLCONSTANT, NULL, value }
+
+static const struct glsl_keyword keywords[] = {
+   DEPRECATED_ES_KEYWORD("attribute", ATTRIBUTE),
+   KEYWORD_ALWAYS("const", CONST_TOK),
+   TYPE_ALWAYS("bool", bool),
+   TYPE_ALWAYS("float", float),
+   TYPE_ALWAYS("int", int),
+   TYPE("uint", 130, 300, 130, 300, uint),
+
+   KEYWORD_ALWAYS("break", BREAK),
+   KEYWORD_ALWAYS("continue", CONTINUE),
+   KEYWORD_ALWAYS("do", DO),
+   KEYWORD_ALWAYS("while", WHILE),
+   KEYWORD_ALWAYS("else", ELSE),
+   KEYWORD_ALWAYS("for", FOR),
+   KEYWORD_ALWAYS("if", IF),
+   KEYWORD_ALWAYS("discard", DISCARD),
+   KEYWORD_ALWAYS("return", RETURN),
+   KEYWORD_WITH_ALT("demote", 0, 0, 0, 0, DEMOTE, DEMOTE),
+
+   TYPE_ALWAYS("bvec2", bvec2),
+   TYPE_ALWAYS("bvec3", bvec3),
+   TYPE_ALWAYS("bvec4", bvec4),
+   TYPE_ALWAYS("ivec2", ivec2),
+   TYPE_ALWAYS("ivec3", ivec3),
+   TYPE_ALWAYS("ivec4", ivec4),
+   TYPE_WITH_ALT("uvec2", 130, 300, 130, 300, GPU_SHADER4, uvec2),
+   TYPE_WITH_ALT("uvec3", 130, 300, 130, 300, GPU_SHADER4, uvec3),
+   TYPE_WITH_ALT("uvec4", 130, 300, 130, 300, GPU_SHADER4, uvec4),
+   TYPE_ALWAYS("vec2", vec2),
+   TYPE_ALWAYS("vec3", vec3),
+   TYPE_ALWAYS("vec4", vec4),
+   TYPE_ALWAYS("mat2", mat2),
+   TYPE_ALWAYS("mat3", mat3),
+   TYPE_ALWAYS("mat4", mat4),
+   TYPE("mat2x2", 120, 300, 120, 300, mat2),
+   TYPE("mat2x3", 120, 300, 120, 300, mat2x3),
+   TYPE("mat2x4", 120, 300, 120, 300, mat2x4),
+   TYPE("mat3x2", 120, 300, 120, 300, mat3x2),
+   TYPE("mat3x3", 120, 300, 120, 300, mat3),
+   TYPE("mat3x4", 120, 300, 120, 300, mat3x4),
+   TYPE("mat4x2", 120, 300, 120, 300, mat4x2),
+   TYPE("mat4x3", 120, 300, 120, 300, mat4x3),
+   TYPE("mat4x4", 120, 300, 120, 300, mat4),
+
+   KEYWORD_ALWAYS("in", IN_TOK),
+   KEYWORD_ALWAYS("out", OUT_TOK),
+   KEYWORD_ALWAYS("inout", INOUT_TOK),
+   KEYWORD_ALWAYS("uniform", UNIFORM),
+   KEYWORD_WITH_ALT("buffer", 0, 0, 430, 310, SSBO, BUFFER),
+   DEPRECATED_ES_KEYWORD("varying", VARYING),
+   KEYWORD_WITH_ALT("centroid", 120, 300, 120, 300, GPU_SHADER4, CENTROID),
+   KEYWORD("invariant", 120, 100, 120, 100, INVARIANT),
+   KEYWORD_WITH_ALT("flat", 130, 100, 130, 300, GPU_SHADER4, FLAT),
+   KEYWORD("smooth", 130, 300, 130, 300, SMOOTH),
+   KEYWORD_WITH_ALT("noperspective", 130, 300, 130, 0, GPU_SHADER4, NOPERSPECTIVE),
+   KEYWORD_WITH_ALT("patch", 0, 300, 400, 320, TESSELLATION, PATCH),
+
+   DEPRECATED_ES_TYPE("sampler1D", sampler1D),
+   TYPE_ALWAYS("sampler2D", sampler2D),
+   TYPE_ALWAYS("sampler3D", sampler3D),
+   TYPE_ALWAYS("samplerCube", samplerCube),
+   TYPE_WITH_ALT("sampler1DArray", 130, 300, 130, 0, GPU_SHADER4_ARRAY, sampler1DArray),
+   TYPE_WITH_ALT("sampler2DArray", 130, 300, 130, 300, GPU_SHADER4_ARRAY, sampler2DArray),
+   DEPRECATED_ES_TYPE("sampler1DShadow", sampler1DShadow),
+   TYPE_ALWAYS("sampler2DShadow", sampler2DShadow),
+   TYPE_WITH_ALT("samplerCubeShadow", 130, 300, 130, 300, GPU_SHADER4, samplerCubeShadow),
+   TYPE_WITH_ALT("sampler1DArrayShadow", 130, 300, 130, 0, GPU_SHADER4_ARRAY, sampler1DArrayShadow),
+   TYPE_WITH_ALT("sampler2DArrayShadow", 130, 300, 130, 300, GPU_SHADER4_ARRAY, sampler2DArrayShadow),
+   TYPE_WITH_ALT("isampler1D", 130, 300, 130, 0, GPU_SHADER4_INTEGER, isampler1D),
+   TYPE_WITH_ALT("isampler2D", 130, 300, 130, 300, GPU_SHADER4_INTEGER, isampler2D),
+   TYPE_WITH_ALT("isampler3D", 130, 300, 130, 300, GPU_SHADER4_INTEGER, isampler3D),
+   TYPE_WITH_ALT("isamplerCube", 130, 300, 130, 300, GPU_SHADER4_INTEGER, isamplerCube),
+   TYPE_WITH_ALT("isampler1DArray", 130, 300, 130, 0, GPU_SHADER4_INTEGER_ARRAY, isampler1DArray),
+   TYPE_WITH_ALT("isampler2DArray", 130, 300, 130, 300, GPU_SHADER4_INTEGER_ARRAY, isampler2DArray),
+   TYPE_WITH_ALT("usampler1D", 130, 300, 130, 0, GPU_SHADER4_INTEGER, usampler1D),
+   TYPE_WITH_ALT("usampler2D", 130, 300, 130, 300, GPU_SHADER4_INTEGER, usampler2D),
+   TYPE_WITH_ALT("usampler3D", 130, 300, 130, 300, GPU_SHADER4_INTEGER, usampler3D),
+   TYPE_WITH_ALT("usamplerCube", 130, 300, 130, 300, GPU_SHADER4_INTEGER, usamplerCube),
+   TYPE_WITH_ALT("usampler1DArray", 130, 300, 130, 0, GPU_SHADER4_INTEGER_ARRAY, usampler1DArray),
+   TYPE_WITH_ALT("usampler2DArray", 130, 300, 130, 300, GPU_SHADER4_INTEGER_ARRAY, usampler2DArray),
+
+   /* additional keywords in ARB_texture_multisample, included in GLSL 1.50 */
+   /* these are reserved but not defined in GLSL 3.00 */
+   /* [iu]sampler2DMS are defined in GLSL ES 3.10 */
+   TYPE_WITH_ALT("sampler2DMS", 150, 300, 150, 310, MULTISAMPLE, sampler2DMS),
+   TYPE_WITH_ALT("isampler2DMS", 150, 300, 150, 310, MULTISAMPLE, isampler2DMS),
+   TYPE_WITH_ALT("usampler2DMS", 150, 300, 150, 310, MULTISAMPLE, usampler2DMS),
+   TYPE_WITH_ALT("sampler2DMSArray", 150, 300, 150, 320, MULTISAMPLE_ARRAY, sampler2DMSArray),
+   TYPE_WITH_ALT("isampler2DMSArray", 150, 300, 150, 320, MULTISAMPLE_ARRAY, isampler2DMSArray),
+   TYPE_WITH_ALT("usampler2DMSArray", 150, 300, 150, 320, MULTISAMPLE_ARRAY, usampler2DMSArray),
+
+   /* keywords available with ARB_texture_cube_map_array_enable extension on desktop GLSL */
+   TYPE_WITH_ALT("samplerCubeArray", 400, 310, 400, 320, CUBE_MAP_ARRAY, samplerCubeArray),
+   TYPE_WITH_ALT("isamplerCubeArray", 400, 310, 400, 320, CUBE_MAP_ARRAY, isamplerCubeArray),
+   TYPE_WITH_ALT("usamplerCubeArray", 400, 310, 400, 320, CUBE_MAP_ARRAY, usamplerCubeArray),
+   TYPE_WITH_ALT("samplerCubeArrayShadow", 400, 310, 400, 320, CUBE_MAP_ARRAY, samplerCubeArrayShadow),
+
+   TYPE_WITH_ALT("samplerExternalOES", 0, 0, 0, 0, EXTERNAL_IMAGE, samplerExternalOES),
+
+   /* keywords available with ARB_gpu_shader5 */
+   KEYWORD_WITH_ALT("precise", 400, 310, 400, 320, GPU_SHADER5, PRECISE),
+
+   /* keywords available with ARB_shader_image_load_store */
+   TYPE_WITH_ALT("image1D", 130, 300, 420, 0, IMAGE_LOAD_STORE, image1D),
+   TYPE_WITH_ALT("image2D", 130, 300, 420, 310, IMAGE_LOAD_STORE, image2D),
+   TYPE_WITH_ALT("image3D", 130, 300, 420, 310, IMAGE_LOAD_STORE, image3D),
+   TYPE_WITH_ALT("image2DRect", 130, 300, 420, 0, IMAGE_LOAD_STORE, image2DRect),
+   TYPE_WITH_ALT("imageCube", 130, 300, 420, 310, IMAGE_LOAD_STORE, imageCube),
+   TYPE_WITH_ALT("imageBuffer", 130, 300, 420, 320, IMAGE_BUFFER, imageBuffer),
+   TYPE_WITH_ALT("image1DArray", 130, 300, 420, 0, IMAGE_LOAD_STORE, image1DArray),
+   TYPE_WITH_ALT("image2DArray", 130, 300, 420, 310, IMAGE_LOAD_STORE, image2DArray),
+   TYPE_WITH_ALT("imageCubeArray", 130, 300, 420, 320, IMAGE_CUBE_MAP_ARRAY, imageCubeArray),
+   TYPE_WITH_ALT("image2DMS", 130, 300, 420, 0, IMAGE_LOAD_STORE, image2DMS),
+   TYPE_WITH_ALT("image2DMSArray", 130, 300, 420, 0, IMAGE_LOAD_STORE, image2DMSArray),
+   TYPE_WITH_ALT("iimage1D", 130, 300, 420, 0, IMAGE_LOAD_STORE, iimage1D),
+   TYPE_WITH_ALT("iimage2D", 130, 300, 420, 310, IMAGE_LOAD_STORE, iimage2D),
+   TYPE_WITH_ALT("iimage3D", 130, 300, 420, 310, IMAGE_LOAD_STORE, iimage3D),
+   TYPE_WITH_ALT("iimage2DRect", 130, 300, 420, 0, IMAGE_LOAD_STORE, iimage2DRect),
+   TYPE_WITH_ALT("iimageCube", 130, 300, 420, 310, IMAGE_LOAD_STORE, iimageCube),
+   TYPE_WITH_ALT("iimageBuffer", 130, 300, 420, 320, IMAGE_BUFFER, iimageBuffer),
+   TYPE_WITH_ALT("iimage1DArray", 130, 300, 420, 0, IMAGE_LOAD_STORE, iimage1DArray),
+   TYPE_WITH_ALT("iimage2DArray", 130, 300, 420, 310, IMAGE_LOAD_STORE, iimage2DArray),
+   TYPE_WITH_ALT("iimageCubeArray", 130, 300, 420, 320, IMAGE_CUBE_MAP_ARRAY, iimageCubeArray),
+   TYPE_WITH_ALT("iimage2DMS", 130, 300, 420, 0, IMAGE_LOAD_STORE, iimage2DMS),
+   TYPE_WITH_ALT("iimage2DMSArray", 130, 300, 420, 0, IMAGE_LOAD_STORE, iimage2DMSArray),
+   TYPE_WITH_ALT("uimage1D", 130, 300, 420, 0, IMAGE_LOAD_STORE, uimage1D),
+   TYPE_WITH_ALT("uimage2D", 130, 300, 420, 310, IMAGE_LOAD_STORE, uimage2D),
+   TYPE_WITH_ALT("uimage3D", 130, 300, 420, 310, IMAGE_LOAD_STORE, uimage3D),
+   TYPE_WITH_ALT("uimage2DRect", 130, 300, 420, 0, IMAGE_LOAD_STORE, uimage2DRect),
+   TYPE_WITH_ALT("uimageCube", 130, 300, 420, 310, IMAGE_LOAD_STORE, uimageCube),
+   TYPE_WITH_ALT("uimageBuffer", 130, 300, 420, 320, IMAGE_BUFFER, uimageBuffer),
+   TYPE_WITH_ALT("uimage1DArray", 130, 300, 420, 0, IMAGE_LOAD_STORE, uimage1DArray),
+   TYPE_WITH_ALT("uimage2DArray", 130, 300, 420, 310, IMAGE_LOAD_STORE, uimage2DArray),
+   TYPE_WITH_ALT("uimageCubeArray", 130, 300, 420, 320, IMAGE_CUBE_MAP_ARRAY, uimageCubeArray),
+   TYPE_WITH_ALT("uimage2DMS", 130, 300, 420, 0, IMAGE_LOAD_STORE, uimage2DMS),
+   TYPE_WITH_ALT("uimage2DMSArray", 130, 300, 420, 0, IMAGE_LOAD_STORE, uimage2DMSArray),
+   KEYWORD("image1DShadow", 130, 300, 0, 0, IMAGE1DSHADOW),
+   KEYWORD("image2DShadow", 130, 300, 0, 0, IMAGE2DSHADOW),
+   KEYWORD("image1DArrayShadow", 130, 300, 0, 0, IMAGE1DARRAYSHADOW),
+   KEYWORD("image2DArrayShadow", 130, 300, 0, 0, IMAGE2DARRAYSHADOW),
+
+   KEYWORD_WITH_ALT("coherent", 420, 300, 420, 310, MEMORY_QUALIFIER, COHERENT),
+   KEYWORD_WITH_ALT("volatile", 110, 100, 420, 310, MEMORY_QUALIFIER, VOLATILE),
+   KEYWORD_WITH_ALT("restrict", 420, 300, 420, 310, MEMORY_QUALIFIER, RESTRICT),
+   KEYWORD_WITH_ALT("readonly", 420, 300, 420, 310, MEMORY_ACCESS_QUALIFIER, READONLY),
+   KEYWORD_WITH_ALT("writeonly", 420, 300, 420, 310, MEMORY_ACCESS_QUALIFIER, WRITEONLY),
+
+   TYPE_WITH_ALT("atomic_uint", 420, 300, 420, 310, ATOMIC_COUNTERS, atomic_uint),
+
+   KEYWORD_WITH_ALT("shared", 430, 310, 430, 310, COMPUTE, SHARED),
+
+   KEYWORD_ALWAYS("struct", STRUCT),
+   KEYWORD_ALWAYS("void", VOID_TOK),
+
+   KEYWORD_WITH_ALT("layout", 0, 0, 140, 300, LAYOUT, LAYOUT_TOK),
+
+   BOOL("true", 1),
+   BOOL("false", 0),
+
+   /* Reserved words in GLSL 1.10. */
+   KEYWORD("asm", 110, 100, 0, 0, ASM),
+   KEYWORD("class", 110, 100, 0, 0, CLASS),
+   KEYWORD("union", 110, 100, 0, 0, UNION),
+   KEYWORD("enum", 110, 100, 0, 0, ENUM),
+   KEYWORD("typedef", 110, 100, 0, 0, TYPEDEF),
+   KEYWORD("template", 110, 100, 0, 0, TEMPLATE),
+   KEYWORD("this", 110, 100, 0, 0, THIS),
+   KEYWORD_WITH_ALT("packed", 110, 100, 140, 300, UBO, PACKED_TOK),
+   KEYWORD("goto", 110, 100, 0, 0, GOTO),
+   KEYWORD("switch", 110, 100, 130, 300, SWITCH),
+   KEYWORD("default", 110, 100, 130, 300, DEFAULT),
+   KEYWORD("inline", 110, 100, 0, 0, INLINE_TOK),
+   KEYWORD("noinline", 110, 100, 0, 0, NOINLINE),
+   KEYWORD("public", 110, 100, 0, 0, PUBLIC_TOK),
+   KEYWORD("static", 110, 100, 0, 0, STATIC),
+   KEYWORD("extern", 110, 100, 0, 0, EXTERN),
+   KEYWORD("external", 110, 100, 0, 0, EXTERNAL),
+   KEYWORD("interface", 110, 100, 0, 0, INTERFACE),
+   KEYWORD("long", 110, 100, 0, 0, LONG_TOK),
+   KEYWORD("short", 110, 100, 0, 0, SHORT_TOK),
+   TYPE_WITH_ALT("double", 130, 100, 130, 300, FP64, double),
+   KEYWORD("half", 110, 100, 0, 0, HALF),
+   KEYWORD("fixed", 110, 100, 0, 0, FIXED_TOK),
+   KEYWORD_WITH_ALT("unsigned", 110, 100, 0, 0, GPU_SHADER4, UNSIGNED),
+   KEYWORD("input", 110, 100, 0, 0, INPUT_TOK),
+   KEYWORD("output", 110, 100, 0, 0, OUTPUT),
+   KEYWORD("hvec2", 110, 100, 0, 0, HVEC2),
+   KEYWORD("hvec3", 110, 100, 0, 0, HVEC3),
+   KEYWORD("hvec4", 110, 100, 0, 0, HVEC4),
+   TYPE_WITH_ALT("dvec2", 110, 100, 400, 0, FP64, dvec2),
+   TYPE_WITH_ALT("dvec3", 110, 100, 400, 0, FP64, dvec3),
+   TYPE_WITH_ALT("dvec4", 110, 100, 400, 0, FP64, dvec4),
+   TYPE_WITH_ALT("dmat2", 110, 100, 400, 0, FP64, dmat2),
+   TYPE_WITH_ALT("dmat3", 110, 100, 400, 0, FP64, dmat3),
+   TYPE_WITH_ALT("dmat4", 110, 100, 400, 0, FP64, dmat4),
+   TYPE_WITH_ALT("dmat2x2", 110, 100, 400, 0, FP64, dmat2),
+   TYPE_WITH_ALT("dmat2x3", 110, 100, 400, 0, FP64, dmat2x3),
+   TYPE_WITH_ALT("dmat2x4", 110, 100, 400, 0, FP64, dmat2x4),
+   TYPE_WITH_ALT("dmat3x2", 110, 100, 400, 0, FP64, dmat3x2),
+   TYPE_WITH_ALT("dmat3x3", 110, 100, 400, 0, FP64, dmat3),
+   TYPE_WITH_ALT("dmat3x4", 110, 100, 400, 0, FP64, dmat3x4),
+   TYPE_WITH_ALT("dmat4x2", 110, 100, 400, 0, FP64, dmat4x2),
+   TYPE_WITH_ALT("dmat4x3", 110, 100, 400, 0, FP64, dmat4x3),
+   TYPE_WITH_ALT("dmat4x4", 110, 100, 400, 0, FP64, dmat4),
+   KEYWORD("fvec2", 110, 100, 0, 0, FVEC2),
+   KEYWORD("fvec3", 110, 100, 0, 0, FVEC3),
+   KEYWORD("fvec4", 110, 100, 0, 0, FVEC4),
+   TYPE_WITH_ALT("sampler2DRect", 110, 100, 0, 0, TEXTURE_RECTANGLE, sampler2DRect),
+   KEYWORD("sampler3DRect", 110, 100, 0, 0, SAMPLER3DRECT),
+   TYPE_WITH_ALT("sampler2DRectShadow", 110, 100, 0, 0, TEXTURE_RECTANGLE, sampler2DRectShadow),
+   KEYWORD("sizeof", 110, 100, 0, 0, SIZEOF),
+   KEYWORD("cast", 110, 100, 0, 0, CAST),
+   KEYWORD("namespace", 110, 100, 0, 0, NAMESPACE),
+   KEYWORD("using", 110, 100, 0, 0, USING),
+
+   /* Additional reserved words in GLSL 1.20. */
+   KEYWORD("lowp", 120, 100, 130, 100, LOWP),
+   KEYWORD("mediump", 120, 100, 130, 100, MEDIUMP),
+   KEYWORD("highp", 120, 100, 130, 100, HIGHP),
+   KEYWORD("precision", 120, 100, 130, 100, PRECISION),
+
+   /* Additional reserved words in GLSL 1.30. */
+   KEYWORD("case", 130, 300, 130, 300, CASE),
+   KEYWORD("common", 130, 300, 0, 0, COMMON),
+   KEYWORD("partition", 130, 300, 0, 0, PARTITION),
+   KEYWORD("active", 130, 300, 0, 0, ACTIVE),
+   KEYWORD("superp", 130, 100, 0, 0, SUPERP),
+   TYPE_WITH_ALT("samplerBuffer", 130, 300, 140, 320, TEXTURE_BUFFER, samplerBuffer),
+   KEYWORD("filter", 130, 300, 0, 0, FILTER),
+   KEYWORD_WITH_ALT("row_major", 130, 0, 140, 0, UBO_DESKTOP, ROW_MAJOR),
+
+   /* Additional reserved words in GLSL 1.40 */
+   TYPE_WITH_ALT("isampler2DRect", 140, 300, 140, 0, GPU_SHADER4_INTEGER_RECT, isampler2DRect),
+   TYPE_WITH_ALT("usampler2DRect", 140, 300, 140, 0, GPU_SHADER4_INTEGER_RECT, usampler2DRect),
+   TYPE_WITH_ALT("isamplerBuffer", 140, 300, 140, 320, INTEGER_TEXTURE_BUFFER, isamplerBuffer),
+   TYPE_WITH_ALT("usamplerBuffer", 140, 300, 140, 320, INTEGER_TEXTURE_BUFFER, usamplerBuffer),
+
+   /* Additional reserved words in GLSL ES 3.00 */
+   KEYWORD("resource", 420, 300, 0, 0, RESOURCE),
+   KEYWORD_WITH_ALT("sample", 400, 300, 400, 320, SAMPLE_INTERPOLATION, SAMPLE),
+   KEYWORD_WITH_ALT("subroutine", 400, 300, 400, 0, SUBROUTINE, SUBROUTINE),
+
+   /* Additional words for ARB_gpu_shader_int64 */
+   TYPE_WITH_ALT("int64_t", 0, 0, 0, 0, INT64, int64_t),
+   TYPE_WITH_ALT("i64vec2", 0, 0, 0, 0, INT64, i64vec2),
+   TYPE_WITH_ALT("i64vec3", 0, 0, 0, 0, INT64, i64vec3),
+   TYPE_WITH_ALT("i64vec4", 0, 0, 0, 0, INT64, i64vec4),
+
+   TYPE_WITH_ALT("uint64_t", 0, 0, 0, 0, INT64, uint64_t),
+   TYPE_WITH_ALT("u64vec2", 0, 0, 0, 0, INT64, u64vec2),
+   TYPE_WITH_ALT("u64vec3", 0, 0, 0, 0, INT64, u64vec3),
+   TYPE_WITH_ALT("u64vec4", 0, 0, 0, 0, INT64, u64vec4),
+};
+
+#undef KEYWORD_WITH_ALT
+#undef KEYWORD
+#undef KEYWORD_ALWAYS
+#undef DEPRECATED_ES_KEYWORD
+#undef TYPE_WITH_ALT
+#undef TYPE
+#undef TYPE_ALWAYS
+#undef DEPRECATED_ES_TYPE
+#undef BOOL
+
+#define KEYWORD_BUCKET_BITS 7
+#define KEYWORD_SLOT_BITS 9
+
+static once_flag keywords_once = ONCE_FLAG_INIT;
+
+/* For each first letter, the lengths of the keywords that start with it.
+ * Most identifiers are turned away by this before they're hashed.
+ */
+static uint32_t keyword_lengths[128];
+static uint16_t keyword_displacement[1 << KEYWORD_BUCKET_BITS];
+
+/* Slots hold an index into keywords[] plus one, so that zero is empty. */
+static uint8_t keyword_slots[1 << KEYWORD_SLOT_BITS];
+
+static inline uint64_t
+keyword_hash(const char *name, unsigned length)
+{
+   uint64_t hash = 0xcbf29ce484222325ull;
+
+   for (unsigned i = 0; i < length; i++) {
+      hash ^= (unsigned char) name[i];
+      hash *= 0x100000001b3ull;
+   }
+
+   /* Mix the high bits of the FNV-1a hash back into the low ones. */
+   hash ^= hash >> 33;
+   hash *= 0xff51afd7ed558ccdull;
+   hash ^= hash >> 33;
+
+   return hash;
+}
+
+static inline unsigned
+keyword_bucket(uint64_t hash)
+{
+   return hash >> (64 - KEYWORD_BUCKET_BITS);
+}
+
+static inline unsigned
+keyword_slot(uint64_t hash, unsigned displacement)
+{
+   const uint32_t h1 = (uint32_t) hash;
+   const uint32_t h2 = (uint32_t) (hash >> 32) | 1;
+
+   return (uint32_t) (h1 + displacement * h2) >> (32 - KEYWORD_SLOT_BITS);
+}
+
+static void
+keywords_build(void)
+{
+   uint64_t hashes[ARRAY_SIZE(keywords)];
+   unsigned bucket_size[1 << KEYWORD_BUCKET_BITS] = { 0 };
+   unsigned largest = 0;
+
+   STATIC_ASSERT(ARRAY_SIZE(keywords) < UINT8_MAX);
+   STATIC_ASSERT(ARRAY_SIZE(keywords) < (1 << KEYWORD_SLOT_BITS));
+
+   for (unsigned i = 0; i < ARRAY_SIZE(keywords); i++) {
+      hashes[i] = keyword_hash(keywords[i].name, keywords[i].length);
+
+      const unsigned b = keyword_bucket(hashes[i]);
+      bucket_size[b]++;
+      largest = MAX2(largest, bucket_size[b]);
+
+      assert(keywords[i].length < 32);
+      keyword_lengths[(unsigned char) keywords[i].name[0]] |=
+         1u << keywords[i].length;
+   }
+
+   /* Place the largest buckets first, while most slots are still free. */
+   for (unsigned size = largest; size > 0; size--) {
+      for (unsigned b = 0; b < ARRAY_SIZE(bucket_size); b++) {
+         if (bucket_size[b] != size)
+            continue;
+
+         unsigned d;
+         for (d = 0; d <= UINT16_MAX; d++) {
+            unsigned placed = 0;
+
+            for (unsigned i = 0; i < ARRAY_SIZE(keywords); i++) {
+               if (keyword_bucket(hashes[i]) != b)
+                  continue;
+
+               const unsigned s = keyword_slot(hashes[i], d);
+               if (keyword_slots[s] != 0)
+                  break;
+
+               keyword_slots[s] = i + 1;
+               placed++;
+            }
+
+            if (placed == size)
+               break;
+
+            /* Take back what was placed with this displacement. */
+            for (unsigned i = 0; i < ARRAY_SIZE(keywords); i++) {
+               if (keyword_bucket(hashes[i]) == b &&
+                   keyword_slots[keyword_slot(hashes[i], d)] == i + 1)
+                  keyword_slots[keyword_slot(hashes[i], d)] = 0;
+            }
+         }
+
+         assert(d <= UINT16_MAX);
+         keyword_displacement[b] = d;
+      }
+   }
+}
+
+void
+glsl_keywords_init(void)
+{
+   call_once(&keywords_once, keywords_build);
+}
+
+const struct glsl_keyword *
+glsl_keyword_lookup(const char *name, unsigned length)
+{
+   if (length >= 32 || (unsigned char) name[0] >= ARRAY_SIZE(keyword_lengths) ||
+       !(keyword_lengths[(unsigned char) name[0]] & (1u << length)))
+      return NULL;
+
+   const uint64_t hash = keyword_hash(name, length);
+   const unsigned b = keyword_bucket(hash);
+   const unsigned index =
+      keyword_slots[keyword_slot(hash, keyword_displacement[b])];
+
+   if (index == 0)
+      return NULL;
+
+   const struct glsl_keyword *keyword = &keywords[index - 1];
+   if (keyword->length != length || memcmp(keyword->name, name, length) != 0)
+      return NULL;
+
+   return keyword;
+}
+
+bool
+glsl_keyword_allowed(const struct glsl_keyword *keyword,
+                     const struct _mesa_glsl_parse_state *state)
+{
+   return state->is_version(keyword->allowed_glsl, keyword->allowed_glsl_es) ||
+          keyword_alt_enabled(keyword->alt, state);
+}
+
+bool
+glsl_keyword_reserved(const struct glsl_keyword *keyword,
+                      const struct _mesa_glsl_parse_state *state)
+{
+   return state->is_version(keyword->reserved_glsl, keyword->reserved_glsl_es);
+}
@@ -0,0 +1,111 @@
+/* -*- c++ -*- */
+/*
+ * Copyright © 2026 xxGLSLCompiler contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file glsl_keywords.h
+ *
+ * Keywords and reserved words of the GLSL language.
+ *
+ * The lexer scans every word as an identifier, and then looks it up in a
+ * perfect hash table of the words below to find out whether the version
+ * and extensions enabled in the shader make it a keyword, a reserved word
+ * or just an identifier.
+ */
+
+#ifndef GLSL_KEYWORDS_H
+#define GLSL_KEYWORDS_H
+
+struct glsl_type;
+struct _mesa_glsl_parse_state;
+
+enum glsl_keyword_kind {
+   /** The word is returned as the token in glsl_keyword::token. */
+   GLSL_KEYWORD_TOKEN,
+
+   /** The word is a BASIC_TYPE_TOK naming glsl_keyword::type. */
+   GLSL_KEYWORD_TYPE,
+
+   /** The word is a BOOLCONSTANT with the value glsl_keyword::value. */
+   GLSL_KEYWORD_BOOL,
+};
+
+struct glsl_keyword {
+   const char *name;
+   unsigned length;
+
+   enum glsl_keyword_kind kind;
+
+   /**
+    * Versions that reserve the word and versions that make it a keyword,
+    * with the same meaning as the arguments of
+    * _mesa_glsl_parse_state::is_version().
+    */
+   unsigned reserved_glsl;
+   unsigned reserved_glsl_es;
+   unsigned allowed_glsl;
+   unsigned allowed_glsl_es;
+
+   /**
+    * Which extensions also make the word a keyword, as one of
+    * glsl_keyword_alt in glsl_keywords.cpp.
+    */
+   unsigned alt;
+
+   int token;
+   const glsl_type *const *type;
+   int value;
+};
+
+/**
+ * Look up a word of \p length characters, which needn't be NUL-terminated.
+ *
+ * \return the keyword named \p name, or NULL if it is no keyword of any
+ *         version of the language.
+ */
+const struct glsl_keyword *
+glsl_keyword_lookup(const char *name, unsigned length);
+
+/**
+ * Whether \p keyword is a keyword of the shader being compiled.
+ */
+bool
+glsl_keyword_allowed(const struct glsl_keyword *keyword,
+                     const struct _mesa_glsl_parse_state *state);
+
+/**
+ * Whether \p keyword is a reserved word of the shader being compiled, that
+ * it's an error to use.  Only meaningful for words that aren't allowed.
+ */
+bool
+glsl_keyword_reserved(const struct glsl_keyword *keyword,
+                      const struct _mesa_glsl_parse_state *state);
+
+/**
+ * Build the hash table.  Must be called before glsl_keyword_lookup(), and
+ * may be called any number of times from any thread.
+ */
+void
+glsl_keywords_init(void);
+
+#endif /* GLSL_KEYWORDS_H */
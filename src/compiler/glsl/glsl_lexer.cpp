@@ -573,8 +573,8 @@ static void yynoreturn yy_fatal_error ( const char* msg , yyscan_t yyscanner );
 	yyg->yy_hold_char = *yy_cp; \
 	*yy_cp = '\0'; \
 	yyg->yy_c_buf_p = yy_cp;
-#define YY_NUM_RULES 280
-#define YY_END_OF_BUFFER 281
+#define YY_NUM_RULES 63
+#define YY_END_OF_BUFFER 64
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -582,131 +582,35 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1112] =
+static const flex_int16_t yy_accept[249] =
     {   0,
-        0,    0,   20,   20,    0,    0,  281,  279,    1,   27,
-      279,  279,  279,  279,  279,  279,  278,  279,  185,  183,
-      279,  279,  279,  277,  279,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  279,    1,  279,   26,   20,
-       25,   26,   24,   23,   21,   22,   18,   17,    1,  167,
-      176,  168,  179,  173,  162,  175,  163,  182,  187,  174,
-      188,  185,    0,    0,  185,  185,    0,  185,  183,  183,
-      183,  183,  171,  164,  166,  165,  172,  277,  180,  170,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-
-      277,  277,  277,  277,   36,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,   40,
-      277,  277,   68,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  181,  169,
-        1,    0,    0,    2,    0,    0,    0,    0,    0,   20,
-       19,   23,   22,    0,  187,    0,    0,  186,    0,  188,
-        0,    0,    0,  189,  184,  177,  178,  277,  196,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,   39,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,   32,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,   69,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,    0,    0,    0,
-        0,    0,   19,    0,  187,  191,    0,  186,    0,    0,
-        0,  188,  192,  189,    0,    0,  184,  184,  184,  277,
-
-      277,  277,   30,  277,  277,  277,  254,  247,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-       38,  199,  277,  277,  277,  277,   76,  277,  277,  204,
-      217,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  214,  250,   56,   57,   58,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  202,  194,  277,  277,
-      277,   33,  277,  277,  277,  277,  277,  277,  277,   53,
-       54,   55,  160,  277,  277,  277,    0,    0,    0,    0,
-
-        0,    0,  186,  190,  193,  277,  277,  277,   34,  277,
-       44,   45,   46,  277,  197,  277,  277,   29,  277,  277,
-      277,  277,  228,  229,  230,  277,  225,  226,  227,  277,
-      195,  277,  218,   31,  240,  241,  242,  252,  222,  223,
-      224,  277,  277,  277,  277,   70,  220,  277,  277,  277,
-      277,   47,   48,   49,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,   79,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  215,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  198,
-      277,  277,  249,   50,   51,   52,  277,  277,   37,  277,
-
-        0,    0,    0,    0,    0,  257,  277,  277,   72,  277,
-      277,  255,  277,  277,   43,  277,  277,  277,  277,  216,
-      211,  260,  277,  277,  277,  277,  277,  277,  277,  207,
-      277,  277,  277,  277,  161,   59,   60,   61,   62,   63,
-       64,   65,   66,   67,  277,  277,  277,  277,  221,  203,
-      277,  277,  209,  277,  277,  277,   42,  277,  267,  158,
-      246,   77,  210,  159,  277,  258,  205,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,    0,    0,
-        0,    0,    0,  277,  277,  277,  277,  277,  206,   41,
-      231,  232,  233,  234,  235,  236,  237,  238,  239,  277,
-
-      270,  271,  272,  277,  277,  277,  277,  277,  115,  116,
-      117,  277,  277,  269,  277,  277,  277,  251,  277,  277,
-      277,  277,  114,  277,  277,  277,  277,  277,  277,  277,
-      277,  200,  274,  275,  276,  277,  277,  277,  277,  277,
-      277,   71,  277,  277,   73,  277,  277,    0,    0,    0,
-        0,    0,    0,  277,  277,   74,  152,   35,  212,  126,
-      127,  128,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  208,  277,  277,  277,
-      155,  266,  154,  277,  277,  277,  277,  277,  277,  277,
-      277,  201,  137,  138,  139,  277,  277,  273,  219,  277,
-
-      153,  277,    0,    5,    0,    8,    0,    0,    0,   16,
-        3,  277,   28,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  124,  277,  277,  277,  119,  213,   75,  277,
-      277,  277,  277,  277,  248,  277,  256,  253,  261,   80,
-       81,   82,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  156,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  277,  277,  277,
-      135,  277,  277,  130,  277,  277,  277,  277,  277,  277,
-      277,  277,   91,   92,   93,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  268,  277,
-
-      277,  146,  277,  277,  141,   97,   98,   99,  277,  277,
-        4,    0,    0,    0,    6,    0,    0,    0,    0,    0,
-        0,    0,  157,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  118,  277,  120,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  103,  277,  277,
-      277,  277,   83,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,    0,    7,    0,    0,
-        0,    0,    0,  277,  277,  277,  129,  131,  277,  121,
-      277,  122,  277,  277,  277,  277,  277,  104,  277,  277,
-       94,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-
-      277,  277,  277,  277,  277,  277,  140,  142,  277,  277,
-      277,  105,  277,  277,  100,    0,    0,    0,    0,  132,
-      133,  277,  277,  277,  148,  277,  277,  149,  277,  277,
-      277,  277,  277,  277,  277,   78,  277,  277,  277,  277,
-      243,  277,  244,  259,  277,  277,  277,  143,  144,  277,
-      277,  277,  277,  277,  277,  277,  277,    0,    0,    0,
-        0,  277,  277,  277,  277,  125,  123,  277,  277,  277,
-      262,  264,  277,   84,  277,   85,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  277,  277,  263,  265,  277,
-        0,    0,    0,    0,    0,  136,  134,  277,  277,   95,
-
-       96,  277,  277,  277,   86,  277,  277,  277,   87,  277,
-      277,  277,  147,  145,  101,  102,  277,  277,    0,    0,
-        0,    0,    0,  277,  277,  277,  277,  277,  277,  106,
-      277,  109,  277,  277,  277,  277,    0,    0,    0,    0,
-        0,    0,  277,  277,  107,  110,  277,  277,  277,  277,
-       88,  277,  108,  111,    0,    0,    0,    9,    0,    0,
-        0,    0,  150,  151,  277,  277,  277,  277,  113,    0,
-        0,   10,    0,    0,    0,    0,  277,  277,  245,  277,
-        0,    0,    0,    0,    0,   13,   89,   90,  277,    0,
-        0,    0,   11,    0,   14,  277,    0,    0,   12,  112,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   15,
-        0
+        0,    0,   20,   20,    0,    0,   64,   62,    1,   27,
+       62,   62,   62,   62,   62,   62,   61,   62,   51,   49,
+       62,   62,   62,   60,   62,   62,    1,   62,   26,   20,
+       25,   26,   24,   23,   21,   22,   18,   17,    1,   33,
+       42,   34,   45,   39,   28,   41,   29,   48,   53,   40,
+       54,   51,    0,    0,   51,   51,    0,   51,   49,   49,
+       49,   49,   37,   30,   32,   31,   38,   60,   46,   36,
+       47,   35,    1,    0,    0,    2,    0,    0,    0,    0,
+        0,   20,   19,   23,   22,    0,   53,    0,    0,   52,
+        0,   54,    0,    0,    0,   55,   50,   43,   44,    0,
+
+        0,    0,    0,    0,   19,    0,   53,   57,    0,   52,
+        0,    0,    0,   54,   58,   55,    0,    0,   50,   50,
+       50,    0,    0,    0,    0,    0,    0,   52,   56,   59,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    5,    0,    8,
+        0,    0,    0,   16,    3,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    4,    0,    0,    0,    6,    0,
+        0,    0,    0,    0,    0,    0,    0,    7,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        9,    0,    0,    0,    0,    0,    0,   10,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   13,    0,    0,
+        0,   11,    0,   14,    0,    0,   12,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   15,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -715,16 +619,16 @@ static const YY_CHAR yy_ec[256] =
         1,    1,    4,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    5,    6,    7,    8,    1,    9,   10,    1,   11,
-       12,   13,   14,    1,   15,   16,   17,   18,   19,   20,
-       21,   22,   23,   24,   23,   25,   25,   26,    1,   27,
-       28,   29,    1,    1,   30,   31,   32,   33,   34,   35,
-       36,   37,   37,   37,   37,   38,   39,   37,   40,   37,
-       37,   41,   42,   43,   44,   37,   37,   45,   37,   37,
-        1,    1,    1,   46,   47,    1,   48,   49,   50,   51,
-
-       52,   53,   54,   55,   56,   57,   58,   59,   60,   61,
-       62,   63,   37,   64,   65,   66,   67,   68,   69,   70,
-       71,   72,    1,   73,    1,    1,    1,    1,    1,    1,
+       12,   13,   14,    1,   15,   16,   17,   18,   19,   19,
+       19,   19,   19,   19,   19,   20,   20,   21,    1,   22,
+       23,   24,    1,    1,   25,   25,   25,   26,   27,   28,
+       29,   30,   30,   30,   30,   31,   30,   30,   30,   30,
+       30,   30,   32,   33,   34,   30,   30,   35,   30,   30,
+        1,    1,    1,   36,   30,    1,   37,   38,   39,   40,
+
+       41,   42,   43,   30,   44,   30,   30,   45,   46,   47,
+       48,   49,   30,   50,   51,   52,   53,   54,   55,   56,
+       30,   57,    1,   58,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -741,650 +645,230 @@ static const YY_CHAR yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static const YY_CHAR yy_meta[74] =
+static const YY_CHAR yy_meta[59] =
     {   0,
-        1,    2,    3,    1,    4,    1,    5,    1,    1,    1,
-        1,    1,    1,    1,    1,    6,    5,    7,    7,    7,
-        7,    7,    7,    7,    7,    1,    1,    1,    1,    8,
-        8,    8,    8,    9,   10,   11,   11,   12,   11,   11,
-       11,   11,   11,   11,   11,    1,   11,    8,    8,    8,
-        8,    9,   10,   11,   11,   11,   11,   11,   12,   11,
-       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
-       11,   11,    1
+        1,    1,    2,    1,    3,    1,    3,    1,    1,    1,
+        1,    1,    1,    1,    1,    3,    3,    4,    4,    4,
+        1,    1,    1,    1,    4,    4,    4,    4,    5,    5,
+        5,    5,    5,    5,    5,    1,    4,    4,    4,    4,
+        4,    4,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    1
     } ;
 
-static const flex_int16_t yy_base[1127] =
+static const flex_int16_t yy_base[257] =
     {   0,
-        0,   72,   80,    0, 1606, 1605, 1607, 1610,   74, 1610,
-     1578, 1577,  144, 1576,  141,  142,  140, 1575,  157,  212,
-      139, 1574,  155,    0,  128,  121,  126,  137,  151,  145,
-      192, 1539,  144,  202,  160,  162,  177, 1533,  201,  190,
-      218,  217,  221,  195,  165,  210,  288,  292, 1610,  296,
-     1610, 1582, 1610,  284, 1610,    0, 1610, 1610,  308, 1610,
-     1610, 1610, 1610, 1610, 1610, 1610, 1610, 1610,  343, 1610,
-      385,  153,  283,  300, 1610, 1560,    0, 1538,    0, 1610,
-     1558, 1536, 1566, 1610, 1610, 1610, 1565,    0, 1610, 1610,
-     1526, 1531,  155, 1528, 1537, 1535, 1535, 1521, 1524, 1536,
-
-      271,  274, 1518, 1534, 1514, 1528, 1514, 1511, 1511, 1517,
-      221,  213, 1511, 1522, 1507, 1513, 1517, 1518, 1547,    0,
-     1508, 1519,  274, 1518, 1513, 1493,  136, 1497, 1511, 1501,
-      282, 1494,  293, 1507, 1509,  263, 1488, 1496,  268, 1483,
-     1492,  305,  307, 1497, 1492, 1495, 1483, 1486, 1526,  286,
-      188,  293, 1495, 1482, 1495,  315, 1488, 1487, 1610, 1610,
-      371,  380,  395, 1610, 1472, 1480, 1484, 1475, 1486,  382,
-        0,  393,    0,  446, 1610, 1502, 1483,  393,  458, 1610,
-     1500, 1481,  466,  457,  455, 1610, 1610, 1477,    0, 1472,
-     1467, 1471, 1481, 1475, 1477,  306, 1460, 1460, 1472, 1463,
-
-      323, 1474, 1459, 1470, 1453, 1469, 1467, 1464, 1455, 1462,
-     1448, 1446, 1459, 1444, 1461,    0, 1458, 1445, 1453, 1450,
-     1454, 1435, 1454, 1447, 1444, 1432, 1431,  328, 1449, 1436,
-     1445, 1432, 1439, 1429,  370, 1435, 1438, 1428, 1436, 1424,
-     1428, 1419, 1434, 1433, 1423, 1430,  288, 1413, 1432, 1415,
-     1413, 1412, 1423, 1412, 1407, 1405, 1407, 1418, 1403, 1405,
-     1402, 1414, 1413, 1396, 1415, 1396,  368, 1405, 1400, 1398,
-     1408, 1386,  404, 1405, 1407, 1395, 1387, 1386, 1401, 1389,
-     1401, 1384,    0,  482,  459, 1610,  505, 1610, 1412, 1393,
-      513,  504, 1610, 1610, 1410, 1391, 1610, 1405, 1383, 1373,
-
-     1384, 1383,    0, 1380, 1385,  413,    0,    0, 1372, 1370,
-     1370, 1371, 1366, 1375, 1363, 1363, 1380,  420, 1368,  435,
-        0,    0, 1362, 1373, 1372, 1372,    0, 1356,  523,    0,
-        0, 1358,  526, 1368, 1365, 1366, 1356, 1350, 1349, 1392,
-     1349, 1348, 1348,  529, 1343,    0,    0, 1339, 1338, 1337,
-     1339, 1340, 1345, 1339, 1335, 1349, 1344, 1344, 1342, 1341,
-     1334, 1328, 1330, 1329, 1332, 1332, 1338, 1323, 1326, 1321,
-     1330, 1335, 1322, 1319, 1332, 1322,    0,    0, 1329, 1327,
-     1324, 1353, 1314, 1314, 1320, 1310, 1318,  532, 1315,    0,
-        0,    0,    0, 1304, 1317, 1316, 1315, 1307, 1313, 1310,
-
-     1298,  546,  520, 1610, 1610, 1310, 1311, 1311,    0, 1295,
-        0,    0,    0, 1296,    0, 1305, 1295,    0, 1294, 1295,
-     1301, 1288, 1281, 1280, 1279, 1296,    0,    0,    0, 1286,
-        0, 1282,    0,    0,    0,    0,    0,    0,    0,    0,
-        0, 1295, 1292,  555, 1291,    0,    0, 1295, 1288, 1284,
-     1280,    0,    0,    0, 1272,  539,  560,  563, 1277, 1273,
-     1279, 1269, 1267, 1281, 1265,    0, 1265, 1279, 1267, 1263,
-     1270, 1264, 1276, 1271, 1271,    0, 1268, 1265, 1269, 1252,
-     1250, 1253, 1260, 1266, 1261, 1262, 1259, 1288, 1245,    0,
-     1247, 1248,    0,    0,    0,    0, 1245, 1249,    0, 1242,
-
-     1242, 1235,  448, 1241, 1244,    0, 1252, 1231,    0, 1241,
-     1235,    0, 1228, 1228,    0, 1242,  568,  571,  574,    0,
-     1244,    0,  577,  581, 1258, 1257, 1256, 1221, 1220,    0,
-     1220, 1237, 1236, 1231,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1219, 1233, 1219, 1216,    0,    0,
-     1222,  457,    0, 1218, 1226, 1225,    0, 1217, 1209,    0,
-        0,    0,    0,    0, 1206,    0,    0, 1205, 1217,  583,
-      587, 1222, 1208, 1215, 1214, 1211, 1205, 1202, 1197, 1210,
-      609, 1212, 1197, 1191, 1191, 1205, 1189, 1202,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1194,
-
-        0,    0,    0, 1219, 1218, 1217, 1182, 1181,  432,  596,
-        0, 1194, 1197,    0, 1195, 1183, 1179,    0, 1192, 1189,
-     1188, 1177,    0, 1176, 1166, 1184, 1169, 1172,  620, 1177,
-     1180,    0,    0,    0,    0, 1198, 1197, 1196, 1161, 1160,
-     1160,    0, 1174, 1160,    0, 1171, 1163, 1165, 1168,  653,
-      618,  506, 1158, 1162, 1165,    0,    0,    0,    0, 1186,
-      606,    0, 1162, 1165, 1149, 1157, 1147, 1168, 1157, 1153,
-     1154, 1154, 1153, 1138,  629, 1151,    0, 1152, 1140, 1139,
-        0,    0,    0, 1135, 1165, 1164, 1163, 1128, 1127, 1123,
-     1131,    0, 1161,  623,    0, 1137, 1140,    0,    0,  647,
-
-        0, 1117, 1125, 1610,  722, 1610,  681,    0,  641,  686,
-     1610, 1125,    0, 1121, 1120, 1141, 1130, 1128, 1128, 1115,
-     1130, 1113, 1146, 1125, 1126, 1121, 1142,    0,    0, 1138,
-     1137, 1136, 1096, 1095,    0, 1078,    0,    0,    0,  580,
-      651, 1102, 1085, 1087, 1069, 1080, 1066, 1065, 1084, 1072,
-     1070, 1068, 1085, 1084, 1073, 1031, 1003,    0, 1008, 1061,
-      754,  692,  704, 1024, 1013, 1001, 1015,  996,  997,  996,
-     1029, 1008, 1005, 1026, 1007, 1003, 1005,  988,  985,  999,
-      985,  984, 1017,  678,    0,  993,  996,  988,  979,  987,
-      977,  997,  986,  982,  983,  981,  980,  979,    0,  960,
-
-      955,  988,  958,   23,  138,  188,  681,    0,  188,  210,
-     1610,  269,  710,  728, 1610,  747,    0,  733,  306,  344,
-      328,  335,    0,  353,  374,  365,  383,  395,  411,  425,
-      436,  444,  453,    0,  459,    0,  476,  477,  492,  520,
-      520,  524,  526,  541,  551,  568,  553,  594,  575,  594,
-      607,  607,  640,  599,  617,  621,  616,  619,  623,  625,
-      632,  646,  672,  664,  665,  669,  758, 1610,  777,  690,
-      665,  678,  678,  680,  682,  690,    0,    0,  694,  720,
-      695,  739,  735,  715,  737,  722,  723,  758,  739,  738,
-      761,  740,  745,  743,  747,  732,  731,  747,  734,  737,
-
-      738,  748,  743,  734,  735,  743,    0,    0,  744,  745,
-      746,  781,  762,  761,  784,  777,  762,  757,  762,    0,
-        0,  771,  772,  766,    0,  767,  752,    0,  754,  778,
-      779,  764,  763,  766,  767,    0,  761,  771,  763,  771,
-      794,  775,    0,    0,  774,  791,  792,    0,    0,  793,
-      794,  795,  796,  781,  780,  783,  784,  847,  848,  795,
-      793,  784,  785,  809,  810,    0,    0,  789,  790,  798,
-        0,    0,  799,  822,  796,  824,  819,  813,  800,  822,
-      820,  813,  802,  803,  804,  805,  813,    0,    0,  814,
-      877,  878,  879,  813,  832,    0,    0,  836,  837,    0,
-
-        0,  842,  843,  837,    0,  838,  823,  847,    0,  825,
-      835,  858,    0,    0,    0,    0,  851,  852,  840,  900,
-      850,  852,  904,  845,  846,  839,  841,  865,  866,    0,
-      865,  875,  849,  885,  849,  850,  854,  870,  922,  924,
-      926,  934,  856,  861,    0,    0,  881,  887,  878,  887,
-        0,  901,    0,    0,  896,  943,  944, 1610,  948,  949,
-      955,  905,    0,    0,  885,  890,  892,  915,    0,  900,
-      963, 1610,  965,  916,  918,  971,  903,  905,    0,  927,
-      923,  927,  979,  980,  985, 1610,    0,    0,  924,  940,
-      993,  997, 1610,  998, 1610,  920,  932, 1002, 1610,    0,
-
-      928, 1010, 1011, 1018, 1023,  942,  947, 1024, 1028, 1610,
-     1610, 1071, 1077, 1083, 1090, 1093, 1103, 1109, 1115, 1121,
-     1127, 1138, 1139, 1146, 1157, 1158
+        0,   57,   65,    0,  598,  597,  599,  602,   59,  602,
+      575,  574,  114,  573,  111,  112,  110,  572,  122,  163,
+      109,  571,  120,    0,  103,  110,  143,  157,  602,  150,
+      602,  576,  602,  146,  602,    0,  602,  602,  167,  602,
+      602,  602,  602,  602,  602,  602,  602,  602,  199,  602,
+      227,  135,  168,  214,  602,  561,    0,  546,    0,  602,
+      559,  544,  565,  602,  602,  602,  564,    0,  602,  602,
+      602,  602,  172,  233,  247,  602,  530,  538,  540,  533,
+      541,  208,    0,  202,    0,  242,  602,  553,  538,  284,
+      261,  602,  545,  519,  205,  279,  162,  602,  602,  508,
+
+      520,  510,  519,  505,    0,  245,  299,  602,  275,  602,
+      526,  511,  265,  314,  602,  602,  524,  509,  602,  519,
+      504,  507,  502,  505,  502,  493,  317,  320,  602,  602,
+      496,  488,  156,  494,  495,  486,  496,  348,  497,  485,
+      473,  464,  352,  358,  187,  457,  444,  602,  377,  602,
+      370,    0,  396,  268,  602,  444,  455,  388,  400,  344,
+      422,  402,  390,  398,  602,  424,  407,  419,  602,  423,
+        0,  427,  401,  379,  361,  361,  431,  602,  435,  375,
+      347,  350,  338,  350,  315,  297,  278,  198,  237,  276,
+      267,  446,  381,  304,  256,  262,  239,  326,  224,  226,
+
+      447,  205,  211,  448,  452,  454,  459,  214,  464,  465,
+      602,  469,  470,  476,  322,  193,  477,  602,  481,  426,
+      195,  482,  187,  172,  483,  491,  496,  602,  168,  497,
+      508,  602,  509,  602,  152,  510,  602,  133,  495,  514,
+      521,  525,  128,  105,  526,  530,  602,  602,  562,  564,
+      566,  142,  571,  132,  574,   56
     } ;
 
-static const flex_int16_t yy_def[1127] =
+static const flex_int16_t yy_def[257] =
     {   0,
-     1111,    1, 1111,    3, 1112, 1112, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1113, 1111, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1114, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111,   19, 1115, 1111, 1111, 1111, 1116, 1111,   20, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1113, 1111, 1111,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1117, 1111, 1114, 1111, 1111, 1111, 1111,   71, 1111, 1111,
-     1111, 1111, 1111, 1118, 1116, 1111, 1111, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1111, 1111, 1111,
-     1111, 1111, 1117, 1111, 1119, 1111, 1111, 1111, 1111, 1111,
-     1111, 1120, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1113,
-
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1111, 1111, 1111, 1111,
-
-     1111, 1111, 1121, 1111, 1111, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-
-     1111, 1111, 1111, 1111, 1111, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1111, 1111,
-     1111, 1111, 1111, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1111, 1111, 1111,
-     1122, 1111, 1111, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-
-     1113, 1113, 1111, 1111, 1111, 1111, 1111, 1123, 1122, 1111,
-     1111, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1111, 1124,
-     1111, 1125, 1123, 1111, 1111, 1111, 1111, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1111, 1124, 1111, 1111, 1111, 1111, 1126, 1125, 1111, 1111,
-     1111, 1111, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1111, 1111, 1126, 1111,
-     1111, 1111, 1111, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1111, 1111, 1111, 1111, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1111, 1111, 1111,
-     1111, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1111, 1111, 1111, 1111, 1111, 1113, 1113, 1113, 1113, 1113,
-
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1111, 1111,
-     1111, 1111, 1111, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1113, 1113, 1111, 1111, 1111, 1111,
-     1111, 1111, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1113, 1113, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1113, 1113, 1113, 1113,
-     1111, 1111, 1111, 1111, 1111, 1111, 1113, 1113, 1113, 1111,
-     1111, 1111, 1111, 1111, 1111, 1113, 1111, 1111, 1111, 1113,
-
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-        0, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111
+      248,    1,  248,    3,  249,  249,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  250,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  251,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,   19,  248,  248,  248,  248,  252,  248,   20,  248,
+      248,  248,  248,  248,  248,  248,  248,  250,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  253,  248,  251,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  252,  248,  248,  248,
+
+      248,  248,  248,  248,  253,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  254,  248,  248,  248,  248,  255,  248,  248,  254,
+      248,  248,  248,  248,  248,  255,  248,  248,  248,  248,
+      256,  248,  248,  248,  248,  248,  248,  248,  256,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,    0,  248,  248,
+      248,  248,  248,  248,  248,  248
     } ;
 
-static const flex_int16_t yy_nxt[1684] =
+static const flex_int16_t yy_nxt[661] =
     {   0,
         8,    9,   10,    9,    9,   11,    8,    8,   12,   13,
         8,    8,   14,   15,   16,   17,   18,   19,   20,   20,
-       20,   20,   20,   20,   20,    8,   21,   22,   23,   24,
+        8,   21,   22,   23,   24,   24,   24,   24,   24,   24,
+       24,   24,   24,   24,   24,   25,   24,   24,   24,   24,
        24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   25,   24,   26,   27,   28,
-       29,   30,   31,   32,   33,   34,   24,   24,   35,   36,
-       37,   38,   39,   40,   41,   42,   43,   44,   45,   24,
-       24,   24,   46,   47,  859,   59,   47,   59,   59,   48,
-       49,   50,   51,   50,   50,   49,   49,   49,   49,   49,
-       49,   49,   49,   49,   49,   49,   52,   53,   54,   54,
-
-       54,   54,   54,   54,   54,   55,   49,   49,   49,   56,
-       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
-       56,   56,   56,   56,   56,   49,   56,   56,   56,   56,
-       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
-       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
-       56,   56,   49,   62,   65,   89,   67,   69,   69,   69,
-       69,   69,   69,   69,   69,   83,   84,  860,   66,   68,
-       91,   63,   71,   90,   72,   72,   72,   72,   72,   72,
-       72,   73,   86,   87,   98,   92,   93,   94,   99,   95,
-       74,  116,   96,   97,   75,  100,  233, 1111,  101,  117,
-
-       76,   77,  102,  107,  234,  108,  103,  126,   74,  128,
-      104,  118,  105,  129,  109,   75,  190,  861,  106,  157,
-      191,  127, 1111,   78,  130,  119,   77,   71,  158,   79,
-       79,   79,   79,   79,   79,   79,   79,  159,  131,  110,
-      865,  136,  154,  267,  149,   74,  155,  111,  133,   80,
-      112,  137,  268,  113,  120,   81,  156,  121,  866,  114,
-      214,  122,  123,   74,  134,  138,  124,  135,  145,  125,
-       80,  146,  139,  140,  215,  813,  150,  141,   82,  212,
-      147,  151,  160,  142,  143,  152,  144,  148,  153,  161,
-      213,   59,  161,  163,  164,  162,  163,  170,   71,  170,
-
-      170,  172,  172,  172,  172,  172,  172,  172,  172,   59,
-      246,   59,   59,  183,  183,  251,   74,  184,  184,  184,
-      184,  184,  184,  184,  184,  199,  202,  247,  248,  252,
-      200,  201,  225,  203,   74,  226,  227,  238,  870,  228,
-      269,  229,  241,  165,  239,  265,  266,  166,  270,  362,
-      167,  340,  255,  363,  168,  257,  242,  307,  243,  169,
-       69,   69,   69,   69,   69,   69,   69,   69,  256,  258,
-      274,  308,  161,  275,   59,  161,  174,  175,  162,  341,
-      176,  163,  164,  170,  163,  170,  170,  313,  314,  348,
-      349,  350,  871,  872,  174,  175,  163,  164,  873,  163,
-
-      874,  177,  178,  178,  178,  178,  178,  178,  178,  178,
-      172,  172,  172,  172,  172,  172,  172,  172,  179,  180,
-      383,  875,  181,  390,  391,  392,  287,  288,  876,  384,
-      289,  165,  411,  412,  413,  166,  179,  180,  167,  423,
-      424,  425,  168,  182,  287,  288,  165,  169,  877,  581,
-      166,  290,  581,  167,  427,  428,  429,  168,  878,  284,
-      284,  665,  169,  285,  285,  285,  285,  285,  285,  285,
-      285,  291,  291,  666,  879,  292,  292,  292,  292,  292,
-      292,  292,  292,  184,  184,  184,  184,  184,  184,  184,
-      184,  294,  297,  175,  295,  880,  176,  881,  298,  285,
-
-      285,  285,  285,  285,  285,  285,  285,  710,  623,  294,
-      710,  175,  624,  297,  882,  296,  883,  177,  402,  402,
-      884,  299,  403,  403,  403,  403,  403,  403,  403,  403,
-      292,  292,  292,  292,  292,  292,  292,  292,  180,  885,
-      886,  181,  435,  436,  437,  439,  440,  441,  452,  453,
-      454,  494,  495,  496,  288,  887,  180,  289,  536,  537,
-      538,  888,  182,  403,  403,  403,  403,  403,  403,  403,
-      403,  889,  288,  525,  526,  527,  890,  891,  290,  539,
-      540,  541,  542,  543,  544,  528,  529,  591,  592,  593,
-      594,  595,  596,  597,  598,  599,  601,  602,  603,  604,
-
-      605,  606,  633,  634,  635,  636,  637,  638,  892,  789,
-      581,  607,  608,  581,  893,  894,  895,  639,  640,  705,
-      706,  790,  705,  896,  897,  667,  650,  651,  651,  651,
-      651,  651,  651,  651,  668,  715,  669,  670,  685,  686,
-      687,  898,  705,  706,  716,  705,  717,  730,  731,  732,
-      688,  689,  748,  690,  705,  706,  899,  705,  900,  733,
-      734,  749,  903,  750,  904,  753,  754,  755,  905,  901,
-      707,  707,  707,  707,  707,  707,  707,  756,  757,  906,
-      791,  902,  705,  706,  907,  705,  908,  710,  909,  792,
-      710,  793,  794,  814,  815,  910,  814,  708,  707,  707,
-
-      707,  707,  707,  707,  707,  705,  706,  839,  705,  911,
-      862,  867,  868,  912,  867,  913,  840,  914,  841,  863,
-      915,  864,  708,  705,  706,  916,  705,  764,  760,  814,
-      815,  917,  814,  918,  814,  815,  765,  814,  919,  761,
-      762,  762,  762,  762,  762,  762,  762,  766,  814,  815,
-      920,  814,  921,  922,  767,  814,  815,  923,  814,  867,
-      868,  924,  867,  925,  816,  816,  816,  816,  816,  816,
-      816,  816,  816,  816,  816,  816,  816,  816,  814,  815,
-      926,  814,  927,  928,  929,  930,  931,  932,  933,  934,
-      935,  936,  937,  938,  939,  940,  941,  942,  817,  943,
-
-      944,  945,  946,  947,  948,  949,  950,  951,  952,  953,
-      954,  955,  956,  957,  958,  959,  960,  961,  962,  963,
-      964,  965,  966,  817,  967,  968,  969,  970,  971,  972,
-      973,  974,  975,  976,  977,  978,  979,  980,  981,  982,
-      983,  984,  985,  986,  987,  988,  989,  990,  991,  992,
-      994,  991,  992,  995,  996,  997,  998,  999,  993, 1000,
-     1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010,
-     1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018,  991,  992,
-     1020,  991,  992, 1020, 1022, 1023, 1024, 1025,  993, 1026,
-     1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036,
-
-     1037, 1020, 1038, 1040, 1020, 1041, 1043, 1044, 1041, 1045,
-     1039, 1046, 1047, 1048, 1042, 1049, 1050, 1051, 1052, 1053,
-     1054, 1055, 1056, 1057, 1063, 1059, 1057, 1041, 1059, 1064,
-     1041, 1065, 1019, 1058, 1060, 1061, 1042, 1066, 1061, 1067,
-     1021, 1068, 1069, 1070, 1071, 1057, 1077, 1071, 1057, 1059,
-     1073, 1078, 1059, 1073, 1072, 1058, 1061, 1075, 1060, 1061,
-     1079, 1021, 1080, 1081, 1071, 1076, 1073, 1071, 1082, 1073,
-     1084, 1087, 1085, 1088, 1072, 1085, 1083, 1089, 1090, 1091,
-     1092, 1094, 1086, 1092, 1094, 1096, 1085, 1097, 1100, 1085,
-     1093, 1095, 1101, 1102, 1098, 1062, 1086, 1098, 1092, 1094,
-
-     1107, 1092, 1094, 1098, 1099, 1108, 1098,  858, 1093, 1095,
-     1074, 1103, 1103, 1099, 1103, 1103, 1062,  857,  856, 1105,
-     1104, 1104, 1105,  855, 1105, 1109, 1074, 1105, 1109, 1109,
-      854,  853, 1109,  852,  851, 1110,  850,  849,  848, 1110,
-      847,  846,  845,  844,  843,  842,  838,  837,  836,  835,
-      834,  833,  832,  831,  830,  829,  828,  827,  826,  825,
-      824,  823,  822,  821,  820, 1106,  819,  813,  811,  810,
-     1106,   57,   57,   57,   57,   57,   57,   57,   57,   57,
-       57,   57,   57,   88,   88,   88,   88,   88,   88,  173,
-      173,  173,  173,  173,  173,   73,   73,  809,   73,  185,
-
-      185,  185,  185,  283,  283,  808,  283,  283,  283,  283,
-      283,  283,  283,  283,  283,  184,  807,  806,  184,  805,
-      184,  285,  804,  803,  285,  802,  285,  292,  801,  800,
-      292,  799,  292,  403,  798,  797,  403,  796,  403,  709,
-      709,  709,  795,  788,  709,  763,  763,  763,  763,  812,
-      812,  812,  812,  812,  812,  812,  812,  812,  818,  818,
-      818,  787,  786,  818,  869,  869,  869,  869,  785,  784,
-      783,  782,  781,  780,  779,  778,  777,  776,  775,  774,
-      773,  772,  771,  770,  769,  768,  759,  758,  752,  751,
-      747,  746,  745,  744,  743,  742,  741,  740,  739,  738,
-
-      737,  736,  735,  729,  728,  727,  726,  725,  724,  723,
-      722,  721,  720,  719,  718,  714,  713,  712,  711,  704,
-      703,  702,  701,  700,  699,  698,  697,  696,  695,  694,
-      693,  692,  691,  684,  683,  682,  681,  680,  679,  678,
-      677,  676,  675,  674,  673,  672,  671,  664,  663,  662,
-      661,  660,  659,  658,  657,  656,  655,  654,  653,  652,
-      649,  648,  647,  646,  645,  644,  643,  642,  641,  632,
-      631,  630,  629,  628,  627,  626,  625,  622,  621,  620,
-      619,  618,  617,  616,  615,  614,  613,  612,  611,  610,
-      609,  600,  590,  589,  588,  587,  586,  585,  584,  583,
-
-      582,  580,  579,  578,  577,  576,  575,  574,  573,  572,
-      571,  570,  569,  568,  567,  566,  565,  564,  563,  562,
-      561,  560,  559,  558,  557,  556,  555,  554,  553,  552,
-      551,  550,  549,  548,  547,  546,  545,  535,  534,  533,
-      532,  531,  530,  524,  523,  522,  521,  520,  519,  518,
-      517,  516,  515,  514,  513,  512,  511,  510,  509,  508,
-      507,  506,  505,  504,  503,  502,  501,  500,  499,  498,
-      497,  493,  492,  491,  490,  489,  488,  487,  486,  485,
-      484,  483,  482,  481,  480,  479,  478,  477,  476,  475,
-      474,  473,  472,  471,  470,  469,  468,  467,  466,  465,
-
-      464,  463,  462,  461,  460,  459,  458,  457,  456,  455,
-      451,  450,  449,  448,  447,  446,  445,  444,  443,  442,
-      438,  434,  433,  432,  431,  430,  426,  422,  421,  420,
-      419,  418,  417,  416,  415,  414,  410,  409,  408,  407,
-      406,  297,  297,  405,  405,  404,  404,  401,  400,  399,
-      398,  397,  396,  395,  394,  393,  389,  388,  387,  386,
-      385,  382,  381,  380,  379,  378,  377,  376,  375,  374,
-      373,  372,  371,  370,  369,  368,  367,  366,  365,  364,
-      361,  360,  359,  358,  357,  356,  355,  354,  353,  352,
-      351,  347,  346,  345,  344,  343,  342,  339,  338,  337,
-
-      336,  335,  334,  333,  332,  331,  330,  329,  328,  327,
-      326,  325,  324,  323,  322,  321,  320,  319,  318,  317,
-      316,  315,  312,  311,  310,  309,  306,  305,  304,  303,
-      302,  301,  300,  293,  293,  286,  286,  282,  281,  280,
-      279,  278,  277,  276,  273,  272,  271,  264,  263,  262,
-      261,  260,  259,  254,  253,  250,  249,  245,  244,  240,
-      237,  236,  235,  232,  231,  230,  224,  223,  222,  221,
-      220,  219,  218,  217,  216,  211,  210,  209,  208,  207,
-      206,  205,  204,  198,  197,  196,  195,  194,  193,  192,
-      189,  188,  187,  186,   80,   80,   75,   75,  171,  132,
-
-      115,   85,   70,   64,   61,   60, 1111,   58,   58,    7,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111
+       24,   24,   24,   24,   24,   24,   24,   26,   27,  179,
+       39,   27,   39,   39,   28,   29,   30,   31,   30,   30,
+       29,   29,   29,   29,   29,   29,   29,   29,   29,   29,
+       29,   32,   33,   34,   34,   35,   29,   29,   29,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       29,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   29,   42,   45,   69,   47,   49,   49,   49,
+       63,   64,   71,   46,   48,  160,   43,   51,   70,   52,
+       52,   53,   66,   67,   73,   97,   39,   73,   54,  245,
+       74,   82,   55,   82,   82,   56,   57,  138,   75,   76,
+      138,   75,   54,   84,   84,   84,   55,   72,   39,  248,
+       39,   39,  244,   73,   58,   39,   73,   57,   51,   74,
+       59,   59,   59,   51,  239,   53,   53,   53,  154,   54,
+      248,  154,  119,   60,   54,  120,   61,   77,  238,  192,
+
+       78,   79,  192,   54,  235,   80,  119,   60,   54,   82,
+       81,   82,   82,  230,  121,   62,   49,   49,   49,   84,
+       84,   84,   96,   96,   96,   86,   87,   95,   95,   88,
+      229,   96,   96,   96,   75,   76,  226,   75,  193,   86,
+       87,  193,  223,   89,   90,   90,   90,  194,   75,   76,
+      216,   75,  209,   91,   92,  106,  106,   93,  208,  107,
+      107,  107,  107,  107,  107,  203,  205,   91,   92,  154,
+      204,   94,  154,   77,  113,  113,   78,   79,  114,  114,
+      114,   80,  114,  114,  114,  202,   81,   77,  127,  127,
+       78,   79,  128,  128,  128,   80,   96,   96,   96,  161,
+
+       81,   90,   90,   90,  201,  198,  116,  162,  198,  117,
+      109,  110,  200,  196,  111,  163,  107,  107,  107,  195,
+      116,  191,  164,  118,  109,  110,   87,  198,  112,   88,
+      198,  114,  114,  114,  128,  128,  128,  128,  128,  128,
+       87,   92,  190,   89,   93,  149,  150,  110,  149,  138,
+      111,  199,  138,  149,  150,   92,  149,  189,   94,  149,
+      150,  110,  149,  221,  112,  143,  144,  144,  222,  151,
+      151,  149,  150,  199,  149,  153,  153,  153,  149,  150,
+      188,  149,  193,  157,  187,  193,  152,  151,  151,  168,
+      169,  194,  168,  186,  158,  159,  159,  149,  150,  185,
+
+      149,  168,  169,  184,  168,  170,  170,  152,  177,  178,
+      183,  177,  182,  153,  153,  153,  181,  172,  172,  172,
+      168,  169,  171,  168,  168,  169,  180,  168,  168,  169,
+      167,  168,  177,  178,  176,  177,  168,  169,  175,  168,
+      170,  170,  174,  171,  172,  172,  172,  192,  206,  210,
+      192,  206,  210,  212,  173,  206,  212,  207,  206,  211,
+      214,  167,  213,  214,  207,  217,  210,  224,  217,  210,
+      212,  219,  225,  212,  219,  218,  211,  214,  217,  213,
+      214,  217,  219,  227,  231,  219,  227,  231,  218,  197,
+      165,  156,  233,  228,  232,  233,  240,  227,  236,  240,
+
+      227,  236,  234,  155,  148,  241,  215,  228,  237,  231,
+      233,  236,  231,  233,  236,  240,  147,  220,  240,  232,
+      234,  237,  242,  215,  241,  242,  242,  246,  220,  242,
+      246,  246,  146,  145,  246,  142,  141,  247,  140,  139,
+      137,  247,  136,  135,  134,  133,  132,  131,  119,  119,
+      130,  130,  129,  129,  126,  125,  124,  243,  123,  122,
+      115,  243,   37,   37,   37,   37,   37,   68,   68,   85,
+       85,  105,  115,  105,  105,  105,  166,  166,  166,  108,
+      108,  104,  103,  102,  101,  100,   99,   98,   60,   60,
+       55,   55,   83,   65,   50,   44,   41,   40,  248,   38,
+
+       38,    7,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248
     } ;
 
-static const flex_int16_t yy_chk[1684] =
+static const flex_int16_t yy_chk[661] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    2,  804,    9,    2,    9,    9,    2,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-
+        1,    1,    1,    1,    1,    1,    1,    1,    2,  256,
+        9,    2,    9,    9,    2,    3,    3,    3,    3,    3,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
         3,    3,    3,   13,   15,   25,   16,   17,   17,   17,
-       17,   17,   17,   17,   17,   21,   21,  805,   15,   16,
-       26,   13,   19,   25,   19,   19,   19,   19,   19,   19,
-       19,   19,   23,   23,   28,   26,   26,   27,   28,   27,
-       19,   33,   27,   27,   19,   28,  127,   72,   28,   33,
-
-       19,   19,   29,   30,  127,   30,   29,   35,   19,   36,
-       29,   33,   29,   36,   30,   19,   93,  806,   29,   45,
-       93,   35,   72,   19,   37,   34,   19,   20,   45,   20,
-       20,   20,   20,   20,   20,   20,   20,   46,   37,   31,
-      809,   40,   44,  151,   43,   20,   44,   31,   39,   20,
-       31,   40,  151,   31,   34,   20,   44,   34,  810,   31,
-      112,   34,   34,   20,   39,   41,   34,   39,   42,   34,
-       20,   42,   41,   41,  112,  812,   43,   41,   20,  111,
-       42,   43,   46,   41,   41,   43,   41,   42,   43,   47,
-      111,   47,   47,   48,   48,   47,   48,   50,   73,   50,
-
-       50,   54,   54,   54,   54,   54,   54,   54,   54,   59,
-      136,   59,   59,   74,   74,  139,   73,   74,   74,   74,
-       74,   74,   74,   74,   74,  101,  102,  136,  136,  139,
-      101,  101,  123,  102,   73,  123,  123,  131,  819,  123,
-      152,  123,  133,   48,  131,  150,  150,   48,  152,  247,
-       48,  228,  142,  247,   48,  143,  133,  196,  133,   48,
-       69,   69,   69,   69,   69,   69,   69,   69,  142,  143,
-      156,  196,  161,  156,  161,  161,   69,   69,  161,  228,
-       69,  162,  162,  170,  162,  170,  170,  201,  201,  235,
-      235,  235,  820,  821,   69,   69,  163,  163,  822,  163,
-
-      824,   69,   71,   71,   71,   71,   71,   71,   71,   71,
-      172,  172,  172,  172,  172,  172,  172,  172,   71,   71,
-      267,  825,   71,  273,  273,  273,  178,  178,  826,  267,
-      178,  162,  306,  306,  306,  162,   71,   71,  162,  318,
-      318,  318,  162,   71,  178,  178,  163,  162,  827,  503,
-      163,  178,  503,  163,  320,  320,  320,  163,  828,  174,
-      174,  609,  163,  174,  174,  174,  174,  174,  174,  174,
-      174,  179,  179,  609,  829,  179,  179,  179,  179,  179,
-      179,  179,  179,  183,  183,  183,  183,  183,  183,  183,
-      183,  184,  185,  285,  184,  830,  285,  831,  185,  284,
-
-      284,  284,  284,  284,  284,  284,  284,  652,  552,  184,
-      652,  285,  552,  185,  832,  184,  833,  285,  287,  287,
-      835,  185,  287,  287,  287,  287,  287,  287,  287,  287,
-      291,  291,  291,  291,  291,  291,  291,  291,  292,  837,
-      838,  292,  329,  329,  329,  333,  333,  333,  344,  344,
-      344,  388,  388,  388,  403,  839,  292,  403,  456,  456,
-      456,  840,  292,  402,  402,  402,  402,  402,  402,  402,
-      402,  841,  403,  444,  444,  444,  842,  843,  403,  457,
-      457,  457,  458,  458,  458,  444,  444,  517,  517,  517,
-      518,  518,  518,  519,  519,  519,  523,  523,  523,  524,
-
-      524,  524,  570,  570,  570,  571,  571,  571,  844,  740,
-      581,  524,  524,  581,  845,  846,  847,  571,  571,  651,
-      651,  740,  651,  848,  849,  610,  581,  581,  581,  581,
-      581,  581,  581,  581,  610,  661,  610,  610,  629,  629,
-      629,  850,  709,  709,  661,  709,  661,  675,  675,  675,
-      629,  629,  694,  629,  650,  650,  851,  650,  852,  675,
-      675,  694,  854,  694,  855,  700,  700,  700,  856,  853,
-      650,  650,  650,  650,  650,  650,  650,  700,  700,  857,
-      741,  853,  707,  707,  858,  707,  859,  710,  860,  741,
-      710,  741,  741,  762,  762,  861,  762,  650,  707,  707,
-
-      707,  707,  707,  707,  707,  763,  763,  784,  763,  862,
-      807,  813,  813,  863,  813,  864,  784,  865,  784,  807,
-      866,  807,  650,  705,  705,  870,  705,  710,  705,  814,
-      814,  871,  814,  872,  818,  818,  710,  818,  873,  705,
-      705,  705,  705,  705,  705,  705,  705,  710,  816,  816,
-      874,  816,  875,  876,  710,  761,  761,  879,  761,  867,
-      867,  880,  867,  881,  816,  816,  816,  816,  816,  816,
-      816,  761,  761,  761,  761,  761,  761,  761,  869,  869,
-      882,  869,  883,  884,  885,  886,  887,  888,  889,  890,
-      891,  892,  893,  894,  895,  896,  897,  898,  761,  899,
-
-      900,  901,  902,  903,  904,  905,  906,  909,  910,  911,
-      912,  913,  914,  915,  916,  917,  918,  919,  922,  923,
-      924,  926,  927,  761,  929,  930,  931,  932,  933,  934,
-      935,  937,  938,  939,  940,  941,  942,  945,  946,  947,
-      950,  951,  952,  953,  954,  955,  956,  957,  958,  959,
-      960,  958,  959,  961,  962,  963,  964,  965,  959,  968,
-      969,  970,  973,  974,  975,  976,  977,  978,  979,  980,
-      981,  982,  983,  984,  985,  986,  987,  990,  991,  992,
-      993,  991,  992,  993,  994,  995,  998,  999,  992, 1002,
-     1003, 1004, 1006, 1007, 1008, 1010, 1011, 1012, 1017, 1018,
-
-     1019, 1020, 1021, 1022, 1020, 1023, 1024, 1025, 1023, 1026,
-     1021, 1027, 1028, 1029, 1023, 1031, 1032, 1033, 1034, 1035,
-     1036, 1037, 1038, 1039, 1043, 1040, 1039, 1041, 1040, 1044,
-     1041, 1047,  991, 1039, 1040, 1042, 1041, 1048, 1042, 1049,
-      993, 1050, 1052, 1055, 1056, 1057, 1065, 1056, 1057, 1059,
-     1060, 1066, 1059, 1060, 1056, 1057, 1061, 1062, 1059, 1061,
-     1067, 1020, 1068, 1070, 1071, 1062, 1073, 1071, 1074, 1073,
-     1075, 1077, 1076, 1078, 1071, 1076, 1074, 1080, 1081, 1082,
-     1083, 1084, 1076, 1083, 1084, 1089, 1085, 1090, 1096, 1085,
-     1083, 1084, 1097, 1101, 1091, 1042, 1085, 1091, 1092, 1094,
-
-     1106, 1092, 1094, 1098, 1091, 1107, 1098,  803, 1092, 1094,
-     1060, 1102, 1103, 1098, 1102, 1103, 1061,  802,  801, 1104,
-     1102, 1103, 1104,  800, 1105, 1108, 1073, 1105, 1108, 1109,
-      798,  797, 1109,  796,  795, 1108,  794,  793,  792, 1109,
-      791,  790,  789,  788,  787,  786,  783,  782,  781,  780,
-      779,  778,  777,  776,  775,  774,  773,  772,  771,  770,
-      769,  768,  767,  766,  765, 1104,  764,  760,  759,  757,
-     1105, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
-     1112, 1112, 1112, 1113, 1113, 1113, 1113, 1113, 1113, 1114,
-     1114, 1114, 1114, 1114, 1114, 1115, 1115,  756, 1115, 1116,
-
-     1116, 1116, 1116, 1117, 1117,  755, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1118,  754,  753, 1118,  752,
-     1118, 1119,  751,  750, 1119,  749, 1119, 1120,  748,  747,
-     1120,  746, 1120, 1121,  745,  744, 1121,  743, 1121, 1122,
-     1122, 1122,  742,  736, 1122, 1123, 1123, 1123, 1123, 1124,
-     1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1125, 1125,
-     1125,  734,  733, 1125, 1126, 1126, 1126, 1126,  732,  731,
-      730,  727,  726,  725,  724,  723,  722,  721,  720,  719,
-      718,  717,  716,  715,  714,  712,  703,  702,  697,  696,
-      693,  691,  690,  689,  688,  687,  686,  685,  684,  680,
-
-      679,  678,  676,  674,  673,  672,  671,  670,  669,  668,
-      667,  666,  665,  664,  663,  660,  655,  654,  653,  649,
-      648,  647,  646,  644,  643,  641,  640,  639,  638,  637,
-      636,  631,  630,  628,  627,  626,  625,  624,  622,  621,
-      620,  619,  617,  616,  615,  613,  612,  608,  607,  606,
-      605,  604,  600,  588,  587,  586,  585,  584,  583,  582,
-      580,  579,  578,  577,  576,  575,  574,  573,  572,  569,
-      568,  565,  559,  558,  556,  555,  554,  551,  548,  547,
-      546,  545,  534,  533,  532,  531,  529,  528,  527,  526,
-      525,  521,  516,  514,  513,  511,  510,  508,  507,  505,
-
-      504,  502,  501,  500,  498,  497,  492,  491,  489,  488,
-      487,  486,  485,  484,  483,  482,  481,  480,  479,  478,
-      477,  475,  474,  473,  472,  471,  470,  469,  468,  467,
-      465,  464,  463,  462,  461,  460,  459,  455,  451,  450,
-      449,  448,  445,  443,  442,  432,  430,  426,  425,  424,
-      423,  422,  421,  420,  419,  417,  416,  414,  410,  408,
-      407,  406,  401,  400,  399,  398,  397,  396,  395,  394,
-      389,  387,  386,  385,  384,  383,  382,  381,  380,  379,
-      376,  375,  374,  373,  372,  371,  370,  369,  368,  367,
-      366,  365,  364,  363,  362,  361,  360,  359,  358,  357,
-
-      356,  355,  354,  353,  352,  351,  350,  349,  348,  345,
-      343,  342,  341,  340,  339,  338,  337,  336,  335,  334,
-      332,  328,  326,  325,  324,  323,  319,  317,  316,  315,
-      314,  313,  312,  311,  310,  309,  305,  304,  302,  301,
-      300,  299,  298,  296,  295,  290,  289,  282,  281,  280,
-      279,  278,  277,  276,  275,  274,  272,  271,  270,  269,
-      268,  266,  265,  264,  263,  262,  261,  260,  259,  258,
-      257,  256,  255,  254,  253,  252,  251,  250,  249,  248,
-      246,  245,  244,  243,  242,  241,  240,  239,  238,  237,
-      236,  234,  233,  232,  231,  230,  229,  227,  226,  225,
-
-      224,  223,  222,  221,  220,  219,  218,  217,  215,  214,
-      213,  212,  211,  210,  209,  208,  207,  206,  205,  204,
-      203,  202,  200,  199,  198,  197,  195,  194,  193,  192,
-      191,  190,  188,  182,  181,  177,  176,  169,  168,  167,
-      166,  165,  158,  157,  155,  154,  153,  149,  148,  147,
-      146,  145,  144,  141,  140,  138,  137,  135,  134,  132,
-      130,  129,  128,  126,  125,  124,  122,  121,  119,  118,
-      117,  116,  115,  114,  113,  110,  109,  108,  107,  106,
-      105,  104,  103,  100,   99,   98,   97,   96,   95,   94,
-       92,   91,   87,   83,   82,   81,   78,   76,   52,   38,
-
-       32,   22,   18,   14,   12,   11,    7,    6,    5, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
-     1111, 1111, 1111
+       21,   21,   26,   15,   16,  254,   13,   19,   25,   19,
+       19,   19,   23,   23,   27,  252,   27,   27,   19,  244,
+       27,   30,   19,   30,   30,   19,   19,  133,   28,   28,
+      133,   28,   19,   34,   34,   34,   19,   26,   39,   52,
+       39,   39,  243,   73,   19,   73,   73,   19,   20,   73,
+       20,   20,   20,   53,  238,   53,   53,   53,  145,   20,
+       52,  145,   97,   20,   53,   97,   20,   28,  235,  188,
+
+       28,   28,  188,   20,  229,   28,   97,   20,   53,   82,
+       28,   82,   82,  224,   97,   20,   49,   49,   49,   84,
+       84,   84,   95,   95,   95,   49,   49,   54,   54,   49,
+      223,   54,   54,   54,   74,   74,  221,   74,  189,   49,
+       49,  189,  216,   49,   51,   51,   51,  189,   75,   75,
+      208,   75,  203,   51,   51,   86,   86,   51,  202,   86,
+       86,   86,  106,  106,  106,  199,  200,   51,   51,  154,
+      199,   51,  154,   74,   91,   91,   74,   74,   91,   91,
+       91,   74,  113,  113,  113,  197,   74,   75,  109,  109,
+       75,   75,  109,  109,  109,   75,   96,   96,   96,  154,
+
+       75,   90,   90,   90,  196,  194,   96,  154,  194,   96,
+       90,   90,  195,  191,   90,  154,  107,  107,  107,  190,
+       96,  187,  154,   96,   90,   90,  107,  198,   90,  107,
+      198,  114,  114,  114,  127,  127,  127,  128,  128,  128,
+      107,  114,  186,  107,  114,  160,  160,  128,  160,  138,
+      128,  194,  138,  143,  143,  114,  143,  185,  114,  144,
+      144,  128,  144,  215,  128,  138,  138,  138,  215,  143,
+      143,  151,  151,  198,  151,  144,  144,  144,  149,  149,
+      184,  149,  193,  149,  183,  193,  143,  151,  151,  158,
+      158,  193,  158,  182,  149,  149,  149,  153,  153,  181,
+
+      153,  159,  159,  180,  159,  158,  158,  143,  167,  167,
+      176,  167,  175,  153,  153,  153,  174,  159,  159,  159,
+      168,  168,  158,  168,  170,  170,  173,  170,  172,  172,
+      166,  172,  177,  177,  164,  177,  179,  179,  163,  179,
+      170,  170,  162,  158,  172,  172,  172,  192,  201,  204,
+      192,  201,  204,  205,  161,  206,  205,  201,  206,  204,
+      207,  157,  205,  207,  206,  209,  210,  220,  209,  210,
+      212,  213,  220,  212,  213,  209,  210,  214,  217,  212,
+      214,  217,  219,  222,  225,  219,  222,  225,  217,  192,
+      156,  147,  226,  222,  225,  226,  239,  227,  230,  239,
+
+      227,  230,  226,  146,  142,  239,  207,  227,  230,  231,
+      233,  236,  231,  233,  236,  240,  141,  213,  240,  231,
+      233,  236,  241,  214,  240,  241,  242,  245,  219,  242,
+      245,  246,  140,  139,  246,  137,  136,  245,  135,  134,
+      132,  246,  131,  126,  125,  124,  123,  122,  121,  120,
+      118,  117,  112,  111,  104,  103,  102,  241,  101,  100,
+       94,  242,  249,  249,  249,  249,  249,  250,  250,  251,
+      251,  253,   93,  253,  253,  253,  255,  255,  255,   89,
+       88,   81,   80,   79,   78,   77,   67,   63,   62,   61,
+       58,   56,   32,   22,   18,   14,   12,   11,    7,    6,
+
+        5,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248,
+      248,  248,  248,  248,  248,  248,  248,  248,  248,  248
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1422,18 +906,39 @@ static const flex_int16_t yy_chk[1684] =
 #include <limits.h>
 #include "util/strtod.h"
 #include "ast.h"
+#include "glsl_keywords.h"
 #include "glsl_parser_extras.h"
 #include "glsl_parser.h"
 #include "main/mtypes.h"
 
 static int classify_identifier(struct _mesa_glsl_parse_state *, const char *,
 			       unsigned name_len, YYSTYPE *output);
+static int classify_keyword(struct _mesa_glsl_parse_state *,
+			    const struct glsl_keyword *, const char *,
+			    unsigned name_len, YYSTYPE *output,
+			    YYLTYPE *loc);
 
 #ifdef _MSC_VER
 #define YY_NO_UNISTD_H
 #endif
 
 #define YY_NO_INPUT
+
+/* Read the shader a block at a time straight out of the span given to
+ * _mesa_glsl_lexer_ctor(), rather than first copying all of it into a
+ * buffer of the scanner's own.  The span needn't be NUL-terminated.
+ */
+#define YY_INPUT(buf, result, max_size)					\
+   do {									\
+      size_t remaining =						\
+         yyextra->lexer_source_end - yyextra->lexer_source;		\
+      if (remaining > (size_t) (max_size))				\
+         remaining = (max_size);					\
+      memcpy((buf), yyextra->lexer_source, remaining);			\
+      yyextra->lexer_source += remaining;				\
+      (result) = (int) remaining;					\
+   } while (0)
+
 #define YY_USER_ACTION						\
    do {								\
       yylloc->first_column = yycolumn + 1;			\
@@ -1445,109 +950,6 @@ static int classify_identifier(struct _mesa_glsl_parse_state *, const char *,
 #define YY_USER_INIT yylineno = 0; yycolumn = 0; yylloc->source = 0; \
    yylloc->path = NULL;
 
-/* A macro for handling reserved words and keywords across language versions.
- *
- * Certain words start out as identifiers, become reserved words in
- * later language revisions, and finally become language keywords.
- * This may happen at different times in desktop GLSL and GLSL ES.
- *
- * For example, consider the following lexer rule:
- * samplerBuffer       KEYWORD(130, 0, 140, 0, SAMPLERBUFFER)
- *
- * This means that "samplerBuffer" will be treated as:
- * - a keyword (SAMPLERBUFFER token)         ...in GLSL >= 1.40
- * - a reserved word - error                 ...in GLSL >= 1.30
- * - an identifier                           ...in GLSL <  1.30 or GLSL ES
- */
-#define KEYWORD(reserved_glsl, reserved_glsl_es,			\
-                allowed_glsl, allowed_glsl_es, token)			\
-   KEYWORD_WITH_ALT(reserved_glsl, reserved_glsl_es,			\
-                    allowed_glsl, allowed_glsl_es, false, token)
-
-/**
- * Like the KEYWORD macro, but the word is also treated as a keyword
- * if the given boolean expression is true.
- */
-#define KEYWORD_WITH_ALT(reserved_glsl, reserved_glsl_es,		\
-                         allowed_glsl, allowed_glsl_es,			\
-                         alt_expr, token)				\
-   do {									\
-      if (yyextra->is_version(allowed_glsl, allowed_glsl_es)		\
-          || (alt_expr)) {						\
-	 return token;							\
-      } else if (yyextra->is_version(reserved_glsl,			\
-                                     reserved_glsl_es)) {		\
-	 _mesa_glsl_error(yylloc, yyextra,				\
-			  "illegal use of reserved word `%s'", yytext);	\
-	 return ERROR_TOK;						\
-      } else {								\
-	 return classify_identifier(yyextra, yytext, yyleng, yylval);	\
-      }									\
-   } while (0)
-
-/**
- * Like KEYWORD_WITH_ALT, but used for built-in GLSL types
- */
-#define TYPE_WITH_ALT(reserved_glsl, reserved_glsl_es,			\
-		      allowed_glsl, allowed_glsl_es,			\
-		      alt_expr, gtype)					\
-   do {									\
-      if (yyextra->is_version(allowed_glsl, allowed_glsl_es)		\
-          || (alt_expr)) {						\
-	 yylval->type = gtype; 						\
-	 return BASIC_TYPE_TOK;						\
-      } else if (yyextra->is_version(reserved_glsl,			\
-                                     reserved_glsl_es)) {		\
-	 _mesa_glsl_error(yylloc, yyextra,				\
-			  "illegal use of reserved word `%s'", yytext);	\
-	 return ERROR_TOK;						\
-      } else {								\
-	 return classify_identifier(yyextra, yytext, yyleng, yylval);	\
-      }									\
-   } while (0)
-
-#define TYPE(reserved_glsl, reserved_glsl_es,				\
-             allowed_glsl, allowed_glsl_es,				\
-             gtype)							\
-   TYPE_WITH_ALT(reserved_glsl, reserved_glsl_es,			\
-                 allowed_glsl, allowed_glsl_es,				\
-                 false, gtype)
-
-/**
- * A macro for handling keywords that have been present in GLSL since
- * its origin, but were changed into reserved words in GLSL 3.00 ES.
- */
-#define DEPRECATED_ES_KEYWORD(token)					\
-   do {									\
-      if (yyextra->is_version(0, 300)) {				\
-	 _mesa_glsl_error(yylloc, yyextra,				\
-			  "illegal use of reserved word `%s'", yytext);	\
-	 return ERROR_TOK;						\
-      } else {								\
-         return token;							\
-      }									\
-   } while (0)
-
-/**
- * Like DEPRECATED_ES_KEYWORD, but for types
- */
-#define DEPRECATED_ES_TYPE_WITH_ALT(alt_expr, gtype)			\
-   do {									\
-      if (yyextra->is_version(0, 300)) {				\
-         _mesa_glsl_error(yylloc, yyextra,				\
-                          "illegal use of reserved word `%s'", yytext);	\
-         return ERROR_TOK;						\
-      } else if (alt_expr) {						\
-         yylval->type = gtype;						\
-         return BASIC_TYPE_TOK;						\
-      } else {								\
-         return classify_identifier(yyextra, yytext, yyleng, yylval);	\
-      }									\
-   } while (0)
-
-#define DEPRECATED_ES_TYPE(gtype)					\
-   DEPRECATED_ES_TYPE_WITH_ALT(true, gtype)
-
 static int
 literal_integer(char *text, int len, struct _mesa_glsl_parse_state *state,
 		YYSTYPE *lval, YYLTYPE *lloc, int base)
@@ -1603,13 +1005,13 @@ literal_integer(char *text, int len, struct _mesa_glsl_parse_state *state,
 #define LITERAL_INTEGER(base) \
    literal_integer(yytext, yyleng, yyextra, yylval, yylloc, base)
 
-#line 1606 "glsl_lexer.cpp"
-#line 219 "glsl_lexer.ll"
+#line 1008 "glsl_lexer.cpp"
+#line 137 "glsl_lexer.ll"
 	/* Note: When adding any start conditions to this list, you must also
 	 * update the "Internal compiler error" catch-all rule near the end of
 	 * this file. */
 
-#line 1612 "glsl_lexer.cpp"
+#line 1014 "glsl_lexer.cpp"
 
 #define INITIAL 0
 #define PP 1
@@ -1894,10 +1296,10 @@ YY_DECL
 		}
 
 	{
-#line 232 "glsl_lexer.ll"
+#line 150 "glsl_lexer.ll"
 
 
-#line 1900 "glsl_lexer.cpp"
+#line 1302 "glsl_lexer.cpp"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1925,13 +1327,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1112 )
+				if ( yy_current_state >= 249 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1111 );
+		while ( yy_current_state != 248 );
 		yy_cp = yyg->yy_last_accepting_cpos;
 		yy_current_state = yyg->yy_last_accepting_state;
 
@@ -1953,7 +1355,7 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 234 "glsl_lexer.ll"
+#line 152 "glsl_lexer.ll"
 ;
 	YY_BREAK
 /* Preprocessor tokens. */ 
@@ -1962,22 +1364,22 @@ case 2:
 yyg->yy_c_buf_p = yy_cp -= 1;
 YY_DO_BEFORE_ACTION; /* set up yytext again */
 YY_RULE_SETUP
-#line 237 "glsl_lexer.ll"
+#line 155 "glsl_lexer.ll"
 ;
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 238 "glsl_lexer.ll"
+#line 156 "glsl_lexer.ll"
 { BEGIN PP; return VERSION_TOK; }
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 239 "glsl_lexer.ll"
+#line 157 "glsl_lexer.ll"
 { BEGIN PP; return EXTENSION; }
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 240 "glsl_lexer.ll"
+#line 158 "glsl_lexer.ll"
 {
                                   if (!yyextra->ARB_shading_language_include_enable) {
                                      struct _mesa_glsl_parse_state *state = yyextra;
@@ -1992,7 +1394,7 @@ case 6:
 yyg->yy_c_buf_p = yy_cp -= 1;
 YY_DO_BEFORE_ACTION; /* set up yytext again */
 YY_RULE_SETUP
-#line 248 "glsl_lexer.ll"
+#line 166 "glsl_lexer.ll"
 {
 				   /* Eat characters until the first digit is
 				    * encountered
@@ -2024,7 +1426,7 @@ case 7:
 yyg->yy_c_buf_p = yy_cp -= 1;
 YY_DO_BEFORE_ACTION; /* set up yytext again */
 YY_RULE_SETUP
-#line 273 "glsl_lexer.ll"
+#line 191 "glsl_lexer.ll"
 {
                                    if (!yyextra->ARB_shading_language_include_enable) {
                                       struct _mesa_glsl_parse_state *state = yyextra;
@@ -2062,7 +1464,7 @@ YY_RULE_SETUP
 
                                    char *end = strrchr(ptr, '"');
                                    int path_len = (end - ptr) + 1;
-                                   void *mem_ctx = yyextra->linalloc;
+                                   void *mem_ctx = yyextra->global_linalloc; /* outlives the AST of a function */
                                    yylloc->path = (char *) linear_alloc_child(mem_ctx, path_len);
                                    memcpy(yylloc->path, ptr, path_len);
                                    yylloc->path[path_len - 1] = '\0';
@@ -2073,7 +1475,7 @@ case 8:
 yyg->yy_c_buf_p = yy_cp -= 1;
 YY_DO_BEFORE_ACTION; /* set up yytext again */
 YY_RULE_SETUP
-#line 315 "glsl_lexer.ll"
+#line 233 "glsl_lexer.ll"
 {
 				   /* Eat characters until the first digit is
 				    * encountered
@@ -2099,7 +1501,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 337 "glsl_lexer.ll"
+#line 255 "glsl_lexer.ll"
 {
 				  BEGIN PP;
 				  return PRAGMA_DEBUG_ON;
@@ -2107,7 +1509,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 341 "glsl_lexer.ll"
+#line 259 "glsl_lexer.ll"
 {
 				  BEGIN PP;
 				  return PRAGMA_DEBUG_OFF;
@@ -2115,7 +1517,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 345 "glsl_lexer.ll"
+#line 263 "glsl_lexer.ll"
 {
 				  BEGIN PP;
 				  return PRAGMA_OPTIMIZE_ON;
@@ -2123,7 +1525,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 349 "glsl_lexer.ll"
+#line 267 "glsl_lexer.ll"
 {
 				  BEGIN PP;
 				  return PRAGMA_OPTIMIZE_OFF;
@@ -2131,7 +1533,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 353 "glsl_lexer.ll"
+#line 271 "glsl_lexer.ll"
 {
 				  BEGIN PP;
 				  return PRAGMA_WARNING_ON;
@@ -2139,7 +1541,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 357 "glsl_lexer.ll"
+#line 275 "glsl_lexer.ll"
 {
 				  BEGIN PP;
 				  return PRAGMA_WARNING_OFF;
@@ -2147,7 +1549,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 361 "glsl_lexer.ll"
+#line 279 "glsl_lexer.ll"
 {
 				  BEGIN PP;
 				  return PRAGMA_INVARIANT_ALL;
@@ -2155,920 +1557,218 @@ YY_RULE_SETUP
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 365 "glsl_lexer.ll"
+#line 283 "glsl_lexer.ll"
 { BEGIN PRAGMA; }
 	YY_BREAK
 case 17:
 /* rule 17 can match eol */
 YY_RULE_SETUP
-#line 367 "glsl_lexer.ll"
+#line 285 "glsl_lexer.ll"
 { BEGIN 0; yylineno++; yycolumn = 0; }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 368 "glsl_lexer.ll"
+#line 286 "glsl_lexer.ll"
 { }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 370 "glsl_lexer.ll"
+#line 288 "glsl_lexer.ll"
 { }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 371 "glsl_lexer.ll"
-{ }
-	YY_BREAK
-case 21:
-YY_RULE_SETUP
-#line 372 "glsl_lexer.ll"
-return COLON;
-	YY_BREAK
-case 22:
-YY_RULE_SETUP
-#line 373 "glsl_lexer.ll"
-{
-				   /* We're not doing linear_strdup here, to avoid an implicit call
-				    * on strlen() for the length of the string, as this is already
-				    * found by flex and stored in yyleng
-				    */
-                                    void *mem_ctx = yyextra->linalloc;
-                                    char *id = (char *) linear_alloc_child(mem_ctx, yyleng + 1);
-                                    memcpy(id, yytext, yyleng + 1);
-                                    yylval->identifier = id;
-				   return IDENTIFIER;
-				}
-	YY_BREAK
-case 23:
-YY_RULE_SETUP
-#line 384 "glsl_lexer.ll"
-{
-				    yylval->n = strtol(yytext, NULL, 10);
-				    return INTCONSTANT;
-				}
-	YY_BREAK
-case 24:
-YY_RULE_SETUP
-#line 388 "glsl_lexer.ll"
-{
-				    yylval->n = 0;
-				    return INTCONSTANT;
-				}
-	YY_BREAK
-case 25:
-/* rule 25 can match eol */
-YY_RULE_SETUP
-#line 392 "glsl_lexer.ll"
-{ BEGIN 0; yylineno++; yycolumn = 0; return EOL; }
-	YY_BREAK
-case 26:
-YY_RULE_SETUP
-#line 393 "glsl_lexer.ll"
-{ return yytext[0]; }
-	YY_BREAK
-case 27:
-/* rule 27 can match eol */
-YY_RULE_SETUP
-#line 395 "glsl_lexer.ll"
-{ yylineno++; yycolumn = 0; }
-	YY_BREAK
-case 28:
-YY_RULE_SETUP
-#line 397 "glsl_lexer.ll"
-DEPRECATED_ES_KEYWORD(ATTRIBUTE);
-	YY_BREAK
-case 29:
-YY_RULE_SETUP
-#line 398 "glsl_lexer.ll"
-return CONST_TOK;
-	YY_BREAK
-case 30:
-YY_RULE_SETUP
-#line 399 "glsl_lexer.ll"
-{ yylval->type = glsl_type::bool_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 31:
-YY_RULE_SETUP
-#line 400 "glsl_lexer.ll"
-{ yylval->type = glsl_type::float_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 32:
-YY_RULE_SETUP
-#line 401 "glsl_lexer.ll"
-{ yylval->type = glsl_type::int_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 33:
-YY_RULE_SETUP
-#line 402 "glsl_lexer.ll"
-TYPE(130, 300, 130, 300, glsl_type::uint_type);
-	YY_BREAK
-case 34:
-YY_RULE_SETUP
-#line 404 "glsl_lexer.ll"
-return BREAK;
-	YY_BREAK
-case 35:
-YY_RULE_SETUP
-#line 405 "glsl_lexer.ll"
-return CONTINUE;
-	YY_BREAK
-case 36:
-YY_RULE_SETUP
-#line 406 "glsl_lexer.ll"
-return DO;
-	YY_BREAK
-case 37:
-YY_RULE_SETUP
-#line 407 "glsl_lexer.ll"
-return WHILE;
-	YY_BREAK
-case 38:
-YY_RULE_SETUP
-#line 408 "glsl_lexer.ll"
-return ELSE;
-	YY_BREAK
-case 39:
-YY_RULE_SETUP
-#line 409 "glsl_lexer.ll"
-return FOR;
-	YY_BREAK
-case 40:
-YY_RULE_SETUP
-#line 410 "glsl_lexer.ll"
-return IF;
-	YY_BREAK
-case 41:
-YY_RULE_SETUP
-#line 411 "glsl_lexer.ll"
-return DISCARD;
-	YY_BREAK
-case 42:
-YY_RULE_SETUP
-#line 412 "glsl_lexer.ll"
-return RETURN;
-	YY_BREAK
-case 43:
-YY_RULE_SETUP
-#line 413 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(0, 0, 0, 0, yyextra->EXT_demote_to_helper_invocation_enable, DEMOTE);
-	YY_BREAK
-case 44:
-YY_RULE_SETUP
-#line 415 "glsl_lexer.ll"
-{ yylval->type = glsl_type::bvec2_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 45:
-YY_RULE_SETUP
-#line 416 "glsl_lexer.ll"
-{ yylval->type = glsl_type::bvec3_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 46:
-YY_RULE_SETUP
-#line 417 "glsl_lexer.ll"
-{ yylval->type = glsl_type::bvec4_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 47:
-YY_RULE_SETUP
-#line 418 "glsl_lexer.ll"
-{ yylval->type = glsl_type::ivec2_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 48:
-YY_RULE_SETUP
-#line 419 "glsl_lexer.ll"
-{ yylval->type = glsl_type::ivec3_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 49:
-YY_RULE_SETUP
-#line 420 "glsl_lexer.ll"
-{ yylval->type = glsl_type::ivec4_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 50:
-YY_RULE_SETUP
-#line 421 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable, glsl_type::uvec2_type);
-	YY_BREAK
-case 51:
-YY_RULE_SETUP
-#line 422 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable, glsl_type::uvec3_type);
-	YY_BREAK
-case 52:
-YY_RULE_SETUP
-#line 423 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable, glsl_type::uvec4_type);
-	YY_BREAK
-case 53:
-YY_RULE_SETUP
-#line 424 "glsl_lexer.ll"
-{ yylval->type = glsl_type::vec2_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 54:
-YY_RULE_SETUP
-#line 425 "glsl_lexer.ll"
-{ yylval->type = glsl_type::vec3_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 55:
-YY_RULE_SETUP
-#line 426 "glsl_lexer.ll"
-{ yylval->type = glsl_type::vec4_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 56:
-YY_RULE_SETUP
-#line 427 "glsl_lexer.ll"
-{ yylval->type = glsl_type::mat2_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 57:
-YY_RULE_SETUP
-#line 428 "glsl_lexer.ll"
-{ yylval->type = glsl_type::mat3_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 58:
-YY_RULE_SETUP
-#line 429 "glsl_lexer.ll"
-{ yylval->type = glsl_type::mat4_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 59:
-YY_RULE_SETUP
-#line 430 "glsl_lexer.ll"
-TYPE(120, 300, 120, 300, glsl_type::mat2_type);
-	YY_BREAK
-case 60:
-YY_RULE_SETUP
-#line 431 "glsl_lexer.ll"
-TYPE(120, 300, 120, 300, glsl_type::mat2x3_type);
-	YY_BREAK
-case 61:
-YY_RULE_SETUP
-#line 432 "glsl_lexer.ll"
-TYPE(120, 300, 120, 300, glsl_type::mat2x4_type);
-	YY_BREAK
-case 62:
-YY_RULE_SETUP
-#line 433 "glsl_lexer.ll"
-TYPE(120, 300, 120, 300, glsl_type::mat3x2_type);
-	YY_BREAK
-case 63:
-YY_RULE_SETUP
-#line 434 "glsl_lexer.ll"
-TYPE(120, 300, 120, 300, glsl_type::mat3_type);
-	YY_BREAK
-case 64:
-YY_RULE_SETUP
-#line 435 "glsl_lexer.ll"
-TYPE(120, 300, 120, 300, glsl_type::mat3x4_type);
-	YY_BREAK
-case 65:
-YY_RULE_SETUP
-#line 436 "glsl_lexer.ll"
-TYPE(120, 300, 120, 300, glsl_type::mat4x2_type);
-	YY_BREAK
-case 66:
-YY_RULE_SETUP
-#line 437 "glsl_lexer.ll"
-TYPE(120, 300, 120, 300, glsl_type::mat4x3_type);
-	YY_BREAK
-case 67:
-YY_RULE_SETUP
-#line 438 "glsl_lexer.ll"
-TYPE(120, 300, 120, 300, glsl_type::mat4_type);
-	YY_BREAK
-case 68:
-YY_RULE_SETUP
-#line 440 "glsl_lexer.ll"
-return IN_TOK;
-	YY_BREAK
-case 69:
-YY_RULE_SETUP
-#line 441 "glsl_lexer.ll"
-return OUT_TOK;
-	YY_BREAK
-case 70:
-YY_RULE_SETUP
-#line 442 "glsl_lexer.ll"
-return INOUT_TOK;
-	YY_BREAK
-case 71:
-YY_RULE_SETUP
-#line 443 "glsl_lexer.ll"
-return UNIFORM;
-	YY_BREAK
-case 72:
-YY_RULE_SETUP
-#line 444 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(0, 0, 430, 310, yyextra->ARB_shader_storage_buffer_object_enable, BUFFER);
-	YY_BREAK
-case 73:
-YY_RULE_SETUP
-#line 445 "glsl_lexer.ll"
-DEPRECATED_ES_KEYWORD(VARYING);
-	YY_BREAK
-case 74:
-YY_RULE_SETUP
-#line 446 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(120, 300, 120, 300, yyextra->EXT_gpu_shader4_enable, CENTROID);
-	YY_BREAK
-case 75:
-YY_RULE_SETUP
-#line 447 "glsl_lexer.ll"
-KEYWORD(120, 100, 120, 100, INVARIANT);
-	YY_BREAK
-case 76:
-YY_RULE_SETUP
-#line 448 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(130, 100, 130, 300, yyextra->EXT_gpu_shader4_enable, FLAT);
-	YY_BREAK
-case 77:
-YY_RULE_SETUP
-#line 449 "glsl_lexer.ll"
-KEYWORD(130, 300, 130, 300, SMOOTH);
-	YY_BREAK
-case 78:
-YY_RULE_SETUP
-#line 450 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(130, 300, 130, 0, yyextra->EXT_gpu_shader4_enable, NOPERSPECTIVE);
-	YY_BREAK
-case 79:
-YY_RULE_SETUP
-#line 451 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(0, 300, 400, 320, yyextra->has_tessellation_shader(), PATCH);
-	YY_BREAK
-case 80:
-YY_RULE_SETUP
-#line 453 "glsl_lexer.ll"
-DEPRECATED_ES_TYPE(glsl_type::sampler1D_type);
-	YY_BREAK
-case 81:
-YY_RULE_SETUP
-#line 454 "glsl_lexer.ll"
-{ yylval->type = glsl_type::sampler2D_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 82:
-YY_RULE_SETUP
-#line 455 "glsl_lexer.ll"
-{ yylval->type = glsl_type::sampler3D_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 83:
-YY_RULE_SETUP
-#line 456 "glsl_lexer.ll"
-{ yylval->type = glsl_type::samplerCube_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 84:
-YY_RULE_SETUP
-#line 457 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 0,   yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_array, glsl_type::sampler1DArray_type);
-	YY_BREAK
-case 85:
-YY_RULE_SETUP
-#line 458 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_array, glsl_type::sampler2DArray_type);
-	YY_BREAK
-case 86:
-YY_RULE_SETUP
-#line 459 "glsl_lexer.ll"
-DEPRECATED_ES_TYPE(glsl_type::sampler1DShadow_type);
-	YY_BREAK
-case 87:
-YY_RULE_SETUP
-#line 460 "glsl_lexer.ll"
-{ yylval->type = glsl_type::sampler2DShadow_type; return BASIC_TYPE_TOK; }
-	YY_BREAK
-case 88:
-YY_RULE_SETUP
-#line 461 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable, glsl_type::samplerCubeShadow_type);
-	YY_BREAK
-case 89:
-YY_RULE_SETUP
-#line 462 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 0,   yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_array, glsl_type::sampler1DArrayShadow_type);
-	YY_BREAK
-case 90:
-YY_RULE_SETUP
-#line 463 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_array, glsl_type::sampler2DArrayShadow_type);
-	YY_BREAK
-case 91:
-YY_RULE_SETUP
-#line 464 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 0,   yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_integer, glsl_type::isampler1D_type);
-	YY_BREAK
-case 92:
-YY_RULE_SETUP
-#line 465 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_integer, glsl_type::isampler2D_type);
-	YY_BREAK
-case 93:
-YY_RULE_SETUP
-#line 466 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_integer, glsl_type::isampler3D_type);
-	YY_BREAK
-case 94:
-YY_RULE_SETUP
-#line 467 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_integer, glsl_type::isamplerCube_type);
-	YY_BREAK
-case 95:
-YY_RULE_SETUP
-#line 468 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 0,   yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_integer && yyextra->ctx->Extensions.EXT_texture_array, glsl_type::isampler1DArray_type);
-	YY_BREAK
-case 96:
-YY_RULE_SETUP
-#line 469 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_integer && yyextra->ctx->Extensions.EXT_texture_array, glsl_type::isampler2DArray_type);
-	YY_BREAK
-case 97:
-YY_RULE_SETUP
-#line 470 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 0,   yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_integer, glsl_type::usampler1D_type);
-	YY_BREAK
-case 98:
-YY_RULE_SETUP
-#line 471 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_integer, glsl_type::usampler2D_type);
-	YY_BREAK
-case 99:
-YY_RULE_SETUP
-#line 472 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_integer, glsl_type::usampler3D_type);
-	YY_BREAK
-case 100:
-YY_RULE_SETUP
-#line 473 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_integer, glsl_type::usamplerCube_type);
-	YY_BREAK
-case 101:
-YY_RULE_SETUP
-#line 474 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 0,   yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_integer && yyextra->ctx->Extensions.EXT_texture_array, glsl_type::usampler1DArray_type);
-	YY_BREAK
-case 102:
-YY_RULE_SETUP
-#line 475 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 130, 300, yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_integer && yyextra->ctx->Extensions.EXT_texture_array, glsl_type::usampler2DArray_type);
-	YY_BREAK
-/* additional keywords in ARB_texture_multisample, included in GLSL 1.50 */
-/* these are reserved but not defined in GLSL 3.00 */
-/* [iu]sampler2DMS are defined in GLSL ES 3.10 */
-case 103:
-YY_RULE_SETUP
-#line 480 "glsl_lexer.ll"
-TYPE_WITH_ALT(150, 300, 150, 310, yyextra->ARB_texture_multisample_enable, glsl_type::sampler2DMS_type);
-	YY_BREAK
-case 104:
-YY_RULE_SETUP
-#line 481 "glsl_lexer.ll"
-TYPE_WITH_ALT(150, 300, 150, 310, yyextra->ARB_texture_multisample_enable, glsl_type::isampler2DMS_type);
-	YY_BREAK
-case 105:
-YY_RULE_SETUP
-#line 482 "glsl_lexer.ll"
-TYPE_WITH_ALT(150, 300, 150, 310, yyextra->ARB_texture_multisample_enable, glsl_type::usampler2DMS_type);
-	YY_BREAK
-case 106:
-YY_RULE_SETUP
-#line 483 "glsl_lexer.ll"
-TYPE_WITH_ALT(150, 300, 150, 320, yyextra->ARB_texture_multisample_enable || yyextra->OES_texture_storage_multisample_2d_array_enable, glsl_type::sampler2DMSArray_type);
-	YY_BREAK
-case 107:
-YY_RULE_SETUP
-#line 484 "glsl_lexer.ll"
-TYPE_WITH_ALT(150, 300, 150, 320, yyextra->ARB_texture_multisample_enable || yyextra->OES_texture_storage_multisample_2d_array_enable, glsl_type::isampler2DMSArray_type);
-	YY_BREAK
-case 108:
-YY_RULE_SETUP
-#line 485 "glsl_lexer.ll"
-TYPE_WITH_ALT(150, 300, 150, 320, yyextra->ARB_texture_multisample_enable || yyextra->OES_texture_storage_multisample_2d_array_enable, glsl_type::usampler2DMSArray_type);
-	YY_BREAK
-/* keywords available with ARB_texture_cube_map_array_enable extension on desktop GLSL */
-case 109:
-YY_RULE_SETUP
-#line 488 "glsl_lexer.ll"
-TYPE_WITH_ALT(400, 310, 400, 320, yyextra->ARB_texture_cube_map_array_enable || yyextra->OES_texture_cube_map_array_enable || yyextra->EXT_texture_cube_map_array_enable, glsl_type::samplerCubeArray_type);
-	YY_BREAK
-case 110:
-YY_RULE_SETUP
-#line 489 "glsl_lexer.ll"
-TYPE_WITH_ALT(400, 310, 400, 320, yyextra->ARB_texture_cube_map_array_enable || yyextra->OES_texture_cube_map_array_enable || yyextra->EXT_texture_cube_map_array_enable, glsl_type::isamplerCubeArray_type);
-	YY_BREAK
-case 111:
-YY_RULE_SETUP
-#line 490 "glsl_lexer.ll"
-TYPE_WITH_ALT(400, 310, 400, 320, yyextra->ARB_texture_cube_map_array_enable || yyextra->OES_texture_cube_map_array_enable || yyextra->EXT_texture_cube_map_array_enable, glsl_type::usamplerCubeArray_type);
-	YY_BREAK
-case 112:
-YY_RULE_SETUP
-#line 491 "glsl_lexer.ll"
-TYPE_WITH_ALT(400, 310, 400, 320, yyextra->ARB_texture_cube_map_array_enable || yyextra->OES_texture_cube_map_array_enable || yyextra->EXT_texture_cube_map_array_enable, glsl_type::samplerCubeArrayShadow_type);
-	YY_BREAK
-case 113:
-YY_RULE_SETUP
-#line 493 "glsl_lexer.ll"
-{
-			  if (yyextra->OES_EGL_image_external_enable || yyextra->OES_EGL_image_external_essl3_enable) {
-			     yylval->type = glsl_type::samplerExternalOES_type;
-			     return BASIC_TYPE_TOK;
-			  } else
-			     return IDENTIFIER;
-		}
-	YY_BREAK
-/* keywords available with ARB_gpu_shader5 */
-case 114:
-YY_RULE_SETUP
-#line 502 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(400, 310, 400, 320, yyextra->ARB_gpu_shader5_enable || yyextra->EXT_gpu_shader5_enable || yyextra->OES_gpu_shader5_enable, PRECISE);
-	YY_BREAK
-/* keywords available with ARB_shader_image_load_store */
-case 115:
-YY_RULE_SETUP
-#line 505 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::image1D_type);
-	YY_BREAK
-case 116:
-YY_RULE_SETUP
-#line 506 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::image2D_type);
-	YY_BREAK
-case 117:
-YY_RULE_SETUP
-#line 507 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::image3D_type);
-	YY_BREAK
-case 118:
-YY_RULE_SETUP
-#line 508 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::image2DRect_type);
-	YY_BREAK
-case 119:
-YY_RULE_SETUP
-#line 509 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::imageCube_type);
-	YY_BREAK
-case 120:
-YY_RULE_SETUP
-#line 510 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 320, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable || yyextra->EXT_texture_buffer_enable || yyextra->OES_texture_buffer_enable, glsl_type::imageBuffer_type);
-	YY_BREAK
-case 121:
-YY_RULE_SETUP
-#line 511 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::image1DArray_type);
-	YY_BREAK
-case 122:
-YY_RULE_SETUP
-#line 512 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::image2DArray_type);
-	YY_BREAK
-case 123:
-YY_RULE_SETUP
-#line 513 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 320, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable || yyextra->OES_texture_cube_map_array_enable || yyextra->EXT_texture_cube_map_array_enable, glsl_type::imageCubeArray_type);
-	YY_BREAK
-case 124:
-YY_RULE_SETUP
-#line 514 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::image2DMS_type);
-	YY_BREAK
-case 125:
-YY_RULE_SETUP
-#line 515 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::image2DMSArray_type);
-	YY_BREAK
-case 126:
-YY_RULE_SETUP
-#line 516 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::iimage1D_type);
-	YY_BREAK
-case 127:
-YY_RULE_SETUP
-#line 517 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::iimage2D_type);
-	YY_BREAK
-case 128:
-YY_RULE_SETUP
-#line 518 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::iimage3D_type);
-	YY_BREAK
-case 129:
-YY_RULE_SETUP
-#line 519 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::iimage2DRect_type);
-	YY_BREAK
-case 130:
-YY_RULE_SETUP
-#line 520 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::iimageCube_type);
-	YY_BREAK
-case 131:
-YY_RULE_SETUP
-#line 521 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 320, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable || yyextra->EXT_texture_buffer_enable || yyextra->OES_texture_buffer_enable, glsl_type::iimageBuffer_type);
-	YY_BREAK
-case 132:
-YY_RULE_SETUP
-#line 522 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::iimage1DArray_type);
-	YY_BREAK
-case 133:
-YY_RULE_SETUP
-#line 523 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::iimage2DArray_type);
-	YY_BREAK
-case 134:
-YY_RULE_SETUP
-#line 524 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 320, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable || yyextra->OES_texture_cube_map_array_enable || yyextra->EXT_texture_cube_map_array_enable, glsl_type::iimageCubeArray_type);
-	YY_BREAK
-case 135:
-YY_RULE_SETUP
-#line 525 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::iimage2DMS_type);
-	YY_BREAK
-case 136:
-YY_RULE_SETUP
-#line 526 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::iimage2DMSArray_type);
-	YY_BREAK
-case 137:
-YY_RULE_SETUP
-#line 527 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::uimage1D_type);
-	YY_BREAK
-case 138:
-YY_RULE_SETUP
-#line 528 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::uimage2D_type);
-	YY_BREAK
-case 139:
-YY_RULE_SETUP
-#line 529 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::uimage3D_type);
-	YY_BREAK
-case 140:
-YY_RULE_SETUP
-#line 530 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::uimage2DRect_type);
-	YY_BREAK
-case 141:
-YY_RULE_SETUP
-#line 531 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::uimageCube_type);
-	YY_BREAK
-case 142:
-YY_RULE_SETUP
-#line 532 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 320, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable || yyextra->EXT_texture_buffer_enable || yyextra->OES_texture_buffer_enable, glsl_type::uimageBuffer_type);
-	YY_BREAK
-case 143:
-YY_RULE_SETUP
-#line 533 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::uimage1DArray_type);
-	YY_BREAK
-case 144:
-YY_RULE_SETUP
-#line 534 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::uimage2DArray_type);
-	YY_BREAK
-case 145:
-YY_RULE_SETUP
-#line 535 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 320, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable || yyextra->OES_texture_cube_map_array_enable || yyextra->EXT_texture_cube_map_array_enable, glsl_type::uimageCubeArray_type);
-	YY_BREAK
-case 146:
-YY_RULE_SETUP
-#line 536 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::uimage2DMS_type);
-	YY_BREAK
-case 147:
-YY_RULE_SETUP
-#line 537 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 420, 0, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable, glsl_type::uimage2DMSArray_type);
-	YY_BREAK
-case 148:
-YY_RULE_SETUP
-#line 538 "glsl_lexer.ll"
-KEYWORD(130, 300, 0, 0, IMAGE1DSHADOW);
-	YY_BREAK
-case 149:
-YY_RULE_SETUP
-#line 539 "glsl_lexer.ll"
-KEYWORD(130, 300, 0, 0, IMAGE2DSHADOW);
-	YY_BREAK
-case 150:
-YY_RULE_SETUP
-#line 540 "glsl_lexer.ll"
-KEYWORD(130, 300, 0, 0, IMAGE1DARRAYSHADOW);
-	YY_BREAK
-case 151:
-YY_RULE_SETUP
-#line 541 "glsl_lexer.ll"
-KEYWORD(130, 300, 0, 0, IMAGE2DARRAYSHADOW);
-	YY_BREAK
-case 152:
-YY_RULE_SETUP
-#line 543 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(420, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable || yyextra->ARB_shader_storage_buffer_object_enable, COHERENT);
-	YY_BREAK
-case 153:
-YY_RULE_SETUP
-#line 544 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(110, 100, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable || yyextra->ARB_shader_storage_buffer_object_enable, VOLATILE);
-	YY_BREAK
-case 154:
-YY_RULE_SETUP
-#line 545 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(420, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->EXT_shader_image_load_store_enable || yyextra->ARB_shader_storage_buffer_object_enable, RESTRICT);
+#line 289 "glsl_lexer.ll"
+{ }
 	YY_BREAK
-case 155:
+case 21:
 YY_RULE_SETUP
-#line 546 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(420, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->ARB_shader_storage_buffer_object_enable, READONLY);
+#line 290 "glsl_lexer.ll"
+return COLON;
 	YY_BREAK
-case 156:
+case 22:
 YY_RULE_SETUP
-#line 547 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(420, 300, 420, 310, yyextra->ARB_shader_image_load_store_enable || yyextra->ARB_shader_storage_buffer_object_enable, WRITEONLY);
+#line 291 "glsl_lexer.ll"
+{
+				   /* We're not doing linear_strdup here, to avoid an implicit call
+				    * on strlen() for the length of the string, as this is already
+				    * found by flex and stored in yyleng
+				    */
+                                    void *mem_ctx = yyextra->linalloc;
+                                    char *id = (char *) linear_alloc_child(mem_ctx, yyleng + 1);
+                                    memcpy(id, yytext, yyleng + 1);
+                                    yylval->identifier = id;
+				   return IDENTIFIER;
+				}
 	YY_BREAK
-case 157:
+case 23:
 YY_RULE_SETUP
-#line 549 "glsl_lexer.ll"
-TYPE_WITH_ALT(420, 300, 420, 310, yyextra->ARB_shader_atomic_counters_enable, glsl_type::atomic_uint_type);
+#line 302 "glsl_lexer.ll"
+{
+				    yylval->n = strtol(yytext, NULL, 10);
+				    return INTCONSTANT;
+				}
 	YY_BREAK
-case 158:
+case 24:
 YY_RULE_SETUP
-#line 551 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(430, 310, 430, 310, yyextra->ARB_compute_shader_enable, SHARED);
+#line 306 "glsl_lexer.ll"
+{
+				    yylval->n = 0;
+				    return INTCONSTANT;
+				}
 	YY_BREAK
-case 159:
+case 25:
+/* rule 25 can match eol */
 YY_RULE_SETUP
-#line 553 "glsl_lexer.ll"
-return STRUCT;
+#line 310 "glsl_lexer.ll"
+{ BEGIN 0; yylineno++; yycolumn = 0; return EOL; }
 	YY_BREAK
-case 160:
+case 26:
 YY_RULE_SETUP
-#line 554 "glsl_lexer.ll"
-return VOID_TOK;
+#line 311 "glsl_lexer.ll"
+{ return yytext[0]; }
 	YY_BREAK
-case 161:
+case 27:
+/* rule 27 can match eol */
 YY_RULE_SETUP
-#line 556 "glsl_lexer.ll"
-{
-		  if ((yyextra->is_version(140, 300))
-		      || yyextra->ARB_bindless_texture_enable
-		      || yyextra->KHR_blend_equation_advanced_enable
-		      || yyextra->AMD_conservative_depth_enable
-		      || yyextra->ARB_conservative_depth_enable
-		      || yyextra->ARB_explicit_attrib_location_enable
-		      || yyextra->ARB_explicit_uniform_location_enable
-                      || yyextra->ARB_post_depth_coverage_enable
-                      || yyextra->has_separate_shader_objects()
-		      || yyextra->ARB_uniform_buffer_object_enable
-		      || yyextra->ARB_fragment_coord_conventions_enable
-                      || yyextra->ARB_shading_language_420pack_enable
-                      || yyextra->ARB_compute_shader_enable
-                      || yyextra->ARB_tessellation_shader_enable
-                      || yyextra->EXT_shader_framebuffer_fetch_non_coherent_enable) {
-		      return LAYOUT_TOK;
-		   } else {
-		      return classify_identifier(yyextra, yytext, yyleng, yylval);
-		   }
-		}
+#line 313 "glsl_lexer.ll"
+{ yylineno++; yycolumn = 0; }
 	YY_BREAK
-case 162:
+case 28:
 YY_RULE_SETUP
-#line 578 "glsl_lexer.ll"
+#line 315 "glsl_lexer.ll"
 return INC_OP;
 	YY_BREAK
-case 163:
+case 29:
 YY_RULE_SETUP
-#line 579 "glsl_lexer.ll"
+#line 316 "glsl_lexer.ll"
 return DEC_OP;
 	YY_BREAK
-case 164:
+case 30:
 YY_RULE_SETUP
-#line 580 "glsl_lexer.ll"
+#line 317 "glsl_lexer.ll"
 return LE_OP;
 	YY_BREAK
-case 165:
+case 31:
 YY_RULE_SETUP
-#line 581 "glsl_lexer.ll"
+#line 318 "glsl_lexer.ll"
 return GE_OP;
 	YY_BREAK
-case 166:
+case 32:
 YY_RULE_SETUP
-#line 582 "glsl_lexer.ll"
+#line 319 "glsl_lexer.ll"
 return EQ_OP;
 	YY_BREAK
-case 167:
+case 33:
 YY_RULE_SETUP
-#line 583 "glsl_lexer.ll"
+#line 320 "glsl_lexer.ll"
 return NE_OP;
 	YY_BREAK
-case 168:
+case 34:
 YY_RULE_SETUP
-#line 584 "glsl_lexer.ll"
+#line 321 "glsl_lexer.ll"
 return AND_OP;
 	YY_BREAK
-case 169:
+case 35:
 YY_RULE_SETUP
-#line 585 "glsl_lexer.ll"
+#line 322 "glsl_lexer.ll"
 return OR_OP;
 	YY_BREAK
-case 170:
+case 36:
 YY_RULE_SETUP
-#line 586 "glsl_lexer.ll"
+#line 323 "glsl_lexer.ll"
 return XOR_OP;
 	YY_BREAK
-case 171:
+case 37:
 YY_RULE_SETUP
-#line 587 "glsl_lexer.ll"
+#line 324 "glsl_lexer.ll"
 return LEFT_OP;
 	YY_BREAK
-case 172:
+case 38:
 YY_RULE_SETUP
-#line 588 "glsl_lexer.ll"
+#line 325 "glsl_lexer.ll"
 return RIGHT_OP;
 	YY_BREAK
-case 173:
+case 39:
 YY_RULE_SETUP
-#line 590 "glsl_lexer.ll"
+#line 327 "glsl_lexer.ll"
 return MUL_ASSIGN;
 	YY_BREAK
-case 174:
+case 40:
 YY_RULE_SETUP
-#line 591 "glsl_lexer.ll"
+#line 328 "glsl_lexer.ll"
 return DIV_ASSIGN;
 	YY_BREAK
-case 175:
+case 41:
 YY_RULE_SETUP
-#line 592 "glsl_lexer.ll"
+#line 329 "glsl_lexer.ll"
 return ADD_ASSIGN;
 	YY_BREAK
-case 176:
+case 42:
 YY_RULE_SETUP
-#line 593 "glsl_lexer.ll"
+#line 330 "glsl_lexer.ll"
 return MOD_ASSIGN;
 	YY_BREAK
-case 177:
+case 43:
 YY_RULE_SETUP
-#line 594 "glsl_lexer.ll"
+#line 331 "glsl_lexer.ll"
 return LEFT_ASSIGN;
 	YY_BREAK
-case 178:
+case 44:
 YY_RULE_SETUP
-#line 595 "glsl_lexer.ll"
+#line 332 "glsl_lexer.ll"
 return RIGHT_ASSIGN;
 	YY_BREAK
-case 179:
+case 45:
 YY_RULE_SETUP
-#line 596 "glsl_lexer.ll"
+#line 333 "glsl_lexer.ll"
 return AND_ASSIGN;
 	YY_BREAK
-case 180:
+case 46:
 YY_RULE_SETUP
-#line 597 "glsl_lexer.ll"
+#line 334 "glsl_lexer.ll"
 return XOR_ASSIGN;
 	YY_BREAK
-case 181:
+case 47:
 YY_RULE_SETUP
-#line 598 "glsl_lexer.ll"
+#line 335 "glsl_lexer.ll"
 return OR_ASSIGN;
 	YY_BREAK
-case 182:
+case 48:
 YY_RULE_SETUP
-#line 599 "glsl_lexer.ll"
+#line 336 "glsl_lexer.ll"
 return SUB_ASSIGN;
 	YY_BREAK
-case 183:
+case 49:
 YY_RULE_SETUP
-#line 601 "glsl_lexer.ll"
+#line 338 "glsl_lexer.ll"
 {
 			    return LITERAL_INTEGER(10);
 			}
 	YY_BREAK
-case 184:
+case 50:
 YY_RULE_SETUP
-#line 604 "glsl_lexer.ll"
+#line 341 "glsl_lexer.ll"
 {
 			    return LITERAL_INTEGER(16);
 			}
 	YY_BREAK
-case 185:
+case 51:
 YY_RULE_SETUP
-#line 607 "glsl_lexer.ll"
+#line 344 "glsl_lexer.ll"
 {
 			    return LITERAL_INTEGER(8);
 			}
 	YY_BREAK
-case 186:
-#line 612 "glsl_lexer.ll"
-case 187:
-#line 613 "glsl_lexer.ll"
-case 188:
-#line 614 "glsl_lexer.ll"
-case 189:
+case 52:
+#line 349 "glsl_lexer.ll"
+case 53:
+#line 350 "glsl_lexer.ll"
+case 54:
+#line 351 "glsl_lexer.ll"
+case 55:
 YY_RULE_SETUP
-#line 614 "glsl_lexer.ll"
+#line 351 "glsl_lexer.ll"
 {
 			    struct _mesa_glsl_parse_state *state = yyextra;
 			    char suffix = yytext[strlen(yytext) - 1];
@@ -3081,15 +1781,15 @@ YY_RULE_SETUP
 			    return FLOATCONSTANT;
 			}
 	YY_BREAK
-case 190:
-#line 627 "glsl_lexer.ll"
-case 191:
-#line 628 "glsl_lexer.ll"
-case 192:
-#line 629 "glsl_lexer.ll"
-case 193:
+case 56:
+#line 364 "glsl_lexer.ll"
+case 57:
+#line 365 "glsl_lexer.ll"
+case 58:
+#line 366 "glsl_lexer.ll"
+case 59:
 YY_RULE_SETUP
-#line 629 "glsl_lexer.ll"
+#line 366 "glsl_lexer.ll"
 {
 			    if (!yyextra->is_version(400, 0) &&
 			        !yyextra->ARB_gpu_shader_fp64_enable)
@@ -3098,438 +1798,18 @@ YY_RULE_SETUP
 			    return DOUBLECONSTANT;
 			}
 	YY_BREAK
-case 194:
-YY_RULE_SETUP
-#line 637 "glsl_lexer.ll"
-{
-			    yylval->n = 1;
-			    return BOOLCONSTANT;
-			}
-	YY_BREAK
-case 195:
-YY_RULE_SETUP
-#line 641 "glsl_lexer.ll"
-{
-			    yylval->n = 0;
-			    return BOOLCONSTANT;
-			}
-	YY_BREAK
-/* Reserved words in GLSL 1.10. */
-case 196:
-YY_RULE_SETUP
-#line 648 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, ASM);
-	YY_BREAK
-case 197:
-YY_RULE_SETUP
-#line 649 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, CLASS);
-	YY_BREAK
-case 198:
-YY_RULE_SETUP
-#line 650 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, UNION);
-	YY_BREAK
-case 199:
-YY_RULE_SETUP
-#line 651 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, ENUM);
-	YY_BREAK
-case 200:
-YY_RULE_SETUP
-#line 652 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, TYPEDEF);
-	YY_BREAK
-case 201:
-YY_RULE_SETUP
-#line 653 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, TEMPLATE);
-	YY_BREAK
-case 202:
-YY_RULE_SETUP
-#line 654 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, THIS);
-	YY_BREAK
-case 203:
-YY_RULE_SETUP
-#line 655 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(110, 100, 140, 300, yyextra->ARB_uniform_buffer_object_enable, PACKED_TOK);
-	YY_BREAK
-case 204:
-YY_RULE_SETUP
-#line 656 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, GOTO);
-	YY_BREAK
-case 205:
-YY_RULE_SETUP
-#line 657 "glsl_lexer.ll"
-KEYWORD(110, 100, 130, 300, SWITCH);
-	YY_BREAK
-case 206:
-YY_RULE_SETUP
-#line 658 "glsl_lexer.ll"
-KEYWORD(110, 100, 130, 300, DEFAULT);
-	YY_BREAK
-case 207:
-YY_RULE_SETUP
-#line 659 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, INLINE_TOK);
-	YY_BREAK
-case 208:
-YY_RULE_SETUP
-#line 660 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, NOINLINE);
-	YY_BREAK
-case 209:
-YY_RULE_SETUP
-#line 661 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, PUBLIC_TOK);
-	YY_BREAK
-case 210:
-YY_RULE_SETUP
-#line 662 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, STATIC);
-	YY_BREAK
-case 211:
-YY_RULE_SETUP
-#line 663 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, EXTERN);
-	YY_BREAK
-case 212:
-YY_RULE_SETUP
-#line 664 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, EXTERNAL);
-	YY_BREAK
-case 213:
-YY_RULE_SETUP
-#line 665 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, INTERFACE);
-	YY_BREAK
-case 214:
-YY_RULE_SETUP
-#line 666 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, LONG_TOK);
-	YY_BREAK
-case 215:
-YY_RULE_SETUP
-#line 667 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, SHORT_TOK);
-	YY_BREAK
-case 216:
-YY_RULE_SETUP
-#line 668 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 100, 130, 300, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::double_type);
-	YY_BREAK
-case 217:
-YY_RULE_SETUP
-#line 669 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, HALF);
-	YY_BREAK
-case 218:
-YY_RULE_SETUP
-#line 670 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, FIXED_TOK);
-	YY_BREAK
-case 219:
-YY_RULE_SETUP
-#line 671 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(110, 100, 0, 0, yyextra->EXT_gpu_shader4_enable, UNSIGNED);
-	YY_BREAK
-case 220:
-YY_RULE_SETUP
-#line 672 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, INPUT_TOK);
-	YY_BREAK
-case 221:
-YY_RULE_SETUP
-#line 673 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, OUTPUT);
-	YY_BREAK
-case 222:
-YY_RULE_SETUP
-#line 674 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, HVEC2);
-	YY_BREAK
-case 223:
-YY_RULE_SETUP
-#line 675 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, HVEC3);
-	YY_BREAK
-case 224:
-YY_RULE_SETUP
-#line 676 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, HVEC4);
-	YY_BREAK
-case 225:
-YY_RULE_SETUP
-#line 677 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dvec2_type);
-	YY_BREAK
-case 226:
-YY_RULE_SETUP
-#line 678 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dvec3_type);
-	YY_BREAK
-case 227:
-YY_RULE_SETUP
-#line 679 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dvec4_type);
-	YY_BREAK
-case 228:
-YY_RULE_SETUP
-#line 680 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dmat2_type);
-	YY_BREAK
-case 229:
-YY_RULE_SETUP
-#line 681 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dmat3_type);
-	YY_BREAK
-case 230:
-YY_RULE_SETUP
-#line 682 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dmat4_type);
-	YY_BREAK
-case 231:
-YY_RULE_SETUP
-#line 683 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dmat2_type);
-	YY_BREAK
-case 232:
-YY_RULE_SETUP
-#line 684 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dmat2x3_type);
-	YY_BREAK
-case 233:
-YY_RULE_SETUP
-#line 685 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dmat2x4_type);
-	YY_BREAK
-case 234:
-YY_RULE_SETUP
-#line 686 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dmat3x2_type);
-	YY_BREAK
-case 235:
-YY_RULE_SETUP
-#line 687 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dmat3_type);
-	YY_BREAK
-case 236:
-YY_RULE_SETUP
-#line 688 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dmat3x4_type);
-	YY_BREAK
-case 237:
-YY_RULE_SETUP
-#line 689 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dmat4x2_type);
-	YY_BREAK
-case 238:
-YY_RULE_SETUP
-#line 690 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dmat4x3_type);
-	YY_BREAK
-case 239:
-YY_RULE_SETUP
-#line 691 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 400, 0, yyextra->ARB_gpu_shader_fp64_enable, glsl_type::dmat4_type);
-	YY_BREAK
-case 240:
-YY_RULE_SETUP
-#line 692 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, FVEC2);
-	YY_BREAK
-case 241:
-YY_RULE_SETUP
-#line 693 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, FVEC3);
-	YY_BREAK
-case 242:
-YY_RULE_SETUP
-#line 694 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, FVEC4);
-	YY_BREAK
-case 243:
-YY_RULE_SETUP
-#line 695 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 0, 0, yyextra->ARB_texture_rectangle_enable, glsl_type::sampler2DRect_type);
-	YY_BREAK
-case 244:
-YY_RULE_SETUP
-#line 696 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, SAMPLER3DRECT);
-	YY_BREAK
-case 245:
-YY_RULE_SETUP
-#line 697 "glsl_lexer.ll"
-TYPE_WITH_ALT(110, 100, 0, 0, yyextra->ARB_texture_rectangle_enable, glsl_type::sampler2DRectShadow_type);
-	YY_BREAK
-case 246:
-YY_RULE_SETUP
-#line 698 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, SIZEOF);
-	YY_BREAK
-case 247:
-YY_RULE_SETUP
-#line 699 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, CAST);
-	YY_BREAK
-case 248:
-YY_RULE_SETUP
-#line 700 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, NAMESPACE);
-	YY_BREAK
-case 249:
-YY_RULE_SETUP
-#line 701 "glsl_lexer.ll"
-KEYWORD(110, 100, 0, 0, USING);
-	YY_BREAK
-/* Additional reserved words in GLSL 1.20. */
-case 250:
-YY_RULE_SETUP
-#line 704 "glsl_lexer.ll"
-KEYWORD(120, 100, 130, 100, LOWP);
-	YY_BREAK
-case 251:
-YY_RULE_SETUP
-#line 705 "glsl_lexer.ll"
-KEYWORD(120, 100, 130, 100, MEDIUMP);
-	YY_BREAK
-case 252:
-YY_RULE_SETUP
-#line 706 "glsl_lexer.ll"
-KEYWORD(120, 100, 130, 100, HIGHP);
-	YY_BREAK
-case 253:
-YY_RULE_SETUP
-#line 707 "glsl_lexer.ll"
-KEYWORD(120, 100, 130, 100, PRECISION);
-	YY_BREAK
-/* Additional reserved words in GLSL 1.30. */
-case 254:
-YY_RULE_SETUP
-#line 710 "glsl_lexer.ll"
-KEYWORD(130, 300, 130, 300, CASE);
-	YY_BREAK
-case 255:
-YY_RULE_SETUP
-#line 711 "glsl_lexer.ll"
-KEYWORD(130, 300, 0, 0, COMMON);
-	YY_BREAK
-case 256:
-YY_RULE_SETUP
-#line 712 "glsl_lexer.ll"
-KEYWORD(130, 300, 0, 0, PARTITION);
-	YY_BREAK
-case 257:
-YY_RULE_SETUP
-#line 713 "glsl_lexer.ll"
-KEYWORD(130, 300, 0, 0, ACTIVE);
-	YY_BREAK
-case 258:
-YY_RULE_SETUP
-#line 714 "glsl_lexer.ll"
-KEYWORD(130, 100, 0, 0, SUPERP);
-	YY_BREAK
-case 259:
-YY_RULE_SETUP
-#line 715 "glsl_lexer.ll"
-TYPE_WITH_ALT(130, 300, 140, 320, yyextra->EXT_texture_buffer_enable || yyextra->OES_texture_buffer_enable || (yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_buffer_object), glsl_type::samplerBuffer_type);
-	YY_BREAK
-case 260:
-YY_RULE_SETUP
-#line 716 "glsl_lexer.ll"
-KEYWORD(130, 300, 0, 0, FILTER);
-	YY_BREAK
-case 261:
-YY_RULE_SETUP
-#line 717 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(130, 0, 140, 0, yyextra->ARB_uniform_buffer_object_enable && !yyextra->es_shader, ROW_MAJOR);
-	YY_BREAK
-/* Additional reserved words in GLSL 1.40 */
-case 262:
-YY_RULE_SETUP
-#line 720 "glsl_lexer.ll"
-TYPE_WITH_ALT(140, 300, 140, 0, yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.NV_texture_rectangle && yyextra->ctx->Extensions.EXT_texture_integer, glsl_type::isampler2DRect_type);
-	YY_BREAK
-case 263:
-YY_RULE_SETUP
-#line 721 "glsl_lexer.ll"
-TYPE_WITH_ALT(140, 300, 140, 0, yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.NV_texture_rectangle && yyextra->ctx->Extensions.EXT_texture_integer, glsl_type::usampler2DRect_type);
-	YY_BREAK
-case 264:
-YY_RULE_SETUP
-#line 722 "glsl_lexer.ll"
-TYPE_WITH_ALT(140, 300, 140, 320, yyextra->EXT_texture_buffer_enable || yyextra->OES_texture_buffer_enable || (yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_buffer_object && yyextra->ctx->Extensions.EXT_texture_integer), glsl_type::isamplerBuffer_type);
-	YY_BREAK
-case 265:
-YY_RULE_SETUP
-#line 723 "glsl_lexer.ll"
-TYPE_WITH_ALT(140, 300, 140, 320, yyextra->EXT_texture_buffer_enable || yyextra->OES_texture_buffer_enable || (yyextra->EXT_gpu_shader4_enable && yyextra->ctx->Extensions.EXT_texture_buffer_object && yyextra->ctx->Extensions.EXT_texture_integer), glsl_type::usamplerBuffer_type);
-	YY_BREAK
-/* Additional reserved words in GLSL ES 3.00 */
-case 266:
-YY_RULE_SETUP
-#line 726 "glsl_lexer.ll"
-KEYWORD(420, 300, 0, 0, RESOURCE);
-	YY_BREAK
-case 267:
-YY_RULE_SETUP
-#line 727 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(400, 300, 400, 320, yyextra->ARB_gpu_shader5_enable || yyextra->OES_shader_multisample_interpolation_enable, SAMPLE);
-	YY_BREAK
-case 268:
-YY_RULE_SETUP
-#line 728 "glsl_lexer.ll"
-KEYWORD_WITH_ALT(400, 300, 400, 0, yyextra->ARB_shader_subroutine_enable, SUBROUTINE);
-	YY_BREAK
-/* Additional words for ARB_gpu_shader_int64 */
-case 269:
-YY_RULE_SETUP
-#line 731 "glsl_lexer.ll"
-TYPE_WITH_ALT(0, 0, 0, 0, yyextra->ARB_gpu_shader_int64_enable || yyextra->AMD_gpu_shader_int64_enable, glsl_type::int64_t_type);
-	YY_BREAK
-case 270:
-YY_RULE_SETUP
-#line 732 "glsl_lexer.ll"
-TYPE_WITH_ALT(0, 0, 0, 0, yyextra->ARB_gpu_shader_int64_enable || yyextra->AMD_gpu_shader_int64_enable, glsl_type::i64vec2_type);
-	YY_BREAK
-case 271:
-YY_RULE_SETUP
-#line 733 "glsl_lexer.ll"
-TYPE_WITH_ALT(0, 0, 0, 0, yyextra->ARB_gpu_shader_int64_enable || yyextra->AMD_gpu_shader_int64_enable, glsl_type::i64vec3_type);
-	YY_BREAK
-case 272:
-YY_RULE_SETUP
-#line 734 "glsl_lexer.ll"
-TYPE_WITH_ALT(0, 0, 0, 0, yyextra->ARB_gpu_shader_int64_enable || yyextra->AMD_gpu_shader_int64_enable, glsl_type::i64vec4_type);
-	YY_BREAK
-case 273:
-YY_RULE_SETUP
-#line 736 "glsl_lexer.ll"
-TYPE_WITH_ALT(0, 0, 0, 0, yyextra->ARB_gpu_shader_int64_enable || yyextra->AMD_gpu_shader_int64_enable, glsl_type::uint64_t_type);
-	YY_BREAK
-case 274:
-YY_RULE_SETUP
-#line 737 "glsl_lexer.ll"
-TYPE_WITH_ALT(0, 0, 0, 0, yyextra->ARB_gpu_shader_int64_enable || yyextra->AMD_gpu_shader_int64_enable, glsl_type::u64vec2_type);
-	YY_BREAK
-case 275:
-YY_RULE_SETUP
-#line 738 "glsl_lexer.ll"
-TYPE_WITH_ALT(0, 0, 0, 0, yyextra->ARB_gpu_shader_int64_enable || yyextra->AMD_gpu_shader_int64_enable, glsl_type::u64vec3_type);
-	YY_BREAK
-case 276:
-YY_RULE_SETUP
-#line 739 "glsl_lexer.ll"
-TYPE_WITH_ALT(0, 0, 0, 0, yyextra->ARB_gpu_shader_int64_enable || yyextra->AMD_gpu_shader_int64_enable, glsl_type::u64vec4_type);
-	YY_BREAK
-case 277:
+/* Keywords are scanned as identifiers too, see classify_keyword(). */
+case 60:
 YY_RULE_SETUP
-#line 741 "glsl_lexer.ll"
+#line 375 "glsl_lexer.ll"
 {
 			    struct _mesa_glsl_parse_state *state = yyextra;
+			    const struct glsl_keyword *keyword =
+			       glsl_keyword_lookup(yytext, yyleng);
+			    if (keyword != NULL) {
+			       return classify_keyword(state, keyword, yytext,
+			                               yyleng, yylval, yylloc);
+			    }
 			    if (state->es_shader && yyleng > 1024) {
 			       _mesa_glsl_error(yylloc, state,
 			                        "Identifier `%s' exceeds 1024 characters",
@@ -3538,24 +1818,24 @@ YY_RULE_SETUP
 			    return classify_identifier(state, yytext, yyleng, yylval);
 			}
 	YY_BREAK
-case 278:
+case 61:
 YY_RULE_SETUP
-#line 751 "glsl_lexer.ll"
+#line 391 "glsl_lexer.ll"
 { struct _mesa_glsl_parse_state *state = yyextra;
 			  state->is_field = true;
 			  return DOT_TOK; }
 	YY_BREAK
-case 279:
+case 62:
 YY_RULE_SETUP
-#line 755 "glsl_lexer.ll"
+#line 395 "glsl_lexer.ll"
 { return yytext[0]; }
 	YY_BREAK
-case 280:
+case 63:
 YY_RULE_SETUP
-#line 757 "glsl_lexer.ll"
+#line 397 "glsl_lexer.ll"
 YY_FATAL_ERROR( "flex scanner jammed" );
 	YY_BREAK
-#line 3558 "glsl_lexer.cpp"
+#line 1838 "glsl_lexer.cpp"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(PP):
 case YY_STATE_EOF(PRAGMA):
@@ -3858,7 +2138,7 @@ static int yy_get_next_buffer (yyscan_t yyscanner)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1112 )
+			if ( yy_current_state >= 249 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -3887,11 +2167,11 @@ static int yy_get_next_buffer (yyscan_t yyscanner)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1112 )
+		if ( yy_current_state >= 249 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1111);
+	yy_is_jam = (yy_current_state == 248);
 
 	(void)yyg;
 	return yy_is_jam ? 0 : yy_current_state;
@@ -4716,38 +2996,71 @@ void yyfree (void * ptr , yyscan_t yyscanner)
 
 #define YYTABLES_NAME "yytables"
 
-#line 757 "glsl_lexer.ll"
+#line 397 "glsl_lexer.ll"
 
 
 int
 classify_identifier(struct _mesa_glsl_parse_state *state, const char *name,
                     unsigned name_len, YYSTYPE *output)
 {
-   /* We're not doing linear_strdup here, to avoid an implicit call on
-    * strlen() for the length of the string, as this is already found by flex
-    * and stored in yyleng
+   /* Every occurrence of an identifier shares one copy of its name, which
+    * the symbol tables can look up by pointer.  The length is already known
+    * from yyleng, so don't let the atom table call strlen() again.
     */
-   char *id = (char *) linear_alloc_child(state->linalloc, name_len + 1);
-   memcpy(id, name, name_len + 1);
+   const char *id = _mesa_atom_table_intern(state->atoms, name, name_len);
    output->identifier = id;
 
    if (state->is_field) {
       state->is_field = false;
       return FIELD_SELECTION;
    }
-   if (state->symbols->get_variable(name) || state->symbols->get_function(name))
+   if (state->symbols->get_variable(id) || state->symbols->get_function(id))
       return IDENTIFIER;
-   else if (state->symbols->get_type(name))
+   else if (state->symbols->get_type(id))
       return TYPE_IDENTIFIER;
    else
       return NEW_IDENTIFIER;
 }
 
+/**
+ * Decide whether a word that is a keyword in some version of the language
+ * is a keyword, a reserved word or an identifier in this shader.
+ */
+static int
+classify_keyword(struct _mesa_glsl_parse_state *state,
+                 const struct glsl_keyword *keyword, const char *name,
+                 unsigned name_len, YYSTYPE *output, YYLTYPE *loc)
+{
+   if (glsl_keyword_allowed(keyword, state)) {
+      switch (keyword->kind) {
+      case GLSL_KEYWORD_TYPE:
+         output->type = *keyword->type;
+         break;
+      case GLSL_KEYWORD_BOOL:
+         output->n = keyword->value;
+         break;
+      case GLSL_KEYWORD_TOKEN:
+         break;
+      }
+      return keyword->token;
+   } else if (glsl_keyword_reserved(keyword, state)) {
+      _mesa_glsl_error(loc, state, "illegal use of reserved word `%s'", name);
+      return ERROR_TOK;
+   } else {
+      return classify_identifier(state, name, name_len, output);
+   }
+}
+
 void
-_mesa_glsl_lexer_ctor(struct _mesa_glsl_parse_state *state, const char *string)
+_mesa_glsl_lexer_ctor(struct _mesa_glsl_parse_state *state, const char *string,
+                      size_t length)
 {
+   glsl_keywords_init();
    yylex_init_extra(state, & state->scanner);
-   yy_scan_string(string, state->scanner);
+   state->lexer_source = string;
+   state->lexer_source_end = string + length;
+   yy_switch_to_buffer(yy_create_buffer(NULL, YY_BUF_SIZE, state->scanner),
+                       state->scanner);
 }
 
 void
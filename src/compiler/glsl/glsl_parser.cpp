@@ -789,38 +789,38 @@ static const yytype_uint8 yytranslate[] =
   /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   294,   294,   293,   317,   319,   326,   336,   337,   338,
-     339,   340,   364,   369,   376,   378,   382,   383,   384,   388,
-     397,   405,   413,   424,   425,   429,   436,   443,   450,   457,
-     464,   471,   478,   485,   492,   493,   499,   503,   510,   516,
-     525,   529,   533,   537,   538,   542,   543,   547,   553,   565,
-     569,   575,   589,   590,   596,   602,   612,   613,   614,   615,
-     619,   620,   626,   632,   641,   642,   648,   657,   658,   664,
-     673,   674,   680,   686,   692,   701,   702,   708,   717,   718,
-     727,   728,   737,   738,   747,   748,   757,   758,   767,   768,
-     777,   778,   787,   788,   797,   798,   799,   800,   801,   802,
-     803,   804,   805,   806,   807,   811,   815,   831,   835,   840,
-     844,   849,   866,   870,   871,   875,   880,   888,   906,   917,
-     934,   949,   957,   974,   977,   985,   993,  1005,  1017,  1024,
-    1029,  1034,  1043,  1047,  1048,  1058,  1068,  1078,  1092,  1099,
-    1110,  1121,  1132,  1143,  1155,  1170,  1177,  1195,  1202,  1203,
-    1213,  1717,  1882,  1908,  1913,  1918,  1926,  1931,  1940,  1949,
-    1961,  1966,  1971,  1980,  1985,  1990,  1991,  1992,  1993,  1994,
-    1995,  1996,  2014,  2022,  2047,  2071,  2085,  2090,  2106,  2131,
-    2143,  2151,  2156,  2161,  2168,  2173,  2178,  2183,  2188,  2213,
-    2225,  2230,  2235,  2243,  2248,  2253,  2259,  2264,  2272,  2280,
-    2286,  2296,  2307,  2308,  2316,  2322,  2328,  2337,  2338,  2339,
-    2351,  2356,  2361,  2369,  2376,  2393,  2398,  2406,  2444,  2449,
-    2457,  2463,  2472,  2473,  2477,  2484,  2491,  2498,  2504,  2505,
-    2509,  2510,  2511,  2512,  2513,  2514,  2515,  2519,  2526,  2525,
-    2539,  2540,  2544,  2550,  2559,  2569,  2578,  2590,  2596,  2605,
-    2614,  2619,  2627,  2631,  2649,  2657,  2662,  2670,  2675,  2683,
-    2691,  2699,  2707,  2715,  2723,  2731,  2738,  2745,  2755,  2756,
-    2760,  2762,  2768,  2773,  2782,  2788,  2794,  2800,  2806,  2815,
-    2824,  2825,  2826,  2827,  2828,  2832,  2846,  2850,  2863,  2881,
-    2900,  2905,  2910,  2915,  2920,  2935,  2938,  2943,  2951,  2956,
-    2964,  2988,  2995,  2999,  3006,  3010,  3020,  3029,  3039,  3048,
-    3060,  3082,  3092
+       0,   294,   294,   293,   305,   307,   314,   324,   325,   326,
+     327,   328,   352,   357,   364,   366,   370,   371,   372,   376,
+     385,   395,   405,   416,   417,   421,   428,   435,   442,   449,
+     456,   463,   470,   477,   484,   485,   491,   495,   502,   508,
+     517,   521,   525,   529,   530,   534,   535,   539,   545,   557,
+     561,   567,   581,   582,   588,   594,   604,   605,   606,   607,
+     611,   612,   618,   624,   633,   634,   640,   649,   650,   656,
+     665,   666,   672,   678,   684,   693,   694,   700,   709,   710,
+     719,   720,   729,   730,   739,   740,   749,   750,   759,   760,
+     769,   770,   779,   780,   789,   790,   791,   792,   793,   794,
+     795,   796,   797,   798,   799,   803,   807,   823,   827,   832,
+     836,   841,   858,   862,   863,   867,   872,   880,   904,   915,
+     932,   947,   955,   972,   975,   983,   991,  1003,  1015,  1022,
+    1027,  1032,  1041,  1045,  1046,  1056,  1066,  1076,  1090,  1097,
+    1108,  1119,  1130,  1141,  1153,  1168,  1175,  1193,  1200,  1201,
+    1211,  1715,  1880,  1906,  1911,  1916,  1924,  1929,  1938,  1947,
+    1959,  1964,  1969,  1978,  1983,  1988,  1989,  1990,  1991,  1992,
+    1993,  1994,  2012,  2020,  2045,  2069,  2083,  2088,  2104,  2129,
+    2141,  2149,  2154,  2159,  2166,  2171,  2176,  2181,  2186,  2211,
+    2223,  2228,  2233,  2241,  2246,  2251,  2257,  2262,  2270,  2278,
+    2284,  2294,  2305,  2306,  2314,  2320,  2326,  2335,  2336,  2337,
+    2349,  2354,  2359,  2367,  2374,  2391,  2396,  2404,  2442,  2447,
+    2455,  2461,  2470,  2471,  2475,  2482,  2489,  2496,  2502,  2503,
+    2507,  2508,  2509,  2510,  2511,  2512,  2513,  2517,  2524,  2523,
+    2537,  2538,  2542,  2548,  2557,  2567,  2576,  2588,  2594,  2603,
+    2612,  2617,  2625,  2629,  2647,  2655,  2660,  2668,  2673,  2681,
+    2689,  2697,  2705,  2713,  2721,  2729,  2736,  2743,  2753,  2754,
+    2758,  2760,  2766,  2771,  2780,  2786,  2792,  2798,  2804,  2813,
+    2822,  2823,  2824,  2825,  2826,  2830,  2844,  2848,  2861,  2879,
+    2898,  2903,  2908,  2913,  2918,  2933,  2936,  2941,  2949,  2954,
+    2962,  2986,  2993,  2997,  3004,  3008,  3018,  3027,  3037,  3046,
+    3058,  3080,  3090
 };
 #endif
 
@@ -2542,72 +2542,60 @@ yyreduce:
 #line 298 "glsl_parser.yy"
    {
       delete state->symbols;
-      state->symbols = new(ralloc_parent(state)) glsl_symbol_table;
-      if (state->es_shader) {
-         if (state->stage == MESA_SHADER_FRAGMENT) {
-            state->symbols->add_default_precision_qualifier("int", ast_precision_medium);
-         } else {
-            state->symbols->add_default_precision_qualifier("float", ast_precision_high);
-            state->symbols->add_default_precision_qualifier("int", ast_precision_high);
-         }
-         state->symbols->add_default_precision_qualifier("sampler2D", ast_precision_low);
-         state->symbols->add_default_precision_qualifier("samplerExternalOES", ast_precision_low);
-         state->symbols->add_default_precision_qualifier("samplerCube", ast_precision_low);
-         state->symbols->add_default_precision_qualifier("atomic_uint", ast_precision_high);
-      }
+      state->symbols = _mesa_glsl_hir_symbol_table(state);
       _mesa_glsl_initialize_types(state);
    }
-#line 2561 "glsl_parser.cpp"
+#line 2549 "glsl_parser.cpp"
     break;
 
   case 5:
-#line 320 "glsl_parser.yy"
+#line 308 "glsl_parser.yy"
    {
       state->process_version_directive(&(yylsp[-1]), (yyvsp[-1].n), NULL);
       if (state->error) {
          YYERROR;
       }
    }
-#line 2572 "glsl_parser.cpp"
+#line 2560 "glsl_parser.cpp"
     break;
 
   case 6:
-#line 327 "glsl_parser.yy"
+#line 315 "glsl_parser.yy"
    {
       state->process_version_directive(&(yylsp[-2]), (yyvsp[-2].n), (yyvsp[-1].identifier));
       if (state->error) {
          YYERROR;
       }
    }
-#line 2583 "glsl_parser.cpp"
+#line 2571 "glsl_parser.cpp"
     break;
 
   case 7:
-#line 336 "glsl_parser.yy"
+#line 324 "glsl_parser.yy"
                        { (yyval.node) = NULL; }
-#line 2589 "glsl_parser.cpp"
+#line 2577 "glsl_parser.cpp"
     break;
 
   case 8:
-#line 337 "glsl_parser.yy"
+#line 325 "glsl_parser.yy"
                           { (yyval.node) = NULL; }
-#line 2595 "glsl_parser.cpp"
+#line 2583 "glsl_parser.cpp"
     break;
 
   case 9:
-#line 338 "glsl_parser.yy"
+#line 326 "glsl_parser.yy"
                             { (yyval.node) = NULL; }
-#line 2601 "glsl_parser.cpp"
+#line 2589 "glsl_parser.cpp"
     break;
 
   case 10:
-#line 339 "glsl_parser.yy"
+#line 327 "glsl_parser.yy"
                              { (yyval.node) = NULL; }
-#line 2607 "glsl_parser.cpp"
+#line 2595 "glsl_parser.cpp"
     break;
 
   case 11:
-#line 341 "glsl_parser.yy"
+#line 329 "glsl_parser.yy"
    {
       /* Pragma invariant(all) cannot be used in a fragment shader.
        *
@@ -2631,63 +2619,67 @@ yyreduce:
 
       (yyval.node) = NULL;
    }
-#line 2635 "glsl_parser.cpp"
+#line 2623 "glsl_parser.cpp"
     break;
 
   case 12:
-#line 365 "glsl_parser.yy"
+#line 353 "glsl_parser.yy"
    {
       void *mem_ctx = state->linalloc;
       (yyval.node) = new(mem_ctx) ast_warnings_toggle(true);
    }
-#line 2644 "glsl_parser.cpp"
+#line 2632 "glsl_parser.cpp"
     break;
 
   case 13:
-#line 370 "glsl_parser.yy"
+#line 358 "glsl_parser.yy"
    {
       void *mem_ctx = state->linalloc;
       (yyval.node) = new(mem_ctx) ast_warnings_toggle(false);
    }
-#line 2653 "glsl_parser.cpp"
+#line 2641 "glsl_parser.cpp"
     break;
 
   case 19:
-#line 389 "glsl_parser.yy"
+#line 377 "glsl_parser.yy"
    {
       if (!_mesa_glsl_process_extension((yyvsp[-3].identifier), & (yylsp[-3]), (yyvsp[-1].identifier), & (yylsp[-1]), state)) {
          YYERROR;
       }
    }
-#line 2663 "glsl_parser.cpp"
+#line 2651 "glsl_parser.cpp"
     break;
 
   case 20:
-#line 398 "glsl_parser.yy"
+#line 386 "glsl_parser.yy"
    {
       /* FINISHME: The NULL test is required because pragmas are set to
        * FINISHME: NULL. (See production rule for external_declaration.)
        */
-      if ((yyvsp[0].node) != NULL)
+      if (state->stream_hir)
+         _mesa_glsl_stream_external_declaration(state, (yyvsp[0].node));
+      else if ((yyvsp[0].node) != NULL)
          state->translation_unit.push_tail(& (yyvsp[0].node)->link);
    }
-#line 2675 "glsl_parser.cpp"
+#line 2665 "glsl_parser.cpp"
     break;
 
   case 21:
-#line 406 "glsl_parser.yy"
+#line 396 "glsl_parser.yy"
    {
       /* FINISHME: The NULL test is required because pragmas are set to
        * FINISHME: NULL. (See production rule for external_declaration.)
        */
-      if ((yyvsp[0].node) != NULL)
+      if (state->stream_hir)
+         _mesa_glsl_stream_external_declaration(state, (yyvsp[0].node));
+      else if ((yyvsp[0].node) != NULL)
          state->translation_unit.push_tail(& (yyvsp[0].node)->link);
    }
-#line 2687 "glsl_parser.cpp"
+#line 2679 "glsl_parser.cpp"
     break;
 
   case 22:
-#line 413 "glsl_parser.yy"
+#line 405 "glsl_parser.yy"
                                                    {
       if (!state->allow_extension_directive_midshader) {
          _mesa_glsl_error(& (yylsp[0]), state,
@@ -2696,534 +2688,534 @@ yyreduce:
          YYERROR;
       }
    }
-#line 2700 "glsl_parser.cpp"
+#line 2692 "glsl_parser.cpp"
     break;
 
   case 25:
-#line 430 "glsl_parser.yy"
+#line 422 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_identifier, NULL, NULL, NULL);
       (yyval.expression)->set_location((yylsp[0]));
       (yyval.expression)->primary_expression.identifier = (yyvsp[0].identifier);
    }
-#line 2711 "glsl_parser.cpp"
+#line 2703 "glsl_parser.cpp"
     break;
 
   case 26:
-#line 437 "glsl_parser.yy"
+#line 429 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_int_constant, NULL, NULL, NULL);
       (yyval.expression)->set_location((yylsp[0]));
       (yyval.expression)->primary_expression.int_constant = (yyvsp[0].n);
    }
-#line 2722 "glsl_parser.cpp"
+#line 2714 "glsl_parser.cpp"
     break;
 
   case 27:
-#line 444 "glsl_parser.yy"
+#line 436 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_uint_constant, NULL, NULL, NULL);
       (yyval.expression)->set_location((yylsp[0]));
       (yyval.expression)->primary_expression.uint_constant = (yyvsp[0].n);
    }
-#line 2733 "glsl_parser.cpp"
+#line 2725 "glsl_parser.cpp"
     break;
 
   case 28:
-#line 451 "glsl_parser.yy"
+#line 443 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_int64_constant, NULL, NULL, NULL);
       (yyval.expression)->set_location((yylsp[0]));
       (yyval.expression)->primary_expression.int64_constant = (yyvsp[0].n64);
    }
-#line 2744 "glsl_parser.cpp"
+#line 2736 "glsl_parser.cpp"
     break;
 
   case 29:
-#line 458 "glsl_parser.yy"
+#line 450 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_uint64_constant, NULL, NULL, NULL);
       (yyval.expression)->set_location((yylsp[0]));
       (yyval.expression)->primary_expression.uint64_constant = (yyvsp[0].n64);
    }
-#line 2755 "glsl_parser.cpp"
+#line 2747 "glsl_parser.cpp"
     break;
 
   case 30:
-#line 465 "glsl_parser.yy"
+#line 457 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_float_constant, NULL, NULL, NULL);
       (yyval.expression)->set_location((yylsp[0]));
       (yyval.expression)->primary_expression.float_constant = (yyvsp[0].real);
    }
-#line 2766 "glsl_parser.cpp"
+#line 2758 "glsl_parser.cpp"
     break;
 
   case 31:
-#line 472 "glsl_parser.yy"
+#line 464 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_double_constant, NULL, NULL, NULL);
       (yyval.expression)->set_location((yylsp[0]));
       (yyval.expression)->primary_expression.double_constant = (yyvsp[0].dreal);
    }
-#line 2777 "glsl_parser.cpp"
+#line 2769 "glsl_parser.cpp"
     break;
 
   case 32:
-#line 479 "glsl_parser.yy"
+#line 471 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_bool_constant, NULL, NULL, NULL);
       (yyval.expression)->set_location((yylsp[0]));
       (yyval.expression)->primary_expression.bool_constant = (yyvsp[0].n);
    }
-#line 2788 "glsl_parser.cpp"
+#line 2780 "glsl_parser.cpp"
     break;
 
   case 33:
-#line 486 "glsl_parser.yy"
+#line 478 "glsl_parser.yy"
    {
       (yyval.expression) = (yyvsp[-1].expression);
    }
-#line 2796 "glsl_parser.cpp"
+#line 2788 "glsl_parser.cpp"
     break;
 
   case 35:
-#line 494 "glsl_parser.yy"
+#line 486 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_array_index, (yyvsp[-3].expression), (yyvsp[-1].expression), NULL);
       (yyval.expression)->set_location_range((yylsp[-3]), (yylsp[0]));
    }
-#line 2806 "glsl_parser.cpp"
+#line 2798 "glsl_parser.cpp"
     break;
 
   case 36:
-#line 500 "glsl_parser.yy"
+#line 492 "glsl_parser.yy"
    {
       (yyval.expression) = (yyvsp[0].expression);
    }
-#line 2814 "glsl_parser.cpp"
+#line 2806 "glsl_parser.cpp"
     break;
 
   case 37:
-#line 504 "glsl_parser.yy"
+#line 496 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_field_selection, (yyvsp[-2].expression), NULL, NULL);
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
       (yyval.expression)->primary_expression.identifier = (yyvsp[0].identifier);
    }
-#line 2825 "glsl_parser.cpp"
+#line 2817 "glsl_parser.cpp"
     break;
 
   case 38:
-#line 511 "glsl_parser.yy"
+#line 503 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_post_inc, (yyvsp[-1].expression), NULL, NULL);
       (yyval.expression)->set_location_range((yylsp[-1]), (yylsp[0]));
    }
-#line 2835 "glsl_parser.cpp"
+#line 2827 "glsl_parser.cpp"
     break;
 
   case 39:
-#line 517 "glsl_parser.yy"
+#line 509 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_post_dec, (yyvsp[-1].expression), NULL, NULL);
       (yyval.expression)->set_location_range((yylsp[-1]), (yylsp[0]));
    }
-#line 2845 "glsl_parser.cpp"
+#line 2837 "glsl_parser.cpp"
     break;
 
   case 47:
-#line 548 "glsl_parser.yy"
+#line 540 "glsl_parser.yy"
    {
       (yyval.expression) = (yyvsp[-1].expression);
       (yyval.expression)->set_location((yylsp[-1]));
       (yyval.expression)->expressions.push_tail(& (yyvsp[0].expression)->link);
    }
-#line 2855 "glsl_parser.cpp"
+#line 2847 "glsl_parser.cpp"
     break;
 
   case 48:
-#line 554 "glsl_parser.yy"
+#line 546 "glsl_parser.yy"
    {
       (yyval.expression) = (yyvsp[-2].expression);
       (yyval.expression)->set_location((yylsp[-2]));
       (yyval.expression)->expressions.push_tail(& (yyvsp[0].expression)->link);
    }
-#line 2865 "glsl_parser.cpp"
+#line 2857 "glsl_parser.cpp"
     break;
 
   case 50:
-#line 570 "glsl_parser.yy"
+#line 562 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_function_expression((yyvsp[0].type_specifier));
       (yyval.expression)->set_location((yylsp[0]));
       }
-#line 2875 "glsl_parser.cpp"
+#line 2867 "glsl_parser.cpp"
     break;
 
   case 51:
-#line 576 "glsl_parser.yy"
+#line 568 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_function_expression((yyvsp[0].expression));
       (yyval.expression)->set_location((yylsp[0]));
       }
-#line 2885 "glsl_parser.cpp"
+#line 2877 "glsl_parser.cpp"
     break;
 
   case 53:
-#line 591 "glsl_parser.yy"
+#line 583 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_pre_inc, (yyvsp[0].expression), NULL, NULL);
       (yyval.expression)->set_location((yylsp[-1]));
    }
-#line 2895 "glsl_parser.cpp"
+#line 2887 "glsl_parser.cpp"
     break;
 
   case 54:
-#line 597 "glsl_parser.yy"
+#line 589 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_pre_dec, (yyvsp[0].expression), NULL, NULL);
       (yyval.expression)->set_location((yylsp[-1]));
    }
-#line 2905 "glsl_parser.cpp"
+#line 2897 "glsl_parser.cpp"
     break;
 
   case 55:
-#line 603 "glsl_parser.yy"
+#line 595 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression((yyvsp[-1].n), (yyvsp[0].expression), NULL, NULL);
       (yyval.expression)->set_location_range((yylsp[-1]), (yylsp[0]));
    }
-#line 2915 "glsl_parser.cpp"
+#line 2907 "glsl_parser.cpp"
     break;
 
   case 56:
-#line 612 "glsl_parser.yy"
+#line 604 "glsl_parser.yy"
          { (yyval.n) = ast_plus; }
-#line 2921 "glsl_parser.cpp"
+#line 2913 "glsl_parser.cpp"
     break;
 
   case 57:
-#line 613 "glsl_parser.yy"
+#line 605 "glsl_parser.yy"
          { (yyval.n) = ast_neg; }
-#line 2927 "glsl_parser.cpp"
+#line 2919 "glsl_parser.cpp"
     break;
 
   case 58:
-#line 614 "glsl_parser.yy"
+#line 606 "glsl_parser.yy"
          { (yyval.n) = ast_logic_not; }
-#line 2933 "glsl_parser.cpp"
+#line 2925 "glsl_parser.cpp"
     break;
 
   case 59:
-#line 615 "glsl_parser.yy"
+#line 607 "glsl_parser.yy"
          { (yyval.n) = ast_bit_not; }
-#line 2939 "glsl_parser.cpp"
+#line 2931 "glsl_parser.cpp"
     break;
 
   case 61:
-#line 621 "glsl_parser.yy"
+#line 613 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_mul, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 2949 "glsl_parser.cpp"
+#line 2941 "glsl_parser.cpp"
     break;
 
   case 62:
-#line 627 "glsl_parser.yy"
+#line 619 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_div, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 2959 "glsl_parser.cpp"
+#line 2951 "glsl_parser.cpp"
     break;
 
   case 63:
-#line 633 "glsl_parser.yy"
+#line 625 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_mod, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 2969 "glsl_parser.cpp"
+#line 2961 "glsl_parser.cpp"
     break;
 
   case 65:
-#line 643 "glsl_parser.yy"
+#line 635 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_add, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 2979 "glsl_parser.cpp"
+#line 2971 "glsl_parser.cpp"
     break;
 
   case 66:
-#line 649 "glsl_parser.yy"
+#line 641 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_sub, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 2989 "glsl_parser.cpp"
+#line 2981 "glsl_parser.cpp"
     break;
 
   case 68:
-#line 659 "glsl_parser.yy"
+#line 651 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_lshift, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 2999 "glsl_parser.cpp"
+#line 2991 "glsl_parser.cpp"
     break;
 
   case 69:
-#line 665 "glsl_parser.yy"
+#line 657 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_rshift, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3009 "glsl_parser.cpp"
+#line 3001 "glsl_parser.cpp"
     break;
 
   case 71:
-#line 675 "glsl_parser.yy"
+#line 667 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_less, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3019 "glsl_parser.cpp"
+#line 3011 "glsl_parser.cpp"
     break;
 
   case 72:
-#line 681 "glsl_parser.yy"
+#line 673 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_greater, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3029 "glsl_parser.cpp"
+#line 3021 "glsl_parser.cpp"
     break;
 
   case 73:
-#line 687 "glsl_parser.yy"
+#line 679 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_lequal, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3039 "glsl_parser.cpp"
+#line 3031 "glsl_parser.cpp"
     break;
 
   case 74:
-#line 693 "glsl_parser.yy"
+#line 685 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_gequal, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3049 "glsl_parser.cpp"
+#line 3041 "glsl_parser.cpp"
     break;
 
   case 76:
-#line 703 "glsl_parser.yy"
+#line 695 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_equal, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3059 "glsl_parser.cpp"
+#line 3051 "glsl_parser.cpp"
     break;
 
   case 77:
-#line 709 "glsl_parser.yy"
+#line 701 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_nequal, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3069 "glsl_parser.cpp"
+#line 3061 "glsl_parser.cpp"
     break;
 
   case 79:
-#line 719 "glsl_parser.yy"
+#line 711 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_bit_and, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3079 "glsl_parser.cpp"
+#line 3071 "glsl_parser.cpp"
     break;
 
   case 81:
-#line 729 "glsl_parser.yy"
+#line 721 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_bit_xor, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3089 "glsl_parser.cpp"
+#line 3081 "glsl_parser.cpp"
     break;
 
   case 83:
-#line 739 "glsl_parser.yy"
+#line 731 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_bit_or, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3099 "glsl_parser.cpp"
+#line 3091 "glsl_parser.cpp"
     break;
 
   case 85:
-#line 749 "glsl_parser.yy"
+#line 741 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_logic_and, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3109 "glsl_parser.cpp"
+#line 3101 "glsl_parser.cpp"
     break;
 
   case 87:
-#line 759 "glsl_parser.yy"
+#line 751 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_logic_xor, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3119 "glsl_parser.cpp"
+#line 3111 "glsl_parser.cpp"
     break;
 
   case 89:
-#line 769 "glsl_parser.yy"
+#line 761 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression_bin(ast_logic_or, (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3129 "glsl_parser.cpp"
+#line 3121 "glsl_parser.cpp"
     break;
 
   case 91:
-#line 779 "glsl_parser.yy"
+#line 771 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression(ast_conditional, (yyvsp[-4].expression), (yyvsp[-2].expression), (yyvsp[0].expression));
       (yyval.expression)->set_location_range((yylsp[-4]), (yylsp[0]));
    }
-#line 3139 "glsl_parser.cpp"
+#line 3131 "glsl_parser.cpp"
     break;
 
   case 93:
-#line 789 "glsl_parser.yy"
+#line 781 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_expression((yyvsp[-1].n), (yyvsp[-2].expression), (yyvsp[0].expression), NULL);
       (yyval.expression)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 3149 "glsl_parser.cpp"
+#line 3141 "glsl_parser.cpp"
     break;
 
   case 94:
-#line 797 "glsl_parser.yy"
+#line 789 "glsl_parser.yy"
                       { (yyval.n) = ast_assign; }
-#line 3155 "glsl_parser.cpp"
+#line 3147 "glsl_parser.cpp"
     break;
 
   case 95:
-#line 798 "glsl_parser.yy"
+#line 790 "glsl_parser.yy"
                       { (yyval.n) = ast_mul_assign; }
-#line 3161 "glsl_parser.cpp"
+#line 3153 "glsl_parser.cpp"
     break;
 
   case 96:
-#line 799 "glsl_parser.yy"
+#line 791 "glsl_parser.yy"
                       { (yyval.n) = ast_div_assign; }
-#line 3167 "glsl_parser.cpp"
+#line 3159 "glsl_parser.cpp"
     break;
 
   case 97:
-#line 800 "glsl_parser.yy"
+#line 792 "glsl_parser.yy"
                       { (yyval.n) = ast_mod_assign; }
-#line 3173 "glsl_parser.cpp"
+#line 3165 "glsl_parser.cpp"
     break;
 
   case 98:
-#line 801 "glsl_parser.yy"
+#line 793 "glsl_parser.yy"
                       { (yyval.n) = ast_add_assign; }
-#line 3179 "glsl_parser.cpp"
+#line 3171 "glsl_parser.cpp"
     break;
 
   case 99:
-#line 802 "glsl_parser.yy"
+#line 794 "glsl_parser.yy"
                       { (yyval.n) = ast_sub_assign; }
-#line 3185 "glsl_parser.cpp"
+#line 3177 "glsl_parser.cpp"
     break;
 
   case 100:
-#line 803 "glsl_parser.yy"
+#line 795 "glsl_parser.yy"
                       { (yyval.n) = ast_ls_assign; }
-#line 3191 "glsl_parser.cpp"
+#line 3183 "glsl_parser.cpp"
     break;
 
   case 101:
-#line 804 "glsl_parser.yy"
+#line 796 "glsl_parser.yy"
                       { (yyval.n) = ast_rs_assign; }
-#line 3197 "glsl_parser.cpp"
+#line 3189 "glsl_parser.cpp"
     break;
 
   case 102:
-#line 805 "glsl_parser.yy"
+#line 797 "glsl_parser.yy"
                       { (yyval.n) = ast_and_assign; }
-#line 3203 "glsl_parser.cpp"
+#line 3195 "glsl_parser.cpp"
     break;
 
   case 103:
-#line 806 "glsl_parser.yy"
+#line 798 "glsl_parser.yy"
                       { (yyval.n) = ast_xor_assign; }
-#line 3209 "glsl_parser.cpp"
+#line 3201 "glsl_parser.cpp"
     break;
 
   case 104:
-#line 807 "glsl_parser.yy"
+#line 799 "glsl_parser.yy"
                       { (yyval.n) = ast_or_assign; }
-#line 3215 "glsl_parser.cpp"
+#line 3207 "glsl_parser.cpp"
     break;
 
   case 105:
-#line 812 "glsl_parser.yy"
+#line 804 "glsl_parser.yy"
    {
       (yyval.expression) = (yyvsp[0].expression);
    }
-#line 3223 "glsl_parser.cpp"
+#line 3215 "glsl_parser.cpp"
     break;
 
   case 106:
-#line 816 "glsl_parser.yy"
+#line 808 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       if ((yyvsp[-2].expression)->oper != ast_sequence) {
@@ -3236,37 +3228,37 @@ yyreduce:
 
       (yyval.expression)->expressions.push_tail(& (yyvsp[0].expression)->link);
    }
-#line 3240 "glsl_parser.cpp"
+#line 3232 "glsl_parser.cpp"
     break;
 
   case 108:
-#line 836 "glsl_parser.yy"
+#line 828 "glsl_parser.yy"
    {
       state->symbols->pop_scope();
       (yyval.node) = (yyvsp[-1].function);
    }
-#line 3249 "glsl_parser.cpp"
+#line 3241 "glsl_parser.cpp"
     break;
 
   case 109:
-#line 841 "glsl_parser.yy"
+#line 833 "glsl_parser.yy"
    {
       (yyval.node) = (yyvsp[-1].declarator_list);
    }
-#line 3257 "glsl_parser.cpp"
+#line 3249 "glsl_parser.cpp"
     break;
 
   case 110:
-#line 845 "glsl_parser.yy"
+#line 837 "glsl_parser.yy"
    {
       (yyvsp[-1].type_specifier)->default_precision = (yyvsp[-2].n);
       (yyval.node) = (yyvsp[-1].type_specifier);
    }
-#line 3266 "glsl_parser.cpp"
+#line 3258 "glsl_parser.cpp"
     break;
 
   case 111:
-#line 850 "glsl_parser.yy"
+#line 842 "glsl_parser.yy"
    {
       ast_interface_block *block = (ast_interface_block *) (yyvsp[0].node);
       if (block->layout.has_layout() || block->layout.has_memory()) {
@@ -3280,29 +3272,29 @@ yyreduce:
       }
       (yyval.node) = (yyvsp[0].node);
    }
-#line 3284 "glsl_parser.cpp"
+#line 3276 "glsl_parser.cpp"
     break;
 
   case 115:
-#line 876 "glsl_parser.yy"
+#line 868 "glsl_parser.yy"
    {
       (yyval.function) = (yyvsp[-1].function);
       (yyval.function)->parameters.push_tail(& (yyvsp[0].parameter_declarator)->link);
    }
-#line 3293 "glsl_parser.cpp"
+#line 3285 "glsl_parser.cpp"
     break;
 
   case 116:
-#line 881 "glsl_parser.yy"
+#line 873 "glsl_parser.yy"
    {
       (yyval.function) = (yyvsp[-2].function);
       (yyval.function)->parameters.push_tail(& (yyvsp[0].parameter_declarator)->link);
    }
-#line 3302 "glsl_parser.cpp"
+#line 3294 "glsl_parser.cpp"
     break;
 
   case 117:
-#line 889 "glsl_parser.yy"
+#line 881 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.function) = new(ctx) ast_function();
@@ -3316,12 +3308,18 @@ yyreduce:
       } else
          state->symbols->add_function(new(state) ir_function((yyvsp[-1].identifier)));
       state->symbols->push_scope();
+
+      /* While streaming, the rest of the function is parsed into an
+       * allocator of its own, which is released once it is converted.
+       */
+      if (state->stream_hir && state->linalloc == state->global_linalloc)
+         state->linalloc = linear_alloc_parent(state->function_ctx, 0);
    }
-#line 3321 "glsl_parser.cpp"
+#line 3319 "glsl_parser.cpp"
     break;
 
   case 118:
-#line 907 "glsl_parser.yy"
+#line 905 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.parameter_declarator) = new(ctx) ast_parameter_declarator();
@@ -3332,11 +3330,11 @@ yyreduce:
       (yyval.parameter_declarator)->identifier = (yyvsp[0].identifier);
       state->symbols->add_variable(new(state) ir_variable(NULL, (yyvsp[0].identifier), ir_var_auto));
    }
-#line 3336 "glsl_parser.cpp"
+#line 3334 "glsl_parser.cpp"
     break;
 
   case 119:
-#line 918 "glsl_parser.yy"
+#line 916 "glsl_parser.yy"
    {
       if (state->allow_layout_qualifier_on_function_parameter) {
          void *ctx = state->linalloc;
@@ -3353,11 +3351,11 @@ yyreduce:
          YYERROR;
       }
    }
-#line 3357 "glsl_parser.cpp"
+#line 3355 "glsl_parser.cpp"
     break;
 
   case 120:
-#line 935 "glsl_parser.yy"
+#line 933 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.parameter_declarator) = new(ctx) ast_parameter_declarator();
@@ -3369,11 +3367,11 @@ yyreduce:
       (yyval.parameter_declarator)->array_specifier = (yyvsp[0].array_specifier);
       state->symbols->add_variable(new(state) ir_variable(NULL, (yyvsp[-1].identifier), ir_var_auto));
    }
-#line 3373 "glsl_parser.cpp"
+#line 3371 "glsl_parser.cpp"
     break;
 
   case 121:
-#line 950 "glsl_parser.yy"
+#line 948 "glsl_parser.yy"
    {
       (yyval.parameter_declarator) = (yyvsp[0].parameter_declarator);
       (yyval.parameter_declarator)->type->qualifier = (yyvsp[-1].type_qualifier);
@@ -3381,11 +3379,11 @@ yyreduce:
          YYERROR;
       }
    }
-#line 3385 "glsl_parser.cpp"
+#line 3383 "glsl_parser.cpp"
     break;
 
   case 122:
-#line 958 "glsl_parser.yy"
+#line 956 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.parameter_declarator) = new(ctx) ast_parameter_declarator();
@@ -3398,19 +3396,19 @@ yyreduce:
       }
       (yyval.parameter_declarator)->type->specifier = (yyvsp[0].type_specifier);
    }
-#line 3402 "glsl_parser.cpp"
+#line 3400 "glsl_parser.cpp"
     break;
 
   case 123:
-#line 974 "glsl_parser.yy"
+#line 972 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
    }
-#line 3410 "glsl_parser.cpp"
+#line 3408 "glsl_parser.cpp"
     break;
 
   case 124:
-#line 978 "glsl_parser.yy"
+#line 976 "glsl_parser.yy"
    {
       if ((yyvsp[0].type_qualifier).flags.q.constant)
          _mesa_glsl_error(&(yylsp[-1]), state, "duplicate const qualifier");
@@ -3418,11 +3416,11 @@ yyreduce:
       (yyval.type_qualifier) = (yyvsp[0].type_qualifier);
       (yyval.type_qualifier).flags.q.constant = 1;
    }
-#line 3422 "glsl_parser.cpp"
+#line 3420 "glsl_parser.cpp"
     break;
 
   case 125:
-#line 986 "glsl_parser.yy"
+#line 984 "glsl_parser.yy"
    {
       if ((yyvsp[0].type_qualifier).flags.q.precise)
          _mesa_glsl_error(&(yylsp[-1]), state, "duplicate precise qualifier");
@@ -3430,11 +3428,11 @@ yyreduce:
       (yyval.type_qualifier) = (yyvsp[0].type_qualifier);
       (yyval.type_qualifier).flags.q.precise = 1;
    }
-#line 3434 "glsl_parser.cpp"
+#line 3432 "glsl_parser.cpp"
     break;
 
   case 126:
-#line 994 "glsl_parser.yy"
+#line 992 "glsl_parser.yy"
    {
       if (((yyvsp[-1].type_qualifier).flags.q.in || (yyvsp[-1].type_qualifier).flags.q.out) && ((yyvsp[0].type_qualifier).flags.q.in || (yyvsp[0].type_qualifier).flags.q.out))
          _mesa_glsl_error(&(yylsp[-1]), state, "duplicate in/out/inout qualifier");
@@ -3446,11 +3444,11 @@ yyreduce:
       (yyval.type_qualifier) = (yyvsp[-1].type_qualifier);
       (yyval.type_qualifier).merge_qualifier(&(yylsp[-1]), state, (yyvsp[0].type_qualifier), false);
    }
-#line 3450 "glsl_parser.cpp"
+#line 3448 "glsl_parser.cpp"
     break;
 
   case 127:
-#line 1006 "glsl_parser.yy"
+#line 1004 "glsl_parser.yy"
    {
       if ((yyvsp[0].type_qualifier).precision != ast_precision_none)
          _mesa_glsl_error(&(yylsp[-1]), state, "duplicate precision qualifier");
@@ -3462,48 +3460,48 @@ yyreduce:
       (yyval.type_qualifier) = (yyvsp[0].type_qualifier);
       (yyval.type_qualifier).precision = (yyvsp[-1].n);
    }
-#line 3466 "glsl_parser.cpp"
+#line 3464 "glsl_parser.cpp"
     break;
 
   case 128:
-#line 1018 "glsl_parser.yy"
+#line 1016 "glsl_parser.yy"
    {
       (yyval.type_qualifier) = (yyvsp[-1].type_qualifier);
       (yyval.type_qualifier).merge_qualifier(&(yylsp[-1]), state, (yyvsp[0].type_qualifier), false);
    }
-#line 3475 "glsl_parser.cpp"
+#line 3473 "glsl_parser.cpp"
     break;
 
   case 129:
-#line 1025 "glsl_parser.yy"
+#line 1023 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.in = 1;
    }
-#line 3484 "glsl_parser.cpp"
+#line 3482 "glsl_parser.cpp"
     break;
 
   case 130:
-#line 1030 "glsl_parser.yy"
+#line 1028 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.out = 1;
    }
-#line 3493 "glsl_parser.cpp"
+#line 3491 "glsl_parser.cpp"
     break;
 
   case 131:
-#line 1035 "glsl_parser.yy"
+#line 1033 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.in = 1;
       (yyval.type_qualifier).flags.q.out = 1;
    }
-#line 3503 "glsl_parser.cpp"
+#line 3501 "glsl_parser.cpp"
     break;
 
   case 134:
-#line 1049 "glsl_parser.yy"
+#line 1047 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       ast_declaration *decl = new(ctx) ast_declaration((yyvsp[0].identifier), NULL, NULL);
@@ -3513,11 +3511,11 @@ yyreduce:
       (yyval.declarator_list)->declarations.push_tail(&decl->link);
       state->symbols->add_variable(new(state) ir_variable(NULL, (yyvsp[0].identifier), ir_var_auto));
    }
-#line 3517 "glsl_parser.cpp"
+#line 3515 "glsl_parser.cpp"
     break;
 
   case 135:
-#line 1059 "glsl_parser.yy"
+#line 1057 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       ast_declaration *decl = new(ctx) ast_declaration((yyvsp[-1].identifier), (yyvsp[0].array_specifier), NULL);
@@ -3527,11 +3525,11 @@ yyreduce:
       (yyval.declarator_list)->declarations.push_tail(&decl->link);
       state->symbols->add_variable(new(state) ir_variable(NULL, (yyvsp[-1].identifier), ir_var_auto));
    }
-#line 3531 "glsl_parser.cpp"
+#line 3529 "glsl_parser.cpp"
     break;
 
   case 136:
-#line 1069 "glsl_parser.yy"
+#line 1067 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       ast_declaration *decl = new(ctx) ast_declaration((yyvsp[-3].identifier), (yyvsp[-2].array_specifier), (yyvsp[0].expression));
@@ -3541,11 +3539,11 @@ yyreduce:
       (yyval.declarator_list)->declarations.push_tail(&decl->link);
       state->symbols->add_variable(new(state) ir_variable(NULL, (yyvsp[-3].identifier), ir_var_auto));
    }
-#line 3545 "glsl_parser.cpp"
+#line 3543 "glsl_parser.cpp"
     break;
 
   case 137:
-#line 1079 "glsl_parser.yy"
+#line 1077 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       ast_declaration *decl = new(ctx) ast_declaration((yyvsp[-2].identifier), NULL, (yyvsp[0].expression));
@@ -3555,22 +3553,22 @@ yyreduce:
       (yyval.declarator_list)->declarations.push_tail(&decl->link);
       state->symbols->add_variable(new(state) ir_variable(NULL, (yyvsp[-2].identifier), ir_var_auto));
    }
-#line 3559 "glsl_parser.cpp"
+#line 3557 "glsl_parser.cpp"
     break;
 
   case 138:
-#line 1093 "glsl_parser.yy"
+#line 1091 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       /* Empty declaration list is valid. */
       (yyval.declarator_list) = new(ctx) ast_declarator_list((yyvsp[0].fully_specified_type));
       (yyval.declarator_list)->set_location((yylsp[0]));
    }
-#line 3570 "glsl_parser.cpp"
+#line 3568 "glsl_parser.cpp"
     break;
 
   case 139:
-#line 1100 "glsl_parser.yy"
+#line 1098 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       ast_declaration *decl = new(ctx) ast_declaration((yyvsp[0].identifier), NULL, NULL);
@@ -3581,11 +3579,11 @@ yyreduce:
       (yyval.declarator_list)->declarations.push_tail(&decl->link);
       state->symbols->add_variable(new(state) ir_variable(NULL, (yyvsp[0].identifier), ir_var_auto));
    }
-#line 3585 "glsl_parser.cpp"
+#line 3583 "glsl_parser.cpp"
     break;
 
   case 140:
-#line 1111 "glsl_parser.yy"
+#line 1109 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       ast_declaration *decl = new(ctx) ast_declaration((yyvsp[-1].identifier), (yyvsp[0].array_specifier), NULL);
@@ -3596,11 +3594,11 @@ yyreduce:
       (yyval.declarator_list)->declarations.push_tail(&decl->link);
       state->symbols->add_variable(new(state) ir_variable(NULL, (yyvsp[-1].identifier), ir_var_auto));
    }
-#line 3600 "glsl_parser.cpp"
+#line 3598 "glsl_parser.cpp"
     break;
 
   case 141:
-#line 1122 "glsl_parser.yy"
+#line 1120 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       ast_declaration *decl = new(ctx) ast_declaration((yyvsp[-3].identifier), (yyvsp[-2].array_specifier), (yyvsp[0].expression));
@@ -3611,11 +3609,11 @@ yyreduce:
       (yyval.declarator_list)->declarations.push_tail(&decl->link);
       state->symbols->add_variable(new(state) ir_variable(NULL, (yyvsp[-3].identifier), ir_var_auto));
    }
-#line 3615 "glsl_parser.cpp"
+#line 3613 "glsl_parser.cpp"
     break;
 
   case 142:
-#line 1133 "glsl_parser.yy"
+#line 1131 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       ast_declaration *decl = new(ctx) ast_declaration((yyvsp[-2].identifier), NULL, (yyvsp[0].expression));
@@ -3626,11 +3624,11 @@ yyreduce:
       (yyval.declarator_list)->declarations.push_tail(&decl->link);
       state->symbols->add_variable(new(state) ir_variable(NULL, (yyvsp[-2].identifier), ir_var_auto));
    }
-#line 3630 "glsl_parser.cpp"
+#line 3628 "glsl_parser.cpp"
     break;
 
   case 143:
-#line 1144 "glsl_parser.yy"
+#line 1142 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       ast_declaration *decl = new(ctx) ast_declaration((yyvsp[0].identifier), NULL, NULL);
@@ -3642,11 +3640,11 @@ yyreduce:
 
       (yyval.declarator_list)->declarations.push_tail(&decl->link);
    }
-#line 3646 "glsl_parser.cpp"
+#line 3644 "glsl_parser.cpp"
     break;
 
   case 144:
-#line 1156 "glsl_parser.yy"
+#line 1154 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       ast_declaration *decl = new(ctx) ast_declaration((yyvsp[0].identifier), NULL, NULL);
@@ -3658,22 +3656,22 @@ yyreduce:
 
       (yyval.declarator_list)->declarations.push_tail(&decl->link);
    }
-#line 3662 "glsl_parser.cpp"
+#line 3660 "glsl_parser.cpp"
     break;
 
   case 145:
-#line 1171 "glsl_parser.yy"
+#line 1169 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.fully_specified_type) = new(ctx) ast_fully_specified_type();
       (yyval.fully_specified_type)->set_location((yylsp[0]));
       (yyval.fully_specified_type)->specifier = (yyvsp[0].type_specifier);
    }
-#line 3673 "glsl_parser.cpp"
+#line 3671 "glsl_parser.cpp"
     break;
 
   case 146:
-#line 1178 "glsl_parser.yy"
+#line 1176 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.fully_specified_type) = new(ctx) ast_fully_specified_type();
@@ -3688,30 +3686,30 @@ yyreduce:
             (yyval.fully_specified_type)->specifier->structure->layout = &(yyval.fully_specified_type)->qualifier;
       }
    }
-#line 3692 "glsl_parser.cpp"
+#line 3690 "glsl_parser.cpp"
     break;
 
   case 147:
-#line 1196 "glsl_parser.yy"
+#line 1194 "glsl_parser.yy"
    {
       (yyval.type_qualifier) = (yyvsp[-1].type_qualifier);
    }
-#line 3700 "glsl_parser.cpp"
+#line 3698 "glsl_parser.cpp"
     break;
 
   case 149:
-#line 1204 "glsl_parser.yy"
+#line 1202 "glsl_parser.yy"
    {
       (yyval.type_qualifier) = (yyvsp[-2].type_qualifier);
       if (!(yyval.type_qualifier).merge_qualifier(& (yylsp[0]), state, (yyvsp[0].type_qualifier), true)) {
          YYERROR;
       }
    }
-#line 3711 "glsl_parser.cpp"
+#line 3709 "glsl_parser.cpp"
     break;
 
   case 150:
-#line 1214 "glsl_parser.yy"
+#line 1212 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
 
@@ -4215,11 +4213,11 @@ yyreduce:
          YYERROR;
       }
    }
-#line 4219 "glsl_parser.cpp"
+#line 4217 "glsl_parser.cpp"
     break;
 
   case 151:
-#line 1718 "glsl_parser.yy"
+#line 1716 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       void *ctx = state->linalloc;
@@ -4384,11 +4382,11 @@ yyreduce:
          YYERROR;
       }
    }
-#line 4388 "glsl_parser.cpp"
+#line 4386 "glsl_parser.cpp"
     break;
 
   case 152:
-#line 1883 "glsl_parser.yy"
+#line 1881 "glsl_parser.yy"
    {
       (yyval.type_qualifier) = (yyvsp[0].type_qualifier);
       /* Layout qualifiers for ARB_uniform_buffer_object. */
@@ -4402,57 +4400,57 @@ yyreduce:
                             "layout qualifier `%s' is used", (yyvsp[0].type_qualifier));
       }
    }
-#line 4406 "glsl_parser.cpp"
+#line 4404 "glsl_parser.cpp"
     break;
 
   case 153:
-#line 1909 "glsl_parser.yy"
+#line 1907 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.row_major = 1;
    }
-#line 4415 "glsl_parser.cpp"
+#line 4413 "glsl_parser.cpp"
     break;
 
   case 154:
-#line 1914 "glsl_parser.yy"
+#line 1912 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.packed = 1;
    }
-#line 4424 "glsl_parser.cpp"
+#line 4422 "glsl_parser.cpp"
     break;
 
   case 155:
-#line 1919 "glsl_parser.yy"
+#line 1917 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.shared = 1;
    }
-#line 4433 "glsl_parser.cpp"
+#line 4431 "glsl_parser.cpp"
     break;
 
   case 156:
-#line 1927 "glsl_parser.yy"
+#line 1925 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.subroutine = 1;
    }
-#line 4442 "glsl_parser.cpp"
+#line 4440 "glsl_parser.cpp"
     break;
 
   case 157:
-#line 1932 "glsl_parser.yy"
+#line 1930 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.subroutine = 1;
       (yyval.type_qualifier).subroutine_list = (yyvsp[-1].subroutine_list);
    }
-#line 4452 "glsl_parser.cpp"
+#line 4450 "glsl_parser.cpp"
     break;
 
   case 158:
-#line 1941 "glsl_parser.yy"
+#line 1939 "glsl_parser.yy"
    {
         void *ctx = state->linalloc;
         ast_declaration *decl = new(ctx)  ast_declaration((yyvsp[0].identifier), NULL, NULL);
@@ -4461,11 +4459,11 @@ yyreduce:
         (yyval.subroutine_list) = new(ctx) ast_subroutine_list();
         (yyval.subroutine_list)->declarations.push_tail(&decl->link);
    }
-#line 4465 "glsl_parser.cpp"
+#line 4463 "glsl_parser.cpp"
     break;
 
   case 159:
-#line 1950 "glsl_parser.yy"
+#line 1948 "glsl_parser.yy"
    {
         void *ctx = state->linalloc;
         ast_declaration *decl = new(ctx)  ast_declaration((yyvsp[0].identifier), NULL, NULL);
@@ -4474,65 +4472,65 @@ yyreduce:
         (yyval.subroutine_list) = (yyvsp[-2].subroutine_list);
         (yyval.subroutine_list)->declarations.push_tail(&decl->link);
    }
-#line 4478 "glsl_parser.cpp"
+#line 4476 "glsl_parser.cpp"
     break;
 
   case 160:
-#line 1962 "glsl_parser.yy"
+#line 1960 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.smooth = 1;
    }
-#line 4487 "glsl_parser.cpp"
+#line 4485 "glsl_parser.cpp"
     break;
 
   case 161:
-#line 1967 "glsl_parser.yy"
+#line 1965 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.flat = 1;
    }
-#line 4496 "glsl_parser.cpp"
+#line 4494 "glsl_parser.cpp"
     break;
 
   case 162:
-#line 1972 "glsl_parser.yy"
+#line 1970 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.noperspective = 1;
    }
-#line 4505 "glsl_parser.cpp"
+#line 4503 "glsl_parser.cpp"
     break;
 
   case 163:
-#line 1981 "glsl_parser.yy"
+#line 1979 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.invariant = 1;
    }
-#line 4514 "glsl_parser.cpp"
+#line 4512 "glsl_parser.cpp"
     break;
 
   case 164:
-#line 1986 "glsl_parser.yy"
+#line 1984 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.precise = 1;
    }
-#line 4523 "glsl_parser.cpp"
+#line 4521 "glsl_parser.cpp"
     break;
 
   case 171:
-#line 1997 "glsl_parser.yy"
+#line 1995 "glsl_parser.yy"
    {
       memset(&(yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).precision = (yyvsp[0].n);
    }
-#line 4532 "glsl_parser.cpp"
+#line 4530 "glsl_parser.cpp"
     break;
 
   case 172:
-#line 2015 "glsl_parser.yy"
+#line 2013 "glsl_parser.yy"
    {
       if ((yyvsp[0].type_qualifier).flags.q.precise)
          _mesa_glsl_error(&(yylsp[-1]), state, "duplicate \"precise\" qualifier");
@@ -4540,11 +4538,11 @@ yyreduce:
       (yyval.type_qualifier) = (yyvsp[0].type_qualifier);
       (yyval.type_qualifier).flags.q.precise = 1;
    }
-#line 4544 "glsl_parser.cpp"
+#line 4542 "glsl_parser.cpp"
     break;
 
   case 173:
-#line 2023 "glsl_parser.yy"
+#line 2021 "glsl_parser.yy"
    {
       if ((yyvsp[0].type_qualifier).flags.q.invariant)
          _mesa_glsl_error(&(yylsp[-1]), state, "duplicate \"invariant\" qualifier");
@@ -4569,11 +4567,11 @@ yyreduce:
       if (state->is_version(430, 300) && (yyval.type_qualifier).flags.q.in)
          _mesa_glsl_error(&(yylsp[-1]), state, "invariant qualifiers cannot be used with shader inputs");
    }
-#line 4573 "glsl_parser.cpp"
+#line 4571 "glsl_parser.cpp"
     break;
 
   case 174:
-#line 2048 "glsl_parser.yy"
+#line 2046 "glsl_parser.yy"
    {
       /* Section 4.3 of the GLSL 1.40 specification states:
        * "...qualified with one of these interpolation qualifiers"
@@ -4597,11 +4595,11 @@ yyreduce:
       (yyval.type_qualifier) = (yyvsp[-1].type_qualifier);
       (yyval.type_qualifier).merge_qualifier(&(yylsp[-1]), state, (yyvsp[0].type_qualifier), false);
    }
-#line 4601 "glsl_parser.cpp"
+#line 4599 "glsl_parser.cpp"
     break;
 
   case 175:
-#line 2072 "glsl_parser.yy"
+#line 2070 "glsl_parser.yy"
    {
       /* In the absence of ARB_shading_language_420pack, layout qualifiers may
        * appear no later than auxiliary storage qualifiers. There is no
@@ -4615,20 +4613,20 @@ yyreduce:
       (yyval.type_qualifier) = (yyvsp[-1].type_qualifier);
       (yyval.type_qualifier).merge_qualifier(& (yylsp[-1]), state, (yyvsp[0].type_qualifier), false, (yyvsp[0].type_qualifier).has_layout());
    }
-#line 4619 "glsl_parser.cpp"
+#line 4617 "glsl_parser.cpp"
     break;
 
   case 176:
-#line 2086 "glsl_parser.yy"
+#line 2084 "glsl_parser.yy"
    {
       (yyval.type_qualifier) = (yyvsp[-1].type_qualifier);
       (yyval.type_qualifier).merge_qualifier(&(yylsp[-1]), state, (yyvsp[0].type_qualifier), false);
    }
-#line 4628 "glsl_parser.cpp"
+#line 4626 "glsl_parser.cpp"
     break;
 
   case 177:
-#line 2091 "glsl_parser.yy"
+#line 2089 "glsl_parser.yy"
    {
       if ((yyvsp[0].type_qualifier).has_auxiliary_storage()) {
          _mesa_glsl_error(&(yylsp[-1]), state,
@@ -4644,11 +4642,11 @@ yyreduce:
       (yyval.type_qualifier) = (yyvsp[-1].type_qualifier);
       (yyval.type_qualifier).merge_qualifier(&(yylsp[-1]), state, (yyvsp[0].type_qualifier), false);
    }
-#line 4648 "glsl_parser.cpp"
+#line 4646 "glsl_parser.cpp"
     break;
 
   case 178:
-#line 2107 "glsl_parser.yy"
+#line 2105 "glsl_parser.yy"
    {
       /* Section 4.3 of the GLSL 1.20 specification states:
        * "Variable declarations may have a storage qualifier specified..."
@@ -4673,11 +4671,11 @@ yyreduce:
       (yyval.type_qualifier) = (yyvsp[-1].type_qualifier);
       (yyval.type_qualifier).merge_qualifier(&(yylsp[-1]), state, (yyvsp[0].type_qualifier), false);
    }
-#line 4677 "glsl_parser.cpp"
+#line 4675 "glsl_parser.cpp"
     break;
 
   case 179:
-#line 2132 "glsl_parser.yy"
+#line 2130 "glsl_parser.yy"
    {
       if ((yyvsp[0].type_qualifier).precision != ast_precision_none)
          _mesa_glsl_error(&(yylsp[-1]), state, "duplicate precision qualifier");
@@ -4689,83 +4687,83 @@ yyreduce:
       (yyval.type_qualifier) = (yyvsp[0].type_qualifier);
       (yyval.type_qualifier).precision = (yyvsp[-1].n);
    }
-#line 4693 "glsl_parser.cpp"
+#line 4691 "glsl_parser.cpp"
     break;
 
   case 180:
-#line 2144 "glsl_parser.yy"
+#line 2142 "glsl_parser.yy"
    {
       (yyval.type_qualifier) = (yyvsp[-1].type_qualifier);
       (yyval.type_qualifier).merge_qualifier(&(yylsp[-1]), state, (yyvsp[0].type_qualifier), false);
    }
-#line 4702 "glsl_parser.cpp"
+#line 4700 "glsl_parser.cpp"
     break;
 
   case 181:
-#line 2152 "glsl_parser.yy"
+#line 2150 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.centroid = 1;
    }
-#line 4711 "glsl_parser.cpp"
+#line 4709 "glsl_parser.cpp"
     break;
 
   case 182:
-#line 2157 "glsl_parser.yy"
+#line 2155 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.sample = 1;
    }
-#line 4720 "glsl_parser.cpp"
+#line 4718 "glsl_parser.cpp"
     break;
 
   case 183:
-#line 2162 "glsl_parser.yy"
+#line 2160 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.patch = 1;
    }
-#line 4729 "glsl_parser.cpp"
+#line 4727 "glsl_parser.cpp"
     break;
 
   case 184:
-#line 2169 "glsl_parser.yy"
+#line 2167 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.constant = 1;
    }
-#line 4738 "glsl_parser.cpp"
+#line 4736 "glsl_parser.cpp"
     break;
 
   case 185:
-#line 2174 "glsl_parser.yy"
+#line 2172 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.attribute = 1;
    }
-#line 4747 "glsl_parser.cpp"
+#line 4745 "glsl_parser.cpp"
     break;
 
   case 186:
-#line 2179 "glsl_parser.yy"
+#line 2177 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.varying = 1;
    }
-#line 4756 "glsl_parser.cpp"
+#line 4754 "glsl_parser.cpp"
     break;
 
   case 187:
-#line 2184 "glsl_parser.yy"
+#line 2182 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.in = 1;
    }
-#line 4765 "glsl_parser.cpp"
+#line 4763 "glsl_parser.cpp"
     break;
 
   case 188:
-#line 2189 "glsl_parser.yy"
+#line 2187 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.out = 1;
@@ -4790,11 +4788,11 @@ yyreduce:
           (yyval.type_qualifier).xfb_buffer = state->out_qualifier->xfb_buffer;
       }
    }
-#line 4794 "glsl_parser.cpp"
+#line 4792 "glsl_parser.cpp"
     break;
 
   case 189:
-#line 2214 "glsl_parser.yy"
+#line 2212 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.in = 1;
@@ -4806,84 +4804,84 @@ yyreduce:
          _mesa_glsl_error(&(yylsp[0]), state, "A single interface variable cannot be "
                           "declared as both input and output");
    }
-#line 4810 "glsl_parser.cpp"
+#line 4808 "glsl_parser.cpp"
     break;
 
   case 190:
-#line 2226 "glsl_parser.yy"
+#line 2224 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.uniform = 1;
    }
-#line 4819 "glsl_parser.cpp"
+#line 4817 "glsl_parser.cpp"
     break;
 
   case 191:
-#line 2231 "glsl_parser.yy"
+#line 2229 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.buffer = 1;
    }
-#line 4828 "glsl_parser.cpp"
+#line 4826 "glsl_parser.cpp"
     break;
 
   case 192:
-#line 2236 "glsl_parser.yy"
+#line 2234 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.shared_storage = 1;
    }
-#line 4837 "glsl_parser.cpp"
+#line 4835 "glsl_parser.cpp"
     break;
 
   case 193:
-#line 2244 "glsl_parser.yy"
+#line 2242 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.coherent = 1;
    }
-#line 4846 "glsl_parser.cpp"
+#line 4844 "glsl_parser.cpp"
     break;
 
   case 194:
-#line 2249 "glsl_parser.yy"
+#line 2247 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q._volatile = 1;
    }
-#line 4855 "glsl_parser.cpp"
+#line 4853 "glsl_parser.cpp"
     break;
 
   case 195:
-#line 2254 "glsl_parser.yy"
+#line 2252 "glsl_parser.yy"
    {
       STATIC_ASSERT(sizeof((yyval.type_qualifier).flags.q) <= sizeof((yyval.type_qualifier).flags.i));
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.restrict_flag = 1;
    }
-#line 4865 "glsl_parser.cpp"
+#line 4863 "glsl_parser.cpp"
     break;
 
   case 196:
-#line 2260 "glsl_parser.yy"
+#line 2258 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.read_only = 1;
    }
-#line 4874 "glsl_parser.cpp"
+#line 4872 "glsl_parser.cpp"
     break;
 
   case 197:
-#line 2265 "glsl_parser.yy"
+#line 2263 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.write_only = 1;
    }
-#line 4883 "glsl_parser.cpp"
+#line 4881 "glsl_parser.cpp"
     break;
 
   case 198:
-#line 2273 "glsl_parser.yy"
+#line 2271 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.array_specifier) = new(ctx) ast_array_specifier((yylsp[-1]), new(ctx) ast_expression(
@@ -4891,21 +4889,21 @@ yyreduce:
                                                   NULL, NULL));
       (yyval.array_specifier)->set_location_range((yylsp[-1]), (yylsp[0]));
    }
-#line 4895 "glsl_parser.cpp"
+#line 4893 "glsl_parser.cpp"
     break;
 
   case 199:
-#line 2281 "glsl_parser.yy"
+#line 2279 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.array_specifier) = new(ctx) ast_array_specifier((yylsp[-2]), (yyvsp[-1].expression));
       (yyval.array_specifier)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 4905 "glsl_parser.cpp"
+#line 4903 "glsl_parser.cpp"
     break;
 
   case 200:
-#line 2287 "glsl_parser.yy"
+#line 2285 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.array_specifier) = (yyvsp[-2].array_specifier);
@@ -4915,11 +4913,11 @@ yyreduce:
                                                    NULL, NULL));
       }
    }
-#line 4919 "glsl_parser.cpp"
+#line 4917 "glsl_parser.cpp"
     break;
 
   case 201:
-#line 2297 "glsl_parser.yy"
+#line 2295 "glsl_parser.yy"
    {
       (yyval.array_specifier) = (yyvsp[-3].array_specifier);
 
@@ -4927,62 +4925,62 @@ yyreduce:
          (yyval.array_specifier)->add_dimension((yyvsp[-1].expression));
       }
    }
-#line 4931 "glsl_parser.cpp"
+#line 4929 "glsl_parser.cpp"
     break;
 
   case 203:
-#line 2309 "glsl_parser.yy"
+#line 2307 "glsl_parser.yy"
    {
       (yyval.type_specifier) = (yyvsp[-1].type_specifier);
       (yyval.type_specifier)->array_specifier = (yyvsp[0].array_specifier);
    }
-#line 4940 "glsl_parser.cpp"
+#line 4938 "glsl_parser.cpp"
     break;
 
   case 204:
-#line 2317 "glsl_parser.yy"
+#line 2315 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.type_specifier) = new(ctx) ast_type_specifier((yyvsp[0].type));
       (yyval.type_specifier)->set_location((yylsp[0]));
    }
-#line 4950 "glsl_parser.cpp"
+#line 4948 "glsl_parser.cpp"
     break;
 
   case 205:
-#line 2323 "glsl_parser.yy"
+#line 2321 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.type_specifier) = new(ctx) ast_type_specifier((yyvsp[0].struct_specifier));
       (yyval.type_specifier)->set_location((yylsp[0]));
    }
-#line 4960 "glsl_parser.cpp"
+#line 4958 "glsl_parser.cpp"
     break;
 
   case 206:
-#line 2329 "glsl_parser.yy"
+#line 2327 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.type_specifier) = new(ctx) ast_type_specifier((yyvsp[0].identifier));
       (yyval.type_specifier)->set_location((yylsp[0]));
    }
-#line 4970 "glsl_parser.cpp"
+#line 4968 "glsl_parser.cpp"
     break;
 
   case 207:
-#line 2337 "glsl_parser.yy"
+#line 2335 "glsl_parser.yy"
                             { (yyval.type) = glsl_type::void_type; }
-#line 4976 "glsl_parser.cpp"
+#line 4974 "glsl_parser.cpp"
     break;
 
   case 208:
-#line 2338 "glsl_parser.yy"
+#line 2336 "glsl_parser.yy"
                             { (yyval.type) = (yyvsp[0].type); }
-#line 4982 "glsl_parser.cpp"
+#line 4980 "glsl_parser.cpp"
     break;
 
   case 209:
-#line 2340 "glsl_parser.yy"
+#line 2338 "glsl_parser.yy"
    {
       if ((yyvsp[0].type) == glsl_type::int_type) {
          (yyval.type) = glsl_type::uint_type;
@@ -4991,49 +4989,49 @@ yyreduce:
                           "\"unsigned\" is only allowed before \"int\"");
       }
    }
-#line 4995 "glsl_parser.cpp"
+#line 4993 "glsl_parser.cpp"
     break;
 
   case 210:
-#line 2352 "glsl_parser.yy"
+#line 2350 "glsl_parser.yy"
    {
       state->check_precision_qualifiers_allowed(&(yylsp[0]));
       (yyval.n) = ast_precision_high;
    }
-#line 5004 "glsl_parser.cpp"
+#line 5002 "glsl_parser.cpp"
     break;
 
   case 211:
-#line 2357 "glsl_parser.yy"
+#line 2355 "glsl_parser.yy"
    {
       state->check_precision_qualifiers_allowed(&(yylsp[0]));
       (yyval.n) = ast_precision_medium;
    }
-#line 5013 "glsl_parser.cpp"
+#line 5011 "glsl_parser.cpp"
     break;
 
   case 212:
-#line 2362 "glsl_parser.yy"
+#line 2360 "glsl_parser.yy"
    {
       state->check_precision_qualifiers_allowed(&(yylsp[0]));
       (yyval.n) = ast_precision_low;
    }
-#line 5022 "glsl_parser.cpp"
+#line 5020 "glsl_parser.cpp"
     break;
 
   case 213:
-#line 2370 "glsl_parser.yy"
+#line 2368 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.struct_specifier) = new(ctx) ast_struct_specifier((yyvsp[-3].identifier), (yyvsp[-1].declarator_list));
       (yyval.struct_specifier)->set_location_range((yylsp[-3]), (yylsp[0]));
       state->symbols->add_type((yyvsp[-3].identifier), glsl_type::void_type);
    }
-#line 5033 "glsl_parser.cpp"
+#line 5031 "glsl_parser.cpp"
     break;
 
   case 214:
-#line 2377 "glsl_parser.yy"
+#line 2375 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
 
@@ -5047,29 +5045,29 @@ yyreduce:
 
       (yyval.struct_specifier)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 5051 "glsl_parser.cpp"
+#line 5049 "glsl_parser.cpp"
     break;
 
   case 215:
-#line 2394 "glsl_parser.yy"
+#line 2392 "glsl_parser.yy"
    {
       (yyval.declarator_list) = (yyvsp[0].declarator_list);
       (yyvsp[0].declarator_list)->link.self_link();
    }
-#line 5060 "glsl_parser.cpp"
+#line 5058 "glsl_parser.cpp"
     break;
 
   case 216:
-#line 2399 "glsl_parser.yy"
+#line 2397 "glsl_parser.yy"
    {
       (yyval.declarator_list) = (yyvsp[-1].declarator_list);
       (yyval.declarator_list)->link.insert_before(& (yyvsp[0].declarator_list)->link);
    }
-#line 5069 "glsl_parser.cpp"
+#line 5067 "glsl_parser.cpp"
     break;
 
   case 217:
-#line 2407 "glsl_parser.yy"
+#line 2405 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       ast_fully_specified_type *const type = (yyvsp[-2].fully_specified_type);
@@ -5104,145 +5102,145 @@ yyreduce:
 
       (yyval.declarator_list)->declarations.push_degenerate_list_at_head(& (yyvsp[-1].declaration)->link);
    }
-#line 5108 "glsl_parser.cpp"
+#line 5106 "glsl_parser.cpp"
     break;
 
   case 218:
-#line 2445 "glsl_parser.yy"
+#line 2443 "glsl_parser.yy"
    {
       (yyval.declaration) = (yyvsp[0].declaration);
       (yyvsp[0].declaration)->link.self_link();
    }
-#line 5117 "glsl_parser.cpp"
+#line 5115 "glsl_parser.cpp"
     break;
 
   case 219:
-#line 2450 "glsl_parser.yy"
+#line 2448 "glsl_parser.yy"
    {
       (yyval.declaration) = (yyvsp[-2].declaration);
       (yyval.declaration)->link.insert_before(& (yyvsp[0].declaration)->link);
    }
-#line 5126 "glsl_parser.cpp"
+#line 5124 "glsl_parser.cpp"
     break;
 
   case 220:
-#line 2458 "glsl_parser.yy"
+#line 2456 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.declaration) = new(ctx) ast_declaration((yyvsp[0].identifier), NULL, NULL);
       (yyval.declaration)->set_location((yylsp[0]));
    }
-#line 5136 "glsl_parser.cpp"
+#line 5134 "glsl_parser.cpp"
     break;
 
   case 221:
-#line 2464 "glsl_parser.yy"
+#line 2462 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.declaration) = new(ctx) ast_declaration((yyvsp[-1].identifier), (yyvsp[0].array_specifier), NULL);
       (yyval.declaration)->set_location_range((yylsp[-1]), (yylsp[0]));
    }
-#line 5146 "glsl_parser.cpp"
+#line 5144 "glsl_parser.cpp"
     break;
 
   case 223:
-#line 2474 "glsl_parser.yy"
+#line 2472 "glsl_parser.yy"
    {
       (yyval.expression) = (yyvsp[-1].expression);
    }
-#line 5154 "glsl_parser.cpp"
+#line 5152 "glsl_parser.cpp"
     break;
 
   case 224:
-#line 2478 "glsl_parser.yy"
+#line 2476 "glsl_parser.yy"
    {
       (yyval.expression) = (yyvsp[-2].expression);
    }
-#line 5162 "glsl_parser.cpp"
+#line 5160 "glsl_parser.cpp"
     break;
 
   case 225:
-#line 2485 "glsl_parser.yy"
+#line 2483 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.expression) = new(ctx) ast_aggregate_initializer();
       (yyval.expression)->set_location((yylsp[0]));
       (yyval.expression)->expressions.push_tail(& (yyvsp[0].expression)->link);
    }
-#line 5173 "glsl_parser.cpp"
+#line 5171 "glsl_parser.cpp"
     break;
 
   case 226:
-#line 2492 "glsl_parser.yy"
+#line 2490 "glsl_parser.yy"
    {
       (yyvsp[-2].expression)->expressions.push_tail(& (yyvsp[0].expression)->link);
    }
-#line 5181 "glsl_parser.cpp"
+#line 5179 "glsl_parser.cpp"
     break;
 
   case 228:
-#line 2504 "glsl_parser.yy"
+#line 2502 "glsl_parser.yy"
                              { (yyval.node) = (ast_node *) (yyvsp[0].compound_statement); }
-#line 5187 "glsl_parser.cpp"
+#line 5185 "glsl_parser.cpp"
     break;
 
   case 237:
-#line 2520 "glsl_parser.yy"
+#line 2518 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.compound_statement) = new(ctx) ast_compound_statement(true, NULL);
       (yyval.compound_statement)->set_location_range((yylsp[-1]), (yylsp[0]));
    }
-#line 5197 "glsl_parser.cpp"
+#line 5195 "glsl_parser.cpp"
     break;
 
   case 238:
-#line 2526 "glsl_parser.yy"
+#line 2524 "glsl_parser.yy"
    {
       state->symbols->push_scope();
    }
-#line 5205 "glsl_parser.cpp"
+#line 5203 "glsl_parser.cpp"
     break;
 
   case 239:
-#line 2530 "glsl_parser.yy"
+#line 2528 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.compound_statement) = new(ctx) ast_compound_statement(true, (yyvsp[-1].node));
       (yyval.compound_statement)->set_location_range((yylsp[-3]), (yylsp[0]));
       state->symbols->pop_scope();
    }
-#line 5216 "glsl_parser.cpp"
+#line 5214 "glsl_parser.cpp"
     break;
 
   case 240:
-#line 2539 "glsl_parser.yy"
+#line 2537 "glsl_parser.yy"
                                    { (yyval.node) = (ast_node *) (yyvsp[0].compound_statement); }
-#line 5222 "glsl_parser.cpp"
+#line 5220 "glsl_parser.cpp"
     break;
 
   case 242:
-#line 2545 "glsl_parser.yy"
+#line 2543 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.compound_statement) = new(ctx) ast_compound_statement(false, NULL);
       (yyval.compound_statement)->set_location_range((yylsp[-1]), (yylsp[0]));
    }
-#line 5232 "glsl_parser.cpp"
+#line 5230 "glsl_parser.cpp"
     break;
 
   case 243:
-#line 2551 "glsl_parser.yy"
+#line 2549 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.compound_statement) = new(ctx) ast_compound_statement(false, (yyvsp[-1].node));
       (yyval.compound_statement)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 5242 "glsl_parser.cpp"
+#line 5240 "glsl_parser.cpp"
     break;
 
   case 244:
-#line 2560 "glsl_parser.yy"
+#line 2558 "glsl_parser.yy"
    {
       if ((yyvsp[0].node) == NULL) {
          _mesa_glsl_error(& (yylsp[0]), state, "<nil> statement");
@@ -5252,11 +5250,11 @@ yyreduce:
       (yyval.node) = (yyvsp[0].node);
       (yyval.node)->link.self_link();
    }
-#line 5256 "glsl_parser.cpp"
+#line 5254 "glsl_parser.cpp"
     break;
 
   case 245:
-#line 2570 "glsl_parser.yy"
+#line 2568 "glsl_parser.yy"
    {
       if ((yyvsp[0].node) == NULL) {
          _mesa_glsl_error(& (yylsp[0]), state, "<nil> statement");
@@ -5265,11 +5263,11 @@ yyreduce:
       (yyval.node) = (yyvsp[-1].node);
       (yyval.node)->link.insert_before(& (yyvsp[0].node)->link);
    }
-#line 5269 "glsl_parser.cpp"
+#line 5267 "glsl_parser.cpp"
     break;
 
   case 246:
-#line 2579 "glsl_parser.yy"
+#line 2577 "glsl_parser.yy"
    {
       if (!state->allow_extension_directive_midshader) {
          _mesa_glsl_error(& (yylsp[-1]), state,
@@ -5278,67 +5276,67 @@ yyreduce:
          YYERROR;
       }
    }
-#line 5282 "glsl_parser.cpp"
+#line 5280 "glsl_parser.cpp"
     break;
 
   case 247:
-#line 2591 "glsl_parser.yy"
+#line 2589 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.node) = new(ctx) ast_expression_statement(NULL);
       (yyval.node)->set_location((yylsp[0]));
    }
-#line 5292 "glsl_parser.cpp"
+#line 5290 "glsl_parser.cpp"
     break;
 
   case 248:
-#line 2597 "glsl_parser.yy"
+#line 2595 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.node) = new(ctx) ast_expression_statement((yyvsp[-1].expression));
       (yyval.node)->set_location((yylsp[-1]));
    }
-#line 5302 "glsl_parser.cpp"
+#line 5300 "glsl_parser.cpp"
     break;
 
   case 249:
-#line 2606 "glsl_parser.yy"
+#line 2604 "glsl_parser.yy"
    {
       (yyval.node) = new(state->linalloc) ast_selection_statement((yyvsp[-2].expression), (yyvsp[0].selection_rest_statement).then_statement,
                                                         (yyvsp[0].selection_rest_statement).else_statement);
       (yyval.node)->set_location_range((yylsp[-4]), (yylsp[0]));
    }
-#line 5312 "glsl_parser.cpp"
+#line 5310 "glsl_parser.cpp"
     break;
 
   case 250:
-#line 2615 "glsl_parser.yy"
+#line 2613 "glsl_parser.yy"
    {
       (yyval.selection_rest_statement).then_statement = (yyvsp[-2].node);
       (yyval.selection_rest_statement).else_statement = (yyvsp[0].node);
    }
-#line 5321 "glsl_parser.cpp"
+#line 5319 "glsl_parser.cpp"
     break;
 
   case 251:
-#line 2620 "glsl_parser.yy"
+#line 2618 "glsl_parser.yy"
    {
       (yyval.selection_rest_statement).then_statement = (yyvsp[0].node);
       (yyval.selection_rest_statement).else_statement = NULL;
    }
-#line 5330 "glsl_parser.cpp"
+#line 5328 "glsl_parser.cpp"
     break;
 
   case 252:
-#line 2628 "glsl_parser.yy"
+#line 2626 "glsl_parser.yy"
    {
       (yyval.node) = (ast_node *) (yyvsp[0].expression);
    }
-#line 5338 "glsl_parser.cpp"
+#line 5336 "glsl_parser.cpp"
     break;
 
   case 253:
-#line 2632 "glsl_parser.yy"
+#line 2630 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       ast_declaration *decl = new(ctx) ast_declaration((yyvsp[-2].identifier), NULL, (yyvsp[0].expression));
@@ -5349,56 +5347,56 @@ yyreduce:
       declarator->declarations.push_tail(&decl->link);
       (yyval.node) = declarator;
    }
-#line 5353 "glsl_parser.cpp"
+#line 5351 "glsl_parser.cpp"
     break;
 
   case 254:
-#line 2650 "glsl_parser.yy"
+#line 2648 "glsl_parser.yy"
    {
       (yyval.node) = new(state->linalloc) ast_switch_statement((yyvsp[-2].expression), (yyvsp[0].switch_body));
       (yyval.node)->set_location_range((yylsp[-4]), (yylsp[0]));
    }
-#line 5362 "glsl_parser.cpp"
+#line 5360 "glsl_parser.cpp"
     break;
 
   case 255:
-#line 2658 "glsl_parser.yy"
+#line 2656 "glsl_parser.yy"
    {
       (yyval.switch_body) = new(state->linalloc) ast_switch_body(NULL);
       (yyval.switch_body)->set_location_range((yylsp[-1]), (yylsp[0]));
    }
-#line 5371 "glsl_parser.cpp"
+#line 5369 "glsl_parser.cpp"
     break;
 
   case 256:
-#line 2663 "glsl_parser.yy"
+#line 2661 "glsl_parser.yy"
    {
       (yyval.switch_body) = new(state->linalloc) ast_switch_body((yyvsp[-1].case_statement_list));
       (yyval.switch_body)->set_location_range((yylsp[-2]), (yylsp[0]));
    }
-#line 5380 "glsl_parser.cpp"
+#line 5378 "glsl_parser.cpp"
     break;
 
   case 257:
-#line 2671 "glsl_parser.yy"
+#line 2669 "glsl_parser.yy"
    {
       (yyval.case_label) = new(state->linalloc) ast_case_label((yyvsp[-1].expression));
       (yyval.case_label)->set_location((yylsp[-1]));
    }
-#line 5389 "glsl_parser.cpp"
+#line 5387 "glsl_parser.cpp"
     break;
 
   case 258:
-#line 2676 "glsl_parser.yy"
+#line 2674 "glsl_parser.yy"
    {
       (yyval.case_label) = new(state->linalloc) ast_case_label(NULL);
       (yyval.case_label)->set_location((yylsp[0]));
    }
-#line 5398 "glsl_parser.cpp"
+#line 5396 "glsl_parser.cpp"
     break;
 
   case 259:
-#line 2684 "glsl_parser.yy"
+#line 2682 "glsl_parser.yy"
    {
       ast_case_label_list *labels = new(state->linalloc) ast_case_label_list();
 
@@ -5406,20 +5404,20 @@ yyreduce:
       (yyval.case_label_list) = labels;
       (yyval.case_label_list)->set_location((yylsp[0]));
    }
-#line 5410 "glsl_parser.cpp"
+#line 5408 "glsl_parser.cpp"
     break;
 
   case 260:
-#line 2692 "glsl_parser.yy"
+#line 2690 "glsl_parser.yy"
    {
       (yyval.case_label_list) = (yyvsp[-1].case_label_list);
       (yyval.case_label_list)->labels.push_tail(& (yyvsp[0].case_label)->link);
    }
-#line 5419 "glsl_parser.cpp"
+#line 5417 "glsl_parser.cpp"
     break;
 
   case 261:
-#line 2700 "glsl_parser.yy"
+#line 2698 "glsl_parser.yy"
    {
       ast_case_statement *stmts = new(state->linalloc) ast_case_statement((yyvsp[-1].case_label_list));
       stmts->set_location((yylsp[0]));
@@ -5427,20 +5425,20 @@ yyreduce:
       stmts->stmts.push_tail(& (yyvsp[0].node)->link);
       (yyval.case_statement) = stmts;
    }
-#line 5431 "glsl_parser.cpp"
+#line 5429 "glsl_parser.cpp"
     break;
 
   case 262:
-#line 2708 "glsl_parser.yy"
+#line 2706 "glsl_parser.yy"
    {
       (yyval.case_statement) = (yyvsp[-1].case_statement);
       (yyval.case_statement)->stmts.push_tail(& (yyvsp[0].node)->link);
    }
-#line 5440 "glsl_parser.cpp"
+#line 5438 "glsl_parser.cpp"
     break;
 
   case 263:
-#line 2716 "glsl_parser.yy"
+#line 2714 "glsl_parser.yy"
    {
       ast_case_statement_list *cases= new(state->linalloc) ast_case_statement_list();
       cases->set_location((yylsp[0]));
@@ -5448,169 +5446,169 @@ yyreduce:
       cases->cases.push_tail(& (yyvsp[0].case_statement)->link);
       (yyval.case_statement_list) = cases;
    }
-#line 5452 "glsl_parser.cpp"
+#line 5450 "glsl_parser.cpp"
     break;
 
   case 264:
-#line 2724 "glsl_parser.yy"
+#line 2722 "glsl_parser.yy"
    {
       (yyval.case_statement_list) = (yyvsp[-1].case_statement_list);
       (yyval.case_statement_list)->cases.push_tail(& (yyvsp[0].case_statement)->link);
    }
-#line 5461 "glsl_parser.cpp"
+#line 5459 "glsl_parser.cpp"
     break;
 
   case 265:
-#line 2732 "glsl_parser.yy"
+#line 2730 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.node) = new(ctx) ast_iteration_statement(ast_iteration_statement::ast_while,
                                             NULL, (yyvsp[-2].node), NULL, (yyvsp[0].node));
       (yyval.node)->set_location_range((yylsp[-4]), (yylsp[-1]));
    }
-#line 5472 "glsl_parser.cpp"
+#line 5470 "glsl_parser.cpp"
     break;
 
   case 266:
-#line 2739 "glsl_parser.yy"
+#line 2737 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.node) = new(ctx) ast_iteration_statement(ast_iteration_statement::ast_do_while,
                                             NULL, (yyvsp[-2].expression), NULL, (yyvsp[-5].node));
       (yyval.node)->set_location_range((yylsp[-6]), (yylsp[-1]));
    }
-#line 5483 "glsl_parser.cpp"
+#line 5481 "glsl_parser.cpp"
     break;
 
   case 267:
-#line 2746 "glsl_parser.yy"
+#line 2744 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.node) = new(ctx) ast_iteration_statement(ast_iteration_statement::ast_for,
                                             (yyvsp[-3].node), (yyvsp[-2].for_rest_statement).cond, (yyvsp[-2].for_rest_statement).rest, (yyvsp[0].node));
       (yyval.node)->set_location_range((yylsp[-5]), (yylsp[0]));
    }
-#line 5494 "glsl_parser.cpp"
+#line 5492 "glsl_parser.cpp"
     break;
 
   case 271:
-#line 2762 "glsl_parser.yy"
+#line 2760 "glsl_parser.yy"
    {
       (yyval.node) = NULL;
    }
-#line 5502 "glsl_parser.cpp"
+#line 5500 "glsl_parser.cpp"
     break;
 
   case 272:
-#line 2769 "glsl_parser.yy"
+#line 2767 "glsl_parser.yy"
    {
       (yyval.for_rest_statement).cond = (yyvsp[-1].node);
       (yyval.for_rest_statement).rest = NULL;
    }
-#line 5511 "glsl_parser.cpp"
+#line 5509 "glsl_parser.cpp"
     break;
 
   case 273:
-#line 2774 "glsl_parser.yy"
+#line 2772 "glsl_parser.yy"
    {
       (yyval.for_rest_statement).cond = (yyvsp[-2].node);
       (yyval.for_rest_statement).rest = (yyvsp[0].expression);
    }
-#line 5520 "glsl_parser.cpp"
+#line 5518 "glsl_parser.cpp"
     break;
 
   case 274:
-#line 2783 "glsl_parser.yy"
+#line 2781 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.node) = new(ctx) ast_jump_statement(ast_jump_statement::ast_continue, NULL);
       (yyval.node)->set_location((yylsp[-1]));
    }
-#line 5530 "glsl_parser.cpp"
+#line 5528 "glsl_parser.cpp"
     break;
 
   case 275:
-#line 2789 "glsl_parser.yy"
+#line 2787 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.node) = new(ctx) ast_jump_statement(ast_jump_statement::ast_break, NULL);
       (yyval.node)->set_location((yylsp[-1]));
    }
-#line 5540 "glsl_parser.cpp"
+#line 5538 "glsl_parser.cpp"
     break;
 
   case 276:
-#line 2795 "glsl_parser.yy"
+#line 2793 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.node) = new(ctx) ast_jump_statement(ast_jump_statement::ast_return, NULL);
       (yyval.node)->set_location((yylsp[-1]));
    }
-#line 5550 "glsl_parser.cpp"
+#line 5548 "glsl_parser.cpp"
     break;
 
   case 277:
-#line 2801 "glsl_parser.yy"
+#line 2799 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.node) = new(ctx) ast_jump_statement(ast_jump_statement::ast_return, (yyvsp[-1].expression));
       (yyval.node)->set_location_range((yylsp[-2]), (yylsp[-1]));
    }
-#line 5560 "glsl_parser.cpp"
+#line 5558 "glsl_parser.cpp"
     break;
 
   case 278:
-#line 2807 "glsl_parser.yy"
+#line 2805 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.node) = new(ctx) ast_jump_statement(ast_jump_statement::ast_discard, NULL);
       (yyval.node)->set_location((yylsp[-1]));
    }
-#line 5570 "glsl_parser.cpp"
+#line 5568 "glsl_parser.cpp"
     break;
 
   case 279:
-#line 2816 "glsl_parser.yy"
+#line 2814 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.node) = new(ctx) ast_demote_statement();
       (yyval.node)->set_location((yylsp[-1]));
    }
-#line 5580 "glsl_parser.cpp"
+#line 5578 "glsl_parser.cpp"
     break;
 
   case 280:
-#line 2824 "glsl_parser.yy"
+#line 2822 "glsl_parser.yy"
                             { (yyval.node) = (yyvsp[0].function_definition); }
-#line 5586 "glsl_parser.cpp"
+#line 5584 "glsl_parser.cpp"
     break;
 
   case 281:
-#line 2825 "glsl_parser.yy"
+#line 2823 "glsl_parser.yy"
                             { (yyval.node) = (yyvsp[0].node); }
-#line 5592 "glsl_parser.cpp"
+#line 5590 "glsl_parser.cpp"
     break;
 
   case 282:
-#line 2826 "glsl_parser.yy"
+#line 2824 "glsl_parser.yy"
                             { (yyval.node) = (yyvsp[0].node); }
-#line 5598 "glsl_parser.cpp"
+#line 5596 "glsl_parser.cpp"
     break;
 
   case 283:
-#line 2827 "glsl_parser.yy"
+#line 2825 "glsl_parser.yy"
                             { (yyval.node) = (yyvsp[0].node); }
-#line 5604 "glsl_parser.cpp"
+#line 5602 "glsl_parser.cpp"
     break;
 
   case 284:
-#line 2828 "glsl_parser.yy"
+#line 2826 "glsl_parser.yy"
                             { (yyval.node) = NULL; }
-#line 5610 "glsl_parser.cpp"
+#line 5608 "glsl_parser.cpp"
     break;
 
   case 285:
-#line 2833 "glsl_parser.yy"
+#line 2831 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       (yyval.function_definition) = new(ctx) ast_function_definition();
@@ -5620,19 +5618,19 @@ yyreduce:
 
       state->symbols->pop_scope();
    }
-#line 5624 "glsl_parser.cpp"
+#line 5622 "glsl_parser.cpp"
     break;
 
   case 286:
-#line 2847 "glsl_parser.yy"
+#line 2845 "glsl_parser.yy"
    {
       (yyval.node) = (yyvsp[0].interface_block);
    }
-#line 5632 "glsl_parser.cpp"
+#line 5630 "glsl_parser.cpp"
     break;
 
   case 287:
-#line 2851 "glsl_parser.yy"
+#line 2849 "glsl_parser.yy"
    {
       ast_interface_block *block = (ast_interface_block *) (yyvsp[0].node);
 
@@ -5645,11 +5643,11 @@ yyreduce:
 
       (yyval.node) = block;
    }
-#line 5649 "glsl_parser.cpp"
+#line 5647 "glsl_parser.cpp"
     break;
 
   case 288:
-#line 2864 "glsl_parser.yy"
+#line 2862 "glsl_parser.yy"
    {
       ast_interface_block *block = (ast_interface_block *)(yyvsp[0].node);
 
@@ -5664,11 +5662,11 @@ yyreduce:
       block->layout = (yyvsp[-1].type_qualifier);
       (yyval.node) = block;
    }
-#line 5668 "glsl_parser.cpp"
+#line 5666 "glsl_parser.cpp"
     break;
 
   case 289:
-#line 2882 "glsl_parser.yy"
+#line 2880 "glsl_parser.yy"
    {
       ast_interface_block *const block = (yyvsp[-1].interface_block);
 
@@ -5684,47 +5682,47 @@ yyreduce:
 
       (yyval.interface_block) = block;
    }
-#line 5688 "glsl_parser.cpp"
+#line 5686 "glsl_parser.cpp"
     break;
 
   case 290:
-#line 2901 "glsl_parser.yy"
+#line 2899 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.in = 1;
    }
-#line 5697 "glsl_parser.cpp"
+#line 5695 "glsl_parser.cpp"
     break;
 
   case 291:
-#line 2906 "glsl_parser.yy"
+#line 2904 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.out = 1;
    }
-#line 5706 "glsl_parser.cpp"
+#line 5704 "glsl_parser.cpp"
     break;
 
   case 292:
-#line 2911 "glsl_parser.yy"
+#line 2909 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.uniform = 1;
    }
-#line 5715 "glsl_parser.cpp"
+#line 5713 "glsl_parser.cpp"
     break;
 
   case 293:
-#line 2916 "glsl_parser.yy"
+#line 2914 "glsl_parser.yy"
    {
       memset(& (yyval.type_qualifier), 0, sizeof((yyval.type_qualifier)));
       (yyval.type_qualifier).flags.q.buffer = 1;
    }
-#line 5724 "glsl_parser.cpp"
+#line 5722 "glsl_parser.cpp"
     break;
 
   case 294:
-#line 2921 "glsl_parser.yy"
+#line 2919 "glsl_parser.yy"
    {
       if (!(yyvsp[-1].type_qualifier).flags.q.patch) {
          _mesa_glsl_error(&(yylsp[-1]), state, "invalid interface qualifier");
@@ -5735,55 +5733,55 @@ yyreduce:
       (yyval.type_qualifier) = (yyvsp[0].type_qualifier);
       (yyval.type_qualifier).flags.q.patch = 1;
    }
-#line 5739 "glsl_parser.cpp"
+#line 5737 "glsl_parser.cpp"
     break;
 
   case 295:
-#line 2935 "glsl_parser.yy"
+#line 2933 "glsl_parser.yy"
    {
       (yyval.interface_block) = new(state->linalloc) ast_interface_block(NULL, NULL);
    }
-#line 5747 "glsl_parser.cpp"
+#line 5745 "glsl_parser.cpp"
     break;
 
   case 296:
-#line 2939 "glsl_parser.yy"
+#line 2937 "glsl_parser.yy"
    {
       (yyval.interface_block) = new(state->linalloc) ast_interface_block((yyvsp[0].identifier), NULL);
       (yyval.interface_block)->set_location((yylsp[0]));
    }
-#line 5756 "glsl_parser.cpp"
+#line 5754 "glsl_parser.cpp"
     break;
 
   case 297:
-#line 2944 "glsl_parser.yy"
+#line 2942 "glsl_parser.yy"
    {
       (yyval.interface_block) = new(state->linalloc) ast_interface_block((yyvsp[-1].identifier), (yyvsp[0].array_specifier));
       (yyval.interface_block)->set_location_range((yylsp[-1]), (yylsp[0]));
    }
-#line 5765 "glsl_parser.cpp"
+#line 5763 "glsl_parser.cpp"
     break;
 
   case 298:
-#line 2952 "glsl_parser.yy"
+#line 2950 "glsl_parser.yy"
    {
       (yyval.declarator_list) = (yyvsp[0].declarator_list);
       (yyvsp[0].declarator_list)->link.self_link();
    }
-#line 5774 "glsl_parser.cpp"
+#line 5772 "glsl_parser.cpp"
     break;
 
   case 299:
-#line 2957 "glsl_parser.yy"
+#line 2955 "glsl_parser.yy"
    {
       (yyval.declarator_list) = (yyvsp[-1].declarator_list);
       (yyvsp[0].declarator_list)->link.insert_before(& (yyval.declarator_list)->link);
    }
-#line 5783 "glsl_parser.cpp"
+#line 5781 "glsl_parser.cpp"
     break;
 
   case 300:
-#line 2965 "glsl_parser.yy"
+#line 2963 "glsl_parser.yy"
    {
       void *ctx = state->linalloc;
       ast_fully_specified_type *type = (yyvsp[-2].fully_specified_type);
@@ -5804,33 +5802,33 @@ yyreduce:
 
       (yyval.declarator_list)->declarations.push_degenerate_list_at_head(& (yyvsp[-1].declaration)->link);
    }
-#line 5808 "glsl_parser.cpp"
+#line 5806 "glsl_parser.cpp"
     break;
 
   case 301:
-#line 2989 "glsl_parser.yy"
+#line 2987 "glsl_parser.yy"
    {
       (yyval.type_qualifier) = (yyvsp[-1].type_qualifier);
       if (!(yyval.type_qualifier).merge_qualifier(& (yylsp[-1]), state, (yyvsp[0].type_qualifier), false, true)) {
          YYERROR;
       }
    }
-#line 5819 "glsl_parser.cpp"
+#line 5817 "glsl_parser.cpp"
     break;
 
   case 303:
-#line 3000 "glsl_parser.yy"
+#line 2998 "glsl_parser.yy"
    {
       (yyval.type_qualifier) = (yyvsp[-1].type_qualifier);
       if (!(yyval.type_qualifier).merge_qualifier(& (yylsp[-1]), state, (yyvsp[0].type_qualifier), false, true)) {
          YYERROR;
       }
    }
-#line 5830 "glsl_parser.cpp"
+#line 5828 "glsl_parser.cpp"
     break;
 
   case 305:
-#line 3011 "glsl_parser.yy"
+#line 3009 "glsl_parser.yy"
    {
       (yyval.type_qualifier) = (yyvsp[-1].type_qualifier);
       if (!(yyval.type_qualifier).merge_qualifier(& (yylsp[-1]), state, (yyvsp[0].type_qualifier), false, true)) {
@@ -5840,21 +5838,21 @@ yyreduce:
          YYERROR;
       }
    }
-#line 5844 "glsl_parser.cpp"
+#line 5842 "glsl_parser.cpp"
     break;
 
   case 306:
-#line 3021 "glsl_parser.yy"
+#line 3019 "glsl_parser.yy"
    {
       if (!(yyvsp[-2].type_qualifier).validate_in_qualifier(& (yylsp[-2]), state)) {
          YYERROR;
       }
    }
-#line 5854 "glsl_parser.cpp"
+#line 5852 "glsl_parser.cpp"
     break;
 
   case 307:
-#line 3030 "glsl_parser.yy"
+#line 3028 "glsl_parser.yy"
    {
       (yyval.type_qualifier) = (yyvsp[-1].type_qualifier);
       if (!(yyval.type_qualifier).merge_qualifier(& (yylsp[-1]), state, (yyvsp[0].type_qualifier), false, true)) {
@@ -5864,21 +5862,21 @@ yyreduce:
          YYERROR;
       }
    }
-#line 5868 "glsl_parser.cpp"
+#line 5866 "glsl_parser.cpp"
     break;
 
   case 308:
-#line 3040 "glsl_parser.yy"
+#line 3038 "glsl_parser.yy"
    {
       if (!(yyvsp[-2].type_qualifier).validate_out_qualifier(& (yylsp[-2]), state)) {
          YYERROR;
       }
    }
-#line 5878 "glsl_parser.cpp"
+#line 5876 "glsl_parser.cpp"
     break;
 
   case 309:
-#line 3049 "glsl_parser.yy"
+#line 3047 "glsl_parser.yy"
    {
       (yyval.node) = NULL;
       if (!state->default_uniform_qualifier->
@@ -5890,11 +5888,11 @@ yyreduce:
          YYERROR;
       }
    }
-#line 5894 "glsl_parser.cpp"
+#line 5892 "glsl_parser.cpp"
     break;
 
   case 310:
-#line 3061 "glsl_parser.yy"
+#line 3059 "glsl_parser.yy"
    {
       (yyval.node) = NULL;
       if (!state->default_shader_storage_qualifier->
@@ -5916,11 +5914,11 @@ yyreduce:
                           "binding qualifier cannot be set for default layout");
       }
    }
-#line 5920 "glsl_parser.cpp"
+#line 5918 "glsl_parser.cpp"
     break;
 
   case 311:
-#line 3083 "glsl_parser.yy"
+#line 3081 "glsl_parser.yy"
    {
       (yyval.node) = NULL;
       if (!(yyvsp[0].type_qualifier).merge_into_in_qualifier(& (yylsp[0]), state, (yyval.node))) {
@@ -5930,11 +5928,11 @@ yyreduce:
          YYERROR;
       }
    }
-#line 5934 "glsl_parser.cpp"
+#line 5932 "glsl_parser.cpp"
     break;
 
   case 312:
-#line 3093 "glsl_parser.yy"
+#line 3091 "glsl_parser.yy"
    {
       (yyval.node) = NULL;
       if (!(yyvsp[0].type_qualifier).merge_into_out_qualifier(& (yylsp[0]), state, (yyval.node))) {
@@ -5944,11 +5942,11 @@ yyreduce:
          YYERROR;
       }
    }
-#line 5948 "glsl_parser.cpp"
+#line 5946 "glsl_parser.cpp"
     break;
 
 
-#line 5952 "glsl_parser.cpp"
+#line 5950 "glsl_parser.cpp"
 
       default: break;
     }
@@ -297,19 +297,7 @@ translation_unit:
    external_declaration_list
    {
       delete state->symbols;
-      state->symbols = new(ralloc_parent(state)) glsl_symbol_table;
-      if (state->es_shader) {
-         if (state->stage == MESA_SHADER_FRAGMENT) {
-            state->symbols->add_default_precision_qualifier("int", ast_precision_medium);
-         } else {
-            state->symbols->add_default_precision_qualifier("float", ast_precision_high);
-            state->symbols->add_default_precision_qualifier("int", ast_precision_high);
-         }
-         state->symbols->add_default_precision_qualifier("sampler2D", ast_precision_low);
-         state->symbols->add_default_precision_qualifier("samplerExternalOES", ast_precision_low);
-         state->symbols->add_default_precision_qualifier("samplerCube", ast_precision_low);
-         state->symbols->add_default_precision_qualifier("atomic_uint", ast_precision_high);
-      }
+      state->symbols = _mesa_glsl_hir_symbol_table(state);
       _mesa_glsl_initialize_types(state);
    }
    ;
@@ -399,7 +387,9 @@ external_declaration_list:
       /* FINISHME: The NULL test is required because pragmas are set to
        * FINISHME: NULL. (See production rule for external_declaration.)
        */
-      if ($1 != NULL)
+      if (state->stream_hir)
+         _mesa_glsl_stream_external_declaration(state, $1);
+      else if ($1 != NULL)
          state->translation_unit.push_tail(& $1->link);
    }
    | external_declaration_list external_declaration
@@ -407,7 +397,9 @@ external_declaration_list:
       /* FINISHME: The NULL test is required because pragmas are set to
        * FINISHME: NULL. (See production rule for external_declaration.)
        */
-      if ($2 != NULL)
+      if (state->stream_hir)
+         _mesa_glsl_stream_external_declaration(state, $2);
+      else if ($2 != NULL)
          state->translation_unit.push_tail(& $2->link);
    }
    | external_declaration_list extension_statement {
@@ -899,6 +891,12 @@ function_header:
       } else
          state->symbols->add_function(new(state) ir_function($2));
       state->symbols->push_scope();
+
+      /* While streaming, the rest of the function is parsed into an
+       * allocator of its own, which is released once it is converted.
+       */
+      if (state->stream_hir && state->linalloc == state->global_linalloc)
+         state->linalloc = linear_alloc_parent(state->function_ctx, 0);
    }
    ;
 
@@ -65,9 +65,16 @@ _mesa_glsl_parse_state::_mesa_glsl_parse_state(struct gl_context *_ctx,
 
    this->scanner = NULL;
    this->translation_unit.make_empty();
-   this->symbols = new(mem_ctx) glsl_symbol_table;
+   this->ast_ctx = ralloc_context(NULL);
+   this->atoms = _mesa_atom_table_ctor(this->ast_ctx);
+   this->symbols = new(mem_ctx) glsl_symbol_table(this->atoms);
 
-   this->linalloc = linear_alloc_parent(this, 0);
+   this->linalloc = linear_alloc_parent(this->ast_ctx, 0);
+   this->global_linalloc = this->linalloc;
+   this->function_ctx = NULL;
+   this->stream_hir = ctx->Const.GLSLStreamHIR;
+   this->hir_instructions = NULL;
+   this->hir_symbols = NULL;
 
    this->info_log = ralloc_strdup(mem_ctx, "");
    this->error = false;
@@ -791,6 +798,26 @@ static const _mesa_glsl_extension *find_extension(const char *name)
    return NULL;
 }
 
+void
+_mesa_glsl_get_extension_flags(const _mesa_glsl_parse_state *state,
+                               BITSET_WORD *flags)
+{
+   STATIC_ASSERT(ARRAY_SIZE(_mesa_glsl_supported_extensions) * 2 <=
+                 GLSL_EXTENSION_FLAG_BITS);
+
+   memset(flags, 0, BITSET_WORDS(GLSL_EXTENSION_FLAG_BITS) * sizeof(*flags));
+
+   for (unsigned i = 0; i < ARRAY_SIZE(_mesa_glsl_supported_extensions); ++i) {
+      const _mesa_glsl_extension *extension =
+         &_mesa_glsl_supported_extensions[i];
+
+      if (state->*(extension->enable_flag))
+         BITSET_SET(flags, i * 2);
+      if (state->*(extension->warn_flag))
+         BITSET_SET(flags, i * 2 + 1);
+   }
+}
+
 bool
 _mesa_glsl_process_extension(const char *name, YYLTYPE *name_locp,
 			     const char *behavior_string, YYLTYPE *behavior_locp,
@@ -1970,6 +1997,69 @@ _mesa_glsl_copy_symbols_from_table(struct exec_list *shader_ir,
    }
 }
 
+glsl_symbol_table *
+_mesa_glsl_hir_symbol_table(struct _mesa_glsl_parse_state *state)
+{
+   if (state->hir_symbols != NULL)
+      return state->hir_symbols;
+
+   glsl_symbol_table *symbols =
+      new(ralloc_parent(state)) glsl_symbol_table(state->atoms);
+
+   if (state->es_shader) {
+      if (state->stage == MESA_SHADER_FRAGMENT) {
+         symbols->add_default_precision_qualifier("int", ast_precision_medium);
+      } else {
+         symbols->add_default_precision_qualifier("float", ast_precision_high);
+         symbols->add_default_precision_qualifier("int", ast_precision_high);
+      }
+      symbols->add_default_precision_qualifier("sampler2D", ast_precision_low);
+      symbols->add_default_precision_qualifier("samplerExternalOES", ast_precision_low);
+      symbols->add_default_precision_qualifier("samplerCube", ast_precision_low);
+      symbols->add_default_precision_qualifier("atomic_uint", ast_precision_high);
+   }
+
+   return symbols;
+}
+
+
+void
+_mesa_glsl_stream_external_declaration(struct _mesa_glsl_parse_state *state,
+                                       ast_node *ast)
+{
+   if (ast != NULL) {
+      /* The parser's symbol table only knows enough about each name to
+       * classify identifiers, so the HIR gets a table of its own.
+       */
+      glsl_symbol_table *const parse_symbols = state->symbols;
+      const bool first = state->hir_symbols == NULL;
+
+      state->hir_symbols = _mesa_glsl_hir_symbol_table(state);
+      state->symbols = state->hir_symbols;
+
+      /* A mid-shader #extension directive may have made more built-ins
+       * available since the last declaration.
+       */
+      if (first || state->allow_extension_directive_midshader)
+         _mesa_glsl_initialize_types(state);
+      if (first)
+         _mesa_ast_to_hir_begin(state->hir_instructions, state);
+
+      ast->hir(state->hir_instructions, state);
+
+      state->symbols = parse_symbols;
+   }
+
+   /* Nothing refers to the AST of a function once it is converted.  The
+    * rest is kept, because the default layout qualifiers in the parse state
+    * may point into it.
+    */
+   if (state->linalloc != state->global_linalloc) {
+      linear_free_parent(state->linalloc);
+      state->linalloc = state->global_linalloc;
+   }
+}
+
 extern "C" {
 
 static void
@@ -2088,9 +2178,6 @@ opt_shader_and_create_symbol_table(struct gl_context *ctx,
 
    validate_ir_tree(shader->ir);
 
-   /* Retain any live IR, but trash the rest. */
-   reparent_ir(shader->ir, shader->ir);
-
    /* Destroy the symbol table.  Create a new symbol table that contains only
     * the variables and functions that still exist in the IR.  The symbol
     * table will be used later during linking.
@@ -2124,6 +2211,23 @@ can_skip_compile(struct gl_context *ctx, struct gl_shader *shader,
    return false;
 }
 
+/* The parse state is allocated from the arena of its compile, which goes
+ * away with it unless the arena was handed over to the shader.
+ */
+static void
+free_compile_arena(void *ptr)
+{
+   struct _mesa_glsl_parse_state *state =
+      (struct _mesa_glsl_parse_state *) ptr;
+   void *ir_arena = ralloc_parent(state);
+   void *ast_ctx = state->ast_ctx;
+
+   state->~_mesa_glsl_parse_state();
+   ralloc_free(ast_ctx);
+   if (ralloc_parent(ir_arena) == NULL)
+      ralloc_free(ir_arena);
+}
+
 struct _mesa_glsl_parse_state *
 _mesa_glsl_compile_shader(struct gl_context *ctx, struct gl_shader *shader,
                           bool dump_ast, bool dump_hir, bool force_recompile)
@@ -2146,15 +2250,25 @@ _mesa_glsl_compile_shader(struct gl_context *ctx, struct gl_shader *shader,
        can_skip_compile(ctx, shader, source, force_recompile, false))
       return NULL;
 
-    struct _mesa_glsl_parse_state *state =
-      new(shader) _mesa_glsl_parse_state(ctx, shader->Stage, shader);
+   ralloc_stats_phase("preprocess");
+
+   /* Everything the IR passes allocate off of the state goes into one
+    * arena, which becomes the shader's once the IR has been optimized.  The
+    * preprocessed source and the AST are kept apart in state->ast_ctx, so
+    * that they go away with the state either way.
+    */
+   void *ir_arena = ralloc_arena_context(NULL);
+   struct _mesa_glsl_parse_state *state =
+      new(ir_arena) _mesa_glsl_parse_state(ctx, shader->Stage, shader);
+   ralloc_set_destructor(state, free_compile_arena);
 
    if (ctx->Const.GenerateTemporaryNames)
       (void) p_atomic_cmpxchg(&ir_variable::temporaries_allocate_names,
                               false, true);
 
    if (!source_has_shader_include || !force_recompile) {
-      state->error = glcpp_preprocess(state, &source, &state->info_log,
+      state->error = glcpp_preprocess(state->ast_ctx, &source,
+                                      &state->info_log,
                                       add_builtin_defines, state, ctx);
    }
 
@@ -2166,8 +2280,22 @@ _mesa_glsl_compile_shader(struct gl_context *ctx, struct gl_shader *shader,
        can_skip_compile(ctx, shader, source, force_recompile, true))
       return state;
 
+   ralloc_stats_phase("ast");
+
+   ralloc_free(shader->ir);
+   shader->ir = new(shader) exec_list;
+
+   /* The AST has to be kept whole to be dumped. */
+   if (dump_ast)
+      state->stream_hir = false;
+
+   if (state->stream_hir) {
+      state->hir_instructions = shader->ir;
+      state->function_ctx = ralloc_context(state->ast_ctx);
+   }
+
    if (!state->error) {
-     _mesa_glsl_lexer_ctor(state, source);
+     _mesa_glsl_lexer_ctor(state, source, strlen(source));
      _mesa_glsl_parse(state);
      _mesa_glsl_lexer_dtor(state);
      do_late_parsing_checks(state);
@@ -2180,10 +2308,23 @@ _mesa_glsl_compile_shader(struct gl_context *ctx, struct gl_shader *shader,
       printf("\n\n");
    }
 
-   ralloc_free(shader->ir);
-   shader->ir = new(shader) exec_list;
-   if (!state->error && !state->translation_unit.is_empty())
+   ralloc_stats_phase("hir");
+
+   if (state->stream_hir) {
+      if (state->hir_symbols == NULL) {
+         /* No declaration was converted. */
+      } else if (state->symbols == state->hir_symbols) {
+         _mesa_ast_to_hir_end(shader->ir, state);
+      } else {
+         /* The parser stopped at an error before switching over to the
+          * symbol table of the HIR.
+          */
+         delete state->symbols;
+         state->symbols = state->hir_symbols;
+      }
+   } else if (!state->error && !state->translation_unit.is_empty()) {
       _mesa_ast_to_hir(shader->ir, state);
+   }
 
    if (!state->error) {
       validate_ir_tree(shader->ir);
@@ -2206,10 +2347,23 @@ _mesa_glsl_compile_shader(struct gl_context *ctx, struct gl_shader *shader,
    shader->Version = state->language_version;
    shader->IsES = state->es_shader;
 
+   ralloc_stats_phase("optimization");
+
    if (!state->error && !shader->ir->is_empty()) {
       assign_subroutine_indexes(state);
       lower_subroutine(shader->ir, state);
       opt_shader_and_create_symbol_table(ctx, state->symbols, shader);
+
+      /* Hand the arena over rather than copying the live IR out of it.  The
+       * IR that the optimizations left dead is only returned with the
+       * shader's IR.
+       */
+      ralloc_steal(shader->ir, ir_arena);
+   } else {
+      /* The IR of a shader that failed to compile is never linked, and it
+       * is freed with the state.
+       */
+      shader->ir->make_empty();
    }
 
    if (!force_recompile) {
@@ -2257,6 +2411,7 @@ do_common_optimization(exec_list *ir, bool linked,
    bool progress = false;
 
 #define OPT(PASS, ...) do {                                             \
+      ralloc_stats_site(#PASS);                                         \
       if (debug) {                                                      \
          fprintf(stderr, "START GLSL optimization %s\n", #PASS);        \
          const bool opt_progress = PASS(__VA_ARGS__);                   \
@@ -2303,6 +2458,7 @@ do_common_optimization(exec_list *ir, bool linked,
       OPT(do_constant_variable_unlinked, ir);
    OPT(do_constant_folding, ir);
    OPT(do_minmax_prune, ir);
+   OPT(do_cse, ir);
    OPT(do_rebalance_tree, ir);
    OPT(do_algebraic, ir, native_integers, options);
    OPT(do_lower_jumps, ir, true, true, options->EmitNoMainReturn,
@@ -2346,6 +2502,13 @@ do_common_optimization(exec_list *ir, bool linked,
       delete ls;
    }
 
+   {
+      loop_state *ls = analyze_loop_variables(ir);
+      if (ls->loop_found)
+         OPT(hoist_loop_invariants, ir, ls);
+      delete ls;
+   }
+
 #undef OPT
 
    return progress;
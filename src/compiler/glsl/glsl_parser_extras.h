@@ -32,6 +32,7 @@
 
 #include <stdlib.h>
 #include "glsl_symbol_table.h"
+#include "util/bitset.h"
 
 /* THIS is a macro defined somewhere deep in the Windows MSVC header files.
  * Undefine it here to avoid collision with the lexer's THIS token.
@@ -372,11 +373,57 @@ struct _mesa_glsl_parse_state {
 
    struct gl_context *const ctx;
    void *scanner;
+
+   /** Part of the shader source that the lexer has yet to read. */
+   const char *lexer_source;
+   const char *lexer_source_end;
+
    exec_list translation_unit;
    glsl_symbol_table *symbols;
 
+   /**
+    * Context of the preprocessed source, the atoms and the AST, which are
+    * freed with the state, whereas the IR allocated off of the state may
+    * outlive it in the shader.
+    */
+   void *ast_ctx;
+
+   /**
+    * Identifiers seen by the lexer, shared by the parser's symbol tables so
+    * that they are looked up by pointer.
+    */
+   struct _mesa_atom_table *atoms;
+
    void *linalloc;
 
+   /**
+    * Whether each external declaration is converted to HIR as soon as the
+    * parser reduces it.  See _mesa_glsl_stream_external_declaration().
+    */
+   bool stream_hir;
+
+   /** List the streamed HIR is emitted into. */
+   exec_list *hir_instructions;
+
+   /**
+    * Symbol table of the streamed HIR, which is kept apart from the one the
+    * parser uses to classify identifiers until parsing is done.
+    */
+   glsl_symbol_table *hir_symbols;
+
+   /**
+    * Allocator for the AST outside of functions.  While streaming,
+    * \c linalloc points elsewhere from a function's parameters to the end of
+    * the function, so that its AST can be released once it is converted.
+    */
+   void *global_linalloc;
+
+   /**
+    * Parent of the per-function allocators, so that the AST of a function
+    * can be freed as soon as it is converted.
+    */
+   void *function_ctx;
+
    unsigned num_supported_versions;
    struct {
       unsigned ver;
@@ -987,7 +1034,7 @@ extern void _mesa_glsl_warning(const YYLTYPE *locp,
                                const char *fmt, ...);
 
 extern void _mesa_glsl_lexer_ctor(struct _mesa_glsl_parse_state *state,
-                                  const char *string);
+                                  const char *string, size_t length);
 
 extern void _mesa_glsl_lexer_dtor(struct _mesa_glsl_parse_state *state);
 
@@ -1009,6 +1056,36 @@ extern bool _mesa_glsl_process_extension(const char *name, YYLTYPE *name_locp,
                                          YYLTYPE *behavior_locp,
                                          _mesa_glsl_parse_state *state);
 
+/**
+ * Number of bits filled in by _mesa_glsl_get_extension_flags()
+ */
+#define GLSL_EXTENSION_FLAG_BITS 256
+
+/**
+ * Return the symbol table the AST is converted to HIR with, holding the
+ * built-in scope and the default precision qualifiers.
+ */
+extern glsl_symbol_table *
+_mesa_glsl_hir_symbol_table(struct _mesa_glsl_parse_state *state);
+
+/**
+ * Convert an external declaration the parser just reduced to HIR, and
+ * release its AST if nothing can refer to it any more.  \c ast may be NULL.
+ */
+extern void
+_mesa_glsl_stream_external_declaration(struct _mesa_glsl_parse_state *state,
+                                       class ast_node *ast);
+
+/**
+ * Pack the enable and warn flags of every extension that can appear in an
+ * #extension directive into \c flags, two bits per extension.
+ *
+ * This lets two parse states be compared for the set of extensions they
+ * enable without naming each of them.
+ */
+extern void _mesa_glsl_get_extension_flags(const _mesa_glsl_parse_state *state,
+                                           BITSET_WORD *flags);
+
 #endif /* __cplusplus */
 
 
@@ -101,12 +101,15 @@ public:
    const class ast_type_specifier *a;
 };
 
-glsl_symbol_table::glsl_symbol_table()
+glsl_symbol_table::glsl_symbol_table(struct _mesa_atom_table *atoms)
 {
    this->separate_function_namespace = false;
-   this->table = _mesa_symbol_table_ctor();
+   this->table = _mesa_symbol_table_ctor_with_atoms(atoms);
+   this->atoms = atoms;
    this->mem_ctx = ralloc_context(NULL);
    this->linalloc = linear_alloc_parent(this->mem_ctx, 0);
+   this->builtins = NULL;
+   this->builtin_instructions = NULL;
 }
 
 glsl_symbol_table::~glsl_symbol_table()
@@ -231,12 +234,16 @@ void glsl_symbol_table::add_global_function(ir_function *f)
 ir_variable *glsl_symbol_table::get_variable(const char *name)
 {
    symbol_table_entry *entry = get_entry(name);
-   return entry != NULL ? entry->v : NULL;
+   if (entry == NULL)
+      return get_builtin_variable(name);
+   return entry->v;
 }
 
 const glsl_type *glsl_symbol_table::get_type(const char *name)
 {
    symbol_table_entry *entry = get_entry(name);
+   if (entry == NULL && may_be_builtin(name))
+      return builtins->symbols->get_type(name);
    return entry != NULL ? entry->t : NULL;
 }
 
@@ -268,6 +275,66 @@ symbol_table_entry *glsl_symbol_table::get_entry(const char *name)
       _mesa_symbol_table_find_symbol(table, name);
 }
 
+bool glsl_symbol_table::may_be_builtin(const char *name)
+{
+   if (builtins == NULL)
+      return false;
+
+   /* Names of built-ins are interned by the built-in scope, so an identifier
+    * that had to be added to our own atom table can't be one of them.
+    */
+   return atoms == NULL || !_mesa_atom_table_owns(atoms, name);
+}
+
+ir_variable *glsl_symbol_table::get_builtin_variable(const char *name)
+{
+   if (builtin_instructions == NULL || !may_be_builtin(name))
+      return NULL;
+
+   ir_variable *builtin = builtins->symbols->get_variable(name);
+   if (builtin == NULL)
+      return NULL;
+
+   /* The shared declaration can't be modified, so give the shader its own
+    * copy.  Built-in variables live in the scope that encloses the shader's
+    * globals, which is the outermost scope of this table.
+    */
+   ir_variable *var = builtin->clone(this, NULL);
+   builtin_instructions->push_head(var);
+
+   symbol_table_entry *entry = new(linalloc) symbol_table_entry(var);
+   int added = _mesa_symbol_table_add_global_symbol(table, var->name, entry);
+   assert(added == 0);
+   (void)added;
+
+   return var;
+}
+
+void
+glsl_symbol_table::declare_builtin_interface(const glsl_type *iface,
+                                             enum ir_variable_mode mode)
+{
+   if (builtins == NULL || iface == NULL)
+      return;
+
+   foreach_in_list(ir_variable, var, &builtins->variables) {
+      if (var->get_interface_type() == iface && var->data.mode == mode)
+         get_variable(var->name);
+   }
+}
+
+void
+glsl_symbol_table::declare_builtin_unsized_arrays(enum ir_variable_mode mode)
+{
+   if (builtins == NULL)
+      return;
+
+   foreach_in_list(ir_variable, var, &builtins->variables) {
+      if (var->type->is_unsized_array() && var->data.mode == mode)
+         get_variable(var->name);
+   }
+}
+
 void
 glsl_symbol_table::disable_variable(const char *name)
 {
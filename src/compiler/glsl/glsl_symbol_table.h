@@ -32,6 +32,7 @@
 
 class symbol_table_entry;
 struct glsl_type;
+struct glsl_builtin_scope;
 
 /**
  * Facade class for _mesa_symbol_table
@@ -42,7 +43,7 @@ struct glsl_type;
 struct glsl_symbol_table {
    DECLARE_RALLOC_CXX_OPERATORS(glsl_symbol_table)
 
-   glsl_symbol_table();
+   glsl_symbol_table(struct _mesa_atom_table *atoms = NULL);
    ~glsl_symbol_table();
 
    /* In 1.10, functions and variables have separate namespaces. */
@@ -102,12 +103,59 @@ struct glsl_symbol_table {
     */
    void replace_variable(const char *name, ir_variable *v);
 
+   /**
+    * Look up every built-in variable of \p mode that is a member of the
+    * interface block \p iface, declaring the ones not referenced so far.
+    */
+   void declare_builtin_interface(const glsl_type *iface,
+                                  enum ir_variable_mode mode);
+
+   /**
+    * Look up every built-in variable of \p mode that is an unsized array,
+    * declaring the ones not referenced so far, so that the layout qualifier
+    * that sizes the arrays of the shader sizes them too.
+    */
+   void declare_builtin_unsized_arrays(enum ir_variable_mode mode);
+
+   /**
+    * Shared, read-only scope outside of the outermost one
+    *
+    * Built-in types are found here directly.  Built-in variables are only
+    * found while \c builtin_instructions is set, and the first lookup of each
+    * one declares a copy of it in that list and at global scope.
+    */
+   glsl_builtin_scope *builtins;
+   exec_list *builtin_instructions;
+
 private:
    symbol_table_entry *get_entry(const char *name);
+   bool may_be_builtin(const char *name);
+   ir_variable *get_builtin_variable(const char *name);
 
    struct _mesa_symbol_table *table;
+   struct _mesa_atom_table *atoms;
    void *mem_ctx;
    void *linalloc;
 };
 
+/**
+ * Built-in types and variables for one shader stage, language version and
+ * set of enabled extensions
+ *
+ * These are built once by _mesa_glsl_get_builtin_scope() and then shared by
+ * every compile that asks for the same combination, so they must not be
+ * modified.
+ */
+struct glsl_builtin_scope {
+   DECLARE_RALLOC_CXX_OPERATORS(glsl_builtin_scope)
+
+   glsl_symbol_table *symbols;
+
+   /** Names in \c symbols, the parent of each compile's atom table */
+   struct _mesa_atom_table *atoms;
+
+   /** Declarations of the built-in variables in \c symbols */
+   exec_list variables;
+};
+
 #endif /* GLSL_SYMBOL_TABLE */
@@ -2149,6 +2149,9 @@ public:
    virtual ir_constant *constant_expression_value(void *mem_ctx,
                                                   struct hash_table *variable_context = NULL);
 
+   virtual bool equals(const ir_instruction *ir,
+                       enum ir_node_type ignore = ir_type_unset) const;
+
    /**
     * Get the variable that is ultimately referenced by an r-value
     */
@@ -2462,6 +2465,16 @@ extern void
 _mesa_glsl_initialize_variables(exec_list *instructions,
 				struct _mesa_glsl_parse_state *state);
 
+/**
+ * Find or build the shared built-in scope for the stage, language version
+ * and enabled extensions of \c state
+ */
+extern struct glsl_builtin_scope *
+_mesa_glsl_get_builtin_scope(struct _mesa_glsl_parse_state *state);
+
+extern void
+_mesa_glsl_release_builtin_scopes(void);
+
 extern void
 reparent_ir(exec_list *list, void *mem_ctx);
 
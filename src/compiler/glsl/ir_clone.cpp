@@ -303,6 +303,15 @@ ir_function_signature::clone(void *mem_ctx, struct hash_table *ht) const
 
    copy->is_defined = this->is_defined;
 
+   /* With a hash table, the cloned body refers to the cloned parameters, so
+    * the copy can be evaluated without its origin, which needn't outlive it.
+    * Builtins are the exception: their origin in the builtin shader lives
+    * for good, and constant folding of a call to a builtin whose body was
+    * not imported relies on it.
+    */
+   if (ht != NULL && !this->is_builtin())
+      copy->origin = NULL;
+
    /* Clone the instruction list.
     */
    foreach_in_list(const ir_instruction, inst, &this->body) {
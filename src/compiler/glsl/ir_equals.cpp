@@ -57,10 +57,19 @@ ir_constant::equals(const ir_instruction *ir, enum ir_node_type) const
    if (type != other->type)
       return false;
 
+   /* Aggregates have no components of their own, so only the same constant
+    * is known to hold the same value.
+    */
+   if (type->is_array() || type->is_struct())
+      return this == other;
+
    for (unsigned i = 0; i < type->components(); i++) {
       if (type->is_double()) {
          if (value.d[i] != other->value.d[i])
             return false;
+      } else if (type->is_64bit()) {
+         if (value.u64[i] != other->value.u64[i])
+            return false;
       } else {
          if (value.u[i] != other->value.u[i])
             return false;
@@ -101,6 +110,23 @@ ir_dereference_array::equals(const ir_instruction *ir,
    return true;
 }
 
+bool
+ir_dereference_record::equals(const ir_instruction *ir,
+                              enum ir_node_type ignore) const
+{
+   const ir_dereference_record *other = ir->as_dereference_record();
+   if (!other)
+      return false;
+
+   if (type != other->type)
+      return false;
+
+   if (field_idx != other->field_idx)
+      return false;
+
+   return record->equals(other->record, ignore);
+}
+
 bool
 ir_swizzle::equals(const ir_instruction *ir,
                    enum ir_node_type ignore) const
@@ -0,0 +1,1265 @@
+/*
+ * Copyright © 2026 xxGLSLCompiler contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file ir_serialize.cpp
+ *
+ * Every instruction is written as its ir_node_type followed by its fields,
+ * and a missing operand as ir_type_unset.  The reader rebuilds the nodes
+ * with the same constructors as ir_clone.cpp does.
+ */
+
+#include "ir_serialize.h"
+#include "ir_visitor.h"
+#include "glsl_parser_extras.h"
+#include "glsl_symbol_table.h"
+#include "builtin_functions.h"
+#include "compiler/glsl_types.h"
+#include "main/mtypes.h"
+#include "util/blob.h"
+#include "util/hash_table.h"
+#include "util/u_dynarray.h"
+
+/**
+ * Bump whenever the layout of the blob changes, or any of the enums and
+ * structures that are written as they are in memory.
+ */
+#define IR_SERIALIZE_VERSION 1
+
+/** Stands for a NULL type, e.g. the interface_type of most variables. */
+#define NULL_TYPE_INDEX (~0u)
+
+/** The callee of an ir_call. */
+enum serialized_callee {
+   CALLEE_SIGNATURE,
+   CALLEE_BUILTIN,
+};
+
+namespace {
+
+class ir_serialize_visitor : public ir_visitor {
+public:
+   ir_serialize_visitor(struct blob *blob)
+      : blob(blob)
+   {
+      types = _mesa_pointer_hash_table_create(NULL);
+      variables = _mesa_pointer_hash_table_create(NULL);
+      signatures = _mesa_pointer_hash_table_create(NULL);
+   }
+
+   virtual ~ir_serialize_visitor()
+   {
+      _mesa_hash_table_destroy(types, NULL);
+      _mesa_hash_table_destroy(variables, NULL);
+      _mesa_hash_table_destroy(signatures, NULL);
+   }
+
+   void write_type(const glsl_type *type);
+   void write_list(exec_list *list);
+   void write_optional(ir_instruction *ir);
+   void write_variable_ref(ir_variable *var);
+
+   virtual void visit(ir_variable *);
+   virtual void visit(ir_function_signature *);
+   virtual void visit(ir_function *);
+   virtual void visit(ir_expression *);
+   virtual void visit(ir_texture *);
+   virtual void visit(ir_swizzle *);
+   virtual void visit(ir_dereference_variable *);
+   virtual void visit(ir_dereference_array *);
+   virtual void visit(ir_dereference_record *);
+   virtual void visit(ir_assignment *);
+   virtual void visit(ir_constant *);
+   virtual void visit(ir_call *);
+   virtual void visit(ir_return *);
+   virtual void visit(ir_discard *);
+   virtual void visit(ir_demote *);
+   virtual void visit(ir_if *);
+   virtual void visit(ir_loop *);
+   virtual void visit(ir_loop_jump *);
+   virtual void visit(ir_emit_vertex *);
+   virtual void visit(ir_end_primitive *);
+   virtual void visit(ir_barrier *);
+
+private:
+   /**
+    * Assign the next index of \p table to \p ptr.
+    */
+   static void
+   add_index(struct hash_table *table, const void *ptr)
+   {
+      _mesa_hash_table_insert(table, ptr,
+                              (void *) (uintptr_t) table->entries);
+   }
+
+   struct blob *blob;
+
+   /** Maps types, variables and signatures to their indices. */
+   struct hash_table *types;
+   struct hash_table *variables;
+   struct hash_table *signatures;
+};
+
+} /* anonymous namespace */
+
+/**
+ * Types are written in full the first time only, as an index one past the
+ * end of the table followed by the encoded type.
+ */
+void
+ir_serialize_visitor::write_type(const glsl_type *type)
+{
+   if (type == NULL) {
+      blob_write_uint32(blob, NULL_TYPE_INDEX);
+      return;
+   }
+
+   hash_entry *entry = _mesa_hash_table_search(types, type);
+   if (entry != NULL) {
+      blob_write_uint32(blob, (uint32_t) (uintptr_t) entry->data);
+      return;
+   }
+
+   blob_write_uint32(blob, types->entries);
+   add_index(types, type);
+   encode_type_to_blob(blob, type);
+}
+
+void
+ir_serialize_visitor::write_list(exec_list *list)
+{
+   blob_write_uint32(blob, list->length());
+   foreach_in_list(ir_instruction, ir, list)
+      ir->accept(this);
+}
+
+void
+ir_serialize_visitor::write_optional(ir_instruction *ir)
+{
+   if (ir != NULL)
+      ir->accept(this);
+   else
+      blob_write_uint8(blob, ir_type_unset);
+}
+
+/**
+ * Variables are referred to by the order of their declarations, which the
+ * IR validator guarantees to come before any use.
+ */
+void
+ir_serialize_visitor::write_variable_ref(ir_variable *var)
+{
+   hash_entry *entry = _mesa_hash_table_search(variables, var);
+   assert(entry != NULL);
+   blob_write_uint32(blob, entry ? (uint32_t) (uintptr_t) entry->data : ~0u);
+}
+
+void
+ir_serialize_visitor::visit(ir_variable *ir)
+{
+   blob_write_uint8(blob, ir_type_variable);
+   add_index(variables, ir);
+
+   write_type(ir->type);
+
+   blob_write_string(blob, ir->name);
+
+   /* ir_variable_data holds no pointers. */
+   blob_write_bytes(blob, &ir->data, sizeof(ir->data));
+
+   write_type(ir->get_interface_type());
+   if (ir->is_interface_instance()) {
+      blob_write_bytes(blob, ir->get_max_ifc_array_access(),
+                       ir->get_interface_type()->length * sizeof(int));
+   } else if (ir->get_num_state_slots() != 0) {
+      blob_write_bytes(blob, ir->get_state_slots(),
+                       ir->get_num_state_slots() * sizeof(ir_state_slot));
+   }
+
+   write_optional(ir->constant_value);
+   write_optional(ir->constant_initializer);
+}
+
+void
+ir_serialize_visitor::visit(ir_function_signature *ir)
+{
+   add_index(signatures, ir);
+
+   write_type(ir->return_type);
+   blob_write_uint8(blob, ir->is_defined);
+   blob_write_uint8(blob, ir->return_precision);
+   blob_write_uint32(blob, ir->intrinsic_id);
+
+   write_list(&ir->parameters);
+   write_list(&ir->body);
+}
+
+void
+ir_serialize_visitor::visit(ir_function *ir)
+{
+   blob_write_uint8(blob, ir_type_function);
+   blob_write_string(blob, ir->name);
+   blob_write_uint8(blob, ir->is_subroutine);
+   blob_write_uint32(blob, ir->subroutine_index);
+   blob_write_uint32(blob, ir->num_subroutine_types);
+   for (int i = 0; i < ir->num_subroutine_types; i++)
+      write_type(ir->subroutine_types[i]);
+
+   blob_write_uint32(blob, ir->signatures.length());
+   foreach_in_list(ir_function_signature, sig, &ir->signatures)
+      sig->accept(this);
+}
+
+void
+ir_serialize_visitor::visit(ir_expression *ir)
+{
+   blob_write_uint8(blob, ir_type_expression);
+   blob_write_uint32(blob, ir->operation);
+   write_type(ir->type);
+
+   blob_write_uint8(blob, ir->num_operands);
+   for (unsigned i = 0; i < ir->num_operands; i++)
+      ir->operands[i]->accept(this);
+}
+
+void
+ir_serialize_visitor::visit(ir_texture *ir)
+{
+   blob_write_uint8(blob, ir_type_texture);
+   blob_write_uint8(blob, ir->op);
+   write_type(ir->type);
+
+   ir->sampler->accept(this);
+   write_optional(ir->coordinate);
+   write_optional(ir->projector);
+   write_optional(ir->shadow_comparator);
+   write_optional(ir->offset);
+
+   switch (ir->op) {
+   case ir_tex:
+   case ir_lod:
+   case ir_query_levels:
+   case ir_texture_samples:
+   case ir_samples_identical:
+      break;
+   case ir_txb:
+      ir->lod_info.bias->accept(this);
+      break;
+   case ir_txl:
+   case ir_txf:
+   case ir_txs:
+      ir->lod_info.lod->accept(this);
+      break;
+   case ir_txf_ms:
+      ir->lod_info.sample_index->accept(this);
+      break;
+   case ir_txd:
+      ir->lod_info.grad.dPdx->accept(this);
+      ir->lod_info.grad.dPdy->accept(this);
+      break;
+   case ir_tg4:
+      ir->lod_info.component->accept(this);
+      break;
+   }
+}
+
+void
+ir_serialize_visitor::visit(ir_swizzle *ir)
+{
+   blob_write_uint8(blob, ir_type_swizzle);
+   blob_write_uint16(blob, ir->mask.x |
+                           ir->mask.y << 2 |
+                           ir->mask.z << 4 |
+                           ir->mask.w << 6 |
+                           ir->mask.num_components << 8 |
+                           ir->mask.has_duplicates << 11);
+   ir->val->accept(this);
+}
+
+void
+ir_serialize_visitor::visit(ir_dereference_variable *ir)
+{
+   blob_write_uint8(blob, ir_type_dereference_variable);
+   write_variable_ref(ir->var);
+}
+
+void
+ir_serialize_visitor::visit(ir_dereference_array *ir)
+{
+   blob_write_uint8(blob, ir_type_dereference_array);
+   ir->array->accept(this);
+   ir->array_index->accept(this);
+}
+
+void
+ir_serialize_visitor::visit(ir_dereference_record *ir)
+{
+   blob_write_uint8(blob, ir_type_dereference_record);
+   blob_write_uint32(blob, ir->field_idx);
+   ir->record->accept(this);
+}
+
+void
+ir_serialize_visitor::visit(ir_assignment *ir)
+{
+   blob_write_uint8(blob, ir_type_assignment);
+   blob_write_uint8(blob, ir->write_mask);
+   ir->lhs->accept(this);
+   ir->rhs->accept(this);
+   write_optional(ir->condition);
+}
+
+void
+ir_serialize_visitor::visit(ir_constant *ir)
+{
+   blob_write_uint8(blob, ir_type_constant);
+   write_type(ir->type);
+
+   if (ir->type->is_array() || ir->type->is_struct()) {
+      for (unsigned i = 0; i < ir->type->length; i++)
+         ir->const_elements[i]->accept(this);
+   } else {
+      /* Every member of ir_constant_data is an array starting at the same
+       * address, so only the components in use need to be written.
+       */
+      blob_write_bytes(blob, &ir->value,
+                       ir->type->components() * ir->type->bit_size() / 8);
+   }
+}
+
+void
+ir_serialize_visitor::visit(ir_call *ir)
+{
+   blob_write_uint8(blob, ir_type_call);
+
+   hash_entry *entry = _mesa_hash_table_search(signatures, ir->callee);
+   if (entry != NULL) {
+      blob_write_uint8(blob, CALLEE_SIGNATURE);
+      blob_write_uint32(blob, (uint32_t) (uintptr_t) entry->data);
+   } else {
+      /* Built-in functions live in a shader of their own, where their
+       * signatures are found again by name and parameter types.
+       */
+      assert(ir->callee->is_builtin());
+      blob_write_uint8(blob, CALLEE_BUILTIN);
+      blob_write_string(blob, ir->callee_name());
+      blob_write_uint32(blob, ir->callee->parameters.length());
+      foreach_in_list(ir_variable, param, &ir->callee->parameters)
+         write_type(param->type);
+   }
+
+   write_optional(ir->return_deref);
+   write_list(&ir->actual_parameters);
+
+   blob_write_uint8(blob, ir->sub_var != NULL);
+   if (ir->sub_var != NULL)
+      write_variable_ref(ir->sub_var);
+   write_optional(ir->array_idx);
+}
+
+void
+ir_serialize_visitor::visit(ir_return *ir)
+{
+   blob_write_uint8(blob, ir_type_return);
+   write_optional(ir->value);
+}
+
+void
+ir_serialize_visitor::visit(ir_discard *ir)
+{
+   blob_write_uint8(blob, ir_type_discard);
+   write_optional(ir->condition);
+}
+
+void
+ir_serialize_visitor::visit(ir_demote *)
+{
+   blob_write_uint8(blob, ir_type_demote);
+}
+
+void
+ir_serialize_visitor::visit(ir_if *ir)
+{
+   blob_write_uint8(blob, ir_type_if);
+   ir->condition->accept(this);
+   write_list(&ir->then_instructions);
+   write_list(&ir->else_instructions);
+}
+
+void
+ir_serialize_visitor::visit(ir_loop *ir)
+{
+   blob_write_uint8(blob, ir_type_loop);
+   write_list(&ir->body_instructions);
+}
+
+void
+ir_serialize_visitor::visit(ir_loop_jump *ir)
+{
+   blob_write_uint8(blob, ir_type_loop_jump);
+   blob_write_uint8(blob, ir->mode);
+}
+
+void
+ir_serialize_visitor::visit(ir_emit_vertex *ir)
+{
+   blob_write_uint8(blob, ir_type_emit_vertex);
+   ir->stream->accept(this);
+}
+
+void
+ir_serialize_visitor::visit(ir_end_primitive *ir)
+{
+   blob_write_uint8(blob, ir_type_end_primitive);
+   ir->stream->accept(this);
+}
+
+void
+ir_serialize_visitor::visit(ir_barrier *)
+{
+   blob_write_uint8(blob, ir_type_barrier);
+}
+
+namespace {
+
+class ir_deserializer {
+public:
+   ir_deserializer(struct blob_reader *blob, void *mem_ctx)
+      : blob(blob), mem_ctx(mem_ctx), failed(false)
+   {
+      util_dynarray_init(&types, NULL);
+      util_dynarray_init(&variables, NULL);
+      util_dynarray_init(&signatures, NULL);
+   }
+
+   ~ir_deserializer()
+   {
+      util_dynarray_fini(&types);
+      util_dynarray_fini(&variables);
+      util_dynarray_fini(&signatures);
+   }
+
+   bool read_list(exec_list *list);
+
+   /** Whether everything read so far was consistent. */
+   bool ok() const
+   {
+      return !failed && !blob->overrun;
+   }
+
+private:
+   ir_instruction *read_instruction(bool optional = false);
+   ir_rvalue *read_rvalue(bool optional = false);
+   ir_dereference *read_dereference();
+   ir_constant *read_constant(bool optional = false);
+   const glsl_type *read_type();
+   ir_variable *read_variable_ref();
+   ir_function_signature *read_builtin_callee();
+
+   ir_variable *read_variable();
+   ir_function *read_function();
+   ir_function_signature *read_signature();
+   ir_expression *read_expression();
+   ir_texture *read_texture();
+   ir_swizzle *read_swizzle();
+   ir_dereference_record *read_dereference_record();
+   ir_assignment *read_assignment();
+   ir_constant *read_constant_value();
+   ir_call *read_call();
+   ir_if *read_if();
+
+   /** Flag the blob as inconsistent, for any return type. */
+   template <typename T> T *
+   fail()
+   {
+      failed = true;
+      return NULL;
+   }
+
+   struct blob_reader *blob;
+   void *mem_ctx;
+   bool failed;
+
+   /** Types, variables and signatures by index. */
+   struct util_dynarray types;
+   struct util_dynarray variables;
+   struct util_dynarray signatures;
+};
+
+} /* anonymous namespace */
+
+bool
+ir_deserializer::read_list(exec_list *list)
+{
+   const uint32_t length = blob_read_uint32(blob);
+
+   for (uint32_t i = 0; i < length && ok(); i++) {
+      ir_instruction *ir = read_instruction();
+      if (ir != NULL)
+         list->push_tail(ir);
+   }
+
+   return ok();
+}
+
+const glsl_type *
+ir_deserializer::read_type()
+{
+   const uint32_t index = blob_read_uint32(blob);
+   const unsigned count = util_dynarray_num_elements(&types, const glsl_type *);
+
+   if (index == NULL_TYPE_INDEX)
+      return NULL;
+
+   if (index < count)
+      return *util_dynarray_element(&types, const glsl_type *, index);
+
+   if (index != count || !ok())
+      return fail<const glsl_type>();
+
+   const glsl_type *type = decode_type_from_blob(blob);
+   if (type == NULL)
+      return fail<const glsl_type>();
+
+   util_dynarray_append(&types, const glsl_type *, type);
+   return type;
+}
+
+ir_variable *
+ir_deserializer::read_variable_ref()
+{
+   const uint32_t index = blob_read_uint32(blob);
+
+   if (index >= util_dynarray_num_elements(&variables, ir_variable *))
+      return fail<ir_variable>();
+
+   return *util_dynarray_element(&variables, ir_variable *, index);
+}
+
+ir_instruction *
+ir_deserializer::read_instruction(bool optional)
+{
+   const uint8_t ir_type = blob_read_uint8(blob);
+   if (!ok())
+      return NULL;
+
+   switch (ir_type) {
+   case ir_type_unset:
+      if (!optional)
+         return fail<ir_instruction>();
+      return NULL;
+   case ir_type_dereference_array: {
+      ir_rvalue *array = read_rvalue();
+      ir_rvalue *array_index = read_rvalue();
+      if (!ok())
+         return NULL;
+      return new(mem_ctx) ir_dereference_array(array, array_index);
+   }
+   case ir_type_dereference_record:
+      return read_dereference_record();
+   case ir_type_dereference_variable: {
+      ir_variable *var = read_variable_ref();
+      if (!ok())
+         return NULL;
+      return new(mem_ctx) ir_dereference_variable(var);
+   }
+   case ir_type_constant:
+      return read_constant_value();
+   case ir_type_expression:
+      return read_expression();
+   case ir_type_swizzle:
+      return read_swizzle();
+   case ir_type_texture:
+      return read_texture();
+   case ir_type_variable:
+      return read_variable();
+   case ir_type_assignment:
+      return read_assignment();
+   case ir_type_call:
+      return read_call();
+   case ir_type_function:
+      return read_function();
+   case ir_type_if:
+      return read_if();
+   case ir_type_loop: {
+      ir_loop *loop = new(mem_ctx) ir_loop();
+      read_list(&loop->body_instructions);
+      return loop;
+   }
+   case ir_type_loop_jump: {
+      const uint8_t mode = blob_read_uint8(blob);
+      if (mode > ir_loop_jump::jump_continue)
+         return fail<ir_instruction>();
+      return new(mem_ctx) ir_loop_jump((ir_loop_jump::jump_mode) mode);
+   }
+   case ir_type_return: {
+      ir_rvalue *value = read_rvalue(true);
+      if (!ok())
+         return NULL;
+      return new(mem_ctx) ir_return(value);
+   }
+   case ir_type_discard: {
+      ir_rvalue *condition = read_rvalue(true);
+      if (!ok())
+         return NULL;
+      return new(mem_ctx) ir_discard(condition);
+   }
+   case ir_type_demote:
+      return new(mem_ctx) ir_demote();
+   case ir_type_emit_vertex: {
+      ir_rvalue *stream = read_rvalue();
+      if (!ok())
+         return NULL;
+      return new(mem_ctx) ir_emit_vertex(stream);
+   }
+   case ir_type_end_primitive: {
+      ir_rvalue *stream = read_rvalue();
+      if (!ok())
+         return NULL;
+      return new(mem_ctx) ir_end_primitive(stream);
+   }
+   case ir_type_barrier:
+      return new(mem_ctx) ir_barrier();
+   default:
+      /* Signatures are only ever read as part of their function. */
+      return fail<ir_instruction>();
+   }
+}
+
+ir_rvalue *
+ir_deserializer::read_rvalue(bool optional)
+{
+   ir_instruction *ir = read_instruction(optional);
+   if (ir == NULL)
+      return NULL;
+
+   ir_rvalue *rvalue = ir->as_rvalue();
+   if (rvalue == NULL)
+      return fail<ir_rvalue>();
+
+   return rvalue;
+}
+
+ir_dereference *
+ir_deserializer::read_dereference()
+{
+   ir_instruction *ir = read_instruction();
+   if (ir == NULL)
+      return NULL;
+
+   ir_dereference *deref = ir->as_dereference();
+   if (deref == NULL)
+      return fail<ir_dereference>();
+
+   return deref;
+}
+
+ir_constant *
+ir_deserializer::read_constant(bool optional)
+{
+   ir_instruction *ir = read_instruction(optional);
+   if (ir == NULL)
+      return NULL;
+
+   ir_constant *constant = ir->as_constant();
+   if (constant == NULL)
+      return fail<ir_constant>();
+
+   return constant;
+}
+
+ir_variable *
+ir_deserializer::read_variable()
+{
+   const glsl_type *type = read_type();
+   const char *name = blob_read_string(blob);
+
+   ir_variable::ir_variable_data data;
+   blob_copy_bytes(blob, &data, sizeof(data));
+
+   if (type == NULL || name == NULL || !ok() ||
+       data.mode >= ir_var_mode_count)
+      return fail<ir_variable>();
+
+   /* The constructor only keeps the names of temporaries when the context
+    * asked for them, which was decided when the shader was compiled, so a
+    * named temporary is made as an auto and gets its mode from \c data.
+    */
+   ir_variable_mode mode = (ir_variable_mode) data.mode;
+   if (mode == ir_var_temporary && strcmp(name, "compiler_temp") != 0)
+      mode = ir_var_auto;
+
+   ir_variable *var = new(mem_ctx) ir_variable(type, name, mode);
+   memcpy(&var->data, &data, sizeof(data));
+
+   util_dynarray_append(&variables, ir_variable *, var);
+
+   /* Whatever the interface or state slots were, they are allocated by
+    * these below.
+    */
+   const unsigned num_state_slots = var->get_num_state_slots();
+   var->set_num_state_slots(0);
+
+   const glsl_type *interface_type = read_type();
+   if (!ok())
+      return NULL;
+
+   if (interface_type != NULL) {
+      /* The constructor already did this for instances of a block. */
+      if (var->get_interface_type() == NULL)
+         var->init_interface_type(interface_type);
+      else if (var->get_interface_type() != interface_type)
+         var->change_interface_type(interface_type);
+
+      if (var->is_interface_instance()) {
+         blob_copy_bytes(blob, var->get_max_ifc_array_access(),
+                         interface_type->length * sizeof(int));
+      }
+   }
+
+   if (num_state_slots != 0) {
+      if (var->is_interface_instance())
+         return fail<ir_variable>();
+
+      ir_state_slot *slots = var->allocate_state_slots(num_state_slots);
+      blob_copy_bytes(blob, slots, num_state_slots * sizeof(ir_state_slot));
+   }
+
+   var->constant_value = read_constant(true);
+   var->constant_initializer = read_constant(true);
+
+   return var;
+}
+
+ir_function *
+ir_deserializer::read_function()
+{
+   const char *name = blob_read_string(blob);
+   if (name == NULL)
+      return fail<ir_function>();
+
+   ir_function *f = new(mem_ctx) ir_function(name);
+   f->is_subroutine = blob_read_uint8(blob);
+   f->subroutine_index = blob_read_uint32(blob);
+   f->num_subroutine_types = blob_read_uint32(blob);
+   if (!ok() || f->num_subroutine_types < 0)
+      return fail<ir_function>();
+
+   f->subroutine_types = ralloc_array(mem_ctx, const struct glsl_type *,
+                                      f->num_subroutine_types);
+   for (int i = 0; i < f->num_subroutine_types; i++)
+      f->subroutine_types[i] = read_type();
+
+   const uint32_t num_signatures = blob_read_uint32(blob);
+   for (uint32_t i = 0; i < num_signatures && ok(); i++) {
+      ir_function_signature *sig = read_signature();
+      if (sig != NULL)
+         f->add_signature(sig);
+   }
+
+   return f;
+}
+
+ir_function_signature *
+ir_deserializer::read_signature()
+{
+   const glsl_type *return_type = read_type();
+   if (return_type == NULL)
+      return fail<ir_function_signature>();
+
+   ir_function_signature *sig =
+      new(mem_ctx) ir_function_signature(return_type);
+   util_dynarray_append(&signatures, ir_function_signature *, sig);
+
+   sig->is_defined = blob_read_uint8(blob);
+   sig->return_precision = blob_read_uint8(blob);
+   sig->intrinsic_id = (ir_intrinsic_id) blob_read_uint32(blob);
+
+   read_list(&sig->parameters);
+   foreach_in_list(ir_instruction, param, &sig->parameters) {
+      if (param->ir_type != ir_type_variable)
+         return fail<ir_function_signature>();
+   }
+
+   read_list(&sig->body);
+
+   return sig;
+}
+
+ir_expression *
+ir_deserializer::read_expression()
+{
+   const uint32_t operation = blob_read_uint32(blob);
+   const glsl_type *type = read_type();
+   const uint8_t num_operands = blob_read_uint8(blob);
+
+   if (operation > ir_last_opcode || type == NULL ||
+       num_operands > ARRAY_SIZE(((ir_expression *) 0)->operands))
+      return fail<ir_expression>();
+
+   ir_rvalue *op[4] = { NULL, };
+   for (unsigned i = 0; i < num_operands; i++)
+      op[i] = read_rvalue();
+
+   if (!ok())
+      return NULL;
+
+   ir_expression *expr =
+      new(mem_ctx) ir_expression(operation, type, op[0], op[1], op[2], op[3]);
+   if (expr->num_operands != num_operands)
+      return fail<ir_expression>();
+
+   return expr;
+}
+
+ir_texture *
+ir_deserializer::read_texture()
+{
+   const uint8_t op = blob_read_uint8(blob);
+   const glsl_type *type = read_type();
+   if (op > ir_samples_identical || type == NULL)
+      return fail<ir_texture>();
+
+   ir_texture *tex = new(mem_ctx) ir_texture((ir_texture_opcode) op);
+
+   ir_dereference *sampler = read_dereference();
+   if (sampler == NULL)
+      return NULL;
+   tex->set_sampler(sampler, type);
+
+   tex->coordinate = read_rvalue(true);
+   tex->projector = read_rvalue(true);
+   tex->shadow_comparator = read_rvalue(true);
+   tex->offset = read_rvalue(true);
+
+   switch (tex->op) {
+   case ir_tex:
+   case ir_lod:
+   case ir_query_levels:
+   case ir_texture_samples:
+   case ir_samples_identical:
+      break;
+   case ir_txb:
+      tex->lod_info.bias = read_rvalue();
+      break;
+   case ir_txl:
+   case ir_txf:
+   case ir_txs:
+      tex->lod_info.lod = read_rvalue();
+      break;
+   case ir_txf_ms:
+      tex->lod_info.sample_index = read_rvalue();
+      break;
+   case ir_txd:
+      tex->lod_info.grad.dPdx = read_rvalue();
+      tex->lod_info.grad.dPdy = read_rvalue();
+      break;
+   case ir_tg4:
+      tex->lod_info.component = read_rvalue();
+      break;
+   }
+
+   return tex;
+}
+
+ir_swizzle *
+ir_deserializer::read_swizzle()
+{
+   const uint16_t bits = blob_read_uint16(blob);
+
+   ir_swizzle_mask mask;
+   mask.x = bits & 3;
+   mask.y = (bits >> 2) & 3;
+   mask.z = (bits >> 4) & 3;
+   mask.w = (bits >> 6) & 3;
+   mask.num_components = (bits >> 8) & 7;
+   mask.has_duplicates = (bits >> 11) & 1;
+
+   ir_rvalue *val = read_rvalue();
+   if (!ok())
+      return NULL;
+
+   if (mask.num_components < 1 || mask.num_components > 4)
+      return fail<ir_swizzle>();
+
+   return new(mem_ctx) ir_swizzle(val, mask);
+}
+
+ir_dereference_record *
+ir_deserializer::read_dereference_record()
+{
+   const uint32_t field_idx = blob_read_uint32(blob);
+   ir_rvalue *record = read_rvalue();
+   if (!ok())
+      return NULL;
+
+   if (!record->type->is_struct() && !record->type->is_interface())
+      return fail<ir_dereference_record>();
+   if (field_idx >= record->type->length)
+      return fail<ir_dereference_record>();
+
+   return new(mem_ctx) ir_dereference_record(record,
+      record->type->fields.structure[field_idx].name);
+}
+
+ir_assignment *
+ir_deserializer::read_assignment()
+{
+   const uint8_t write_mask = blob_read_uint8(blob);
+   ir_dereference *lhs = read_dereference();
+   ir_rvalue *rhs = read_rvalue();
+   ir_rvalue *condition = read_rvalue(true);
+   if (!ok())
+      return NULL;
+
+   return new(mem_ctx) ir_assignment(lhs, rhs, condition, write_mask);
+}
+
+ir_constant *
+ir_deserializer::read_constant_value()
+{
+   const glsl_type *type = read_type();
+   if (type == NULL)
+      return fail<ir_constant>();
+
+   if (type->is_array() || type->is_struct()) {
+      exec_list elements;
+      for (unsigned i = 0; i < type->length; i++) {
+         ir_constant *element = read_constant();
+         if (element == NULL)
+            return NULL;
+         elements.push_tail(element);
+      }
+      return new(mem_ctx) ir_constant(type, &elements);
+   }
+
+   const unsigned size = type->components() * type->bit_size() / 8;
+   if (size == 0 || size > sizeof(ir_constant_data))
+      return fail<ir_constant>();
+
+   ir_constant_data data;
+   memset(&data, 0, sizeof(data));
+   blob_copy_bytes(blob, &data, size);
+
+   return new(mem_ctx) ir_constant(type, &data);
+}
+
+/**
+ * Find the signature of the built-in function shader with the name and
+ * parameter types that follow.
+ */
+ir_function_signature *
+ir_deserializer::read_builtin_callee()
+{
+   const char *name = blob_read_string(blob);
+   const uint32_t num_params = blob_read_uint32(blob);
+   if (name == NULL || !ok())
+      return fail<ir_function_signature>();
+
+   const glsl_type **param_types =
+      ralloc_array(NULL, const glsl_type *, num_params);
+   for (uint32_t i = 0; i < num_params && ok(); i++)
+      param_types[i] = read_type();
+
+   ir_function_signature *match = NULL;
+   gl_shader *builtins = _mesa_glsl_get_builtin_function_shader();
+   ir_function *f = ok() && builtins != NULL ?
+      builtins->symbols->get_function(name) : NULL;
+
+   if (f != NULL) {
+      foreach_in_list(ir_function_signature, sig, &f->signatures) {
+         if (sig->parameters.length() != num_params)
+            continue;
+
+         uint32_t i = 0;
+         foreach_in_list(ir_variable, param, &sig->parameters) {
+            if (param->type != param_types[i])
+               break;
+            i++;
+         }
+
+         if (i == num_params) {
+            match = sig;
+            break;
+         }
+      }
+   }
+
+   ralloc_free(param_types);
+
+   if (match == NULL)
+      return fail<ir_function_signature>();
+
+   return match;
+}
+
+ir_call *
+ir_deserializer::read_call()
+{
+   ir_function_signature *callee;
+
+   switch (blob_read_uint8(blob)) {
+   case CALLEE_SIGNATURE: {
+      const uint32_t index = blob_read_uint32(blob);
+      if (index >= util_dynarray_num_elements(&signatures,
+                                              ir_function_signature *))
+         return fail<ir_call>();
+      callee = *util_dynarray_element(&signatures, ir_function_signature *,
+                                      index);
+      break;
+   }
+   case CALLEE_BUILTIN:
+      callee = read_builtin_callee();
+      break;
+   default:
+      return fail<ir_call>();
+   }
+
+   if (!ok())
+      return NULL;
+
+   ir_dereference_variable *return_deref = NULL;
+   ir_instruction *ir = read_instruction(true);
+   if (ir != NULL) {
+      return_deref = ir->as_dereference_variable();
+      if (return_deref == NULL)
+         return fail<ir_call>();
+   }
+
+   exec_list actual_parameters;
+   read_list(&actual_parameters);
+
+   ir_variable *sub_var = NULL;
+   if (blob_read_uint8(blob))
+      sub_var = read_variable_ref();
+   ir_rvalue *array_idx = read_rvalue(true);
+
+   if (!ok())
+      return NULL;
+
+   return new(mem_ctx) ir_call(callee, return_deref, &actual_parameters,
+                               sub_var, array_idx);
+}
+
+ir_if *
+ir_deserializer::read_if()
+{
+   ir_rvalue *condition = read_rvalue();
+   if (!ok())
+      return NULL;
+
+   ir_if *stmt = new(mem_ctx) ir_if(condition);
+   read_list(&stmt->then_instructions);
+   read_list(&stmt->else_instructions);
+   return stmt;
+}
+
+void
+serialize_glsl_ir(struct blob *blob, exec_list *instructions)
+{
+   ir_serialize_visitor v(blob);
+   v.write_list(instructions);
+}
+
+bool
+deserialize_glsl_ir(struct blob_reader *blob, void *mem_ctx,
+                    exec_list *instructions)
+{
+   ir_deserializer d(blob, mem_ctx);
+   return d.read_list(instructions);
+}
+
+/**
+ * Fingerprint of the build, so that blobs written by a compiler whose enums
+ * or structures differ are not read.
+ */
+static void
+write_header(struct blob *blob)
+{
+   blob_write_uint32(blob, IR_SERIALIZE_VERSION);
+   blob_write_uint32(blob, sizeof(ir_variable::ir_variable_data));
+   blob_write_uint32(blob, sizeof(gl_shader_info));
+   blob_write_uint32(blob, ir_last_opcode);
+   blob_write_uint32(blob, ir_intrinsic_generic_load);
+}
+
+static bool
+read_header(struct blob_reader *blob)
+{
+   struct blob header;
+   uint32_t expected[5];
+   blob_init_fixed(&header, expected, sizeof(expected));
+   write_header(&header);
+
+   for (unsigned i = 0; i < ARRAY_SIZE(expected); i++) {
+      if (blob_read_uint32(blob) != expected[i])
+         return false;
+   }
+
+   return !blob->overrun;
+}
+
+void
+serialize_glsl_shader(struct blob *blob, struct gl_shader *shader)
+{
+   assert(shader->CompileStatus == COMPILE_SUCCESS);
+
+   write_header(blob);
+
+   blob_write_uint32(blob, shader->Stage);
+   blob_write_uint32(blob, shader->Version);
+   blob_write_uint8(blob, shader->IsES);
+   blob_write_string(blob, shader->InfoLog ? shader->InfoLog : "");
+
+   blob_write_uint32(blob, shader->BlendSupport);
+   blob_write_uint8(blob, shader->EarlyFragmentTests);
+   blob_write_uint8(blob, shader->ARB_fragment_coord_conventions_enable);
+   blob_write_uint8(blob, shader->redeclares_gl_fragcoord);
+   blob_write_uint8(blob, shader->uses_gl_fragcoord);
+   blob_write_uint8(blob, shader->PostDepthCoverage);
+   blob_write_uint8(blob, shader->PixelInterlockOrdered);
+   blob_write_uint8(blob, shader->PixelInterlockUnordered);
+   blob_write_uint8(blob, shader->SampleInterlockOrdered);
+   blob_write_uint8(blob, shader->SampleInterlockUnordered);
+   blob_write_uint8(blob, shader->InnerCoverage);
+   blob_write_uint8(blob, shader->origin_upper_left);
+   blob_write_uint8(blob, shader->pixel_center_integer);
+   blob_write_uint8(blob, shader->bindless_sampler);
+   blob_write_uint8(blob, shader->bindless_image);
+   blob_write_uint8(blob, shader->bound_sampler);
+   blob_write_uint8(blob, shader->bound_image);
+   blob_write_bytes(blob, shader->TransformFeedbackBufferStride,
+                    sizeof(shader->TransformFeedbackBufferStride));
+   blob_write_bytes(blob, &shader->info, sizeof(shader->info));
+
+   serialize_glsl_ir(blob, shader->ir);
+
+   /* The gl_PerVertex redeclarations are kept in the symbol table even when
+    * no member is used; see _mesa_glsl_copy_symbols_from_table().
+    */
+   encode_type_to_blob(blob, shader->symbols->get_interface("gl_PerVertex",
+                                                            ir_var_shader_in));
+   encode_type_to_blob(blob, shader->symbols->get_interface("gl_PerVertex",
+                                                            ir_var_shader_out));
+}
+
+bool
+deserialize_glsl_shader(struct blob_reader *blob, struct gl_shader *shader)
+{
+   if (!read_header(blob))
+      return false;
+
+   if (blob_read_uint32(blob) != (uint32_t) shader->Stage)
+      return false;
+
+   const unsigned version = blob_read_uint32(blob);
+   const bool is_es = blob_read_uint8(blob);
+   const char *info_log = blob_read_string(blob);
+
+   gl_shader state;
+   state.BlendSupport = blob_read_uint32(blob);
+   state.EarlyFragmentTests = blob_read_uint8(blob);
+   state.ARB_fragment_coord_conventions_enable = blob_read_uint8(blob);
+   state.redeclares_gl_fragcoord = blob_read_uint8(blob);
+   state.uses_gl_fragcoord = blob_read_uint8(blob);
+   state.PostDepthCoverage = blob_read_uint8(blob);
+   state.PixelInterlockOrdered = blob_read_uint8(blob);
+   state.PixelInterlockUnordered = blob_read_uint8(blob);
+   state.SampleInterlockOrdered = blob_read_uint8(blob);
+   state.SampleInterlockUnordered = blob_read_uint8(blob);
+   state.InnerCoverage = blob_read_uint8(blob);
+   state.origin_upper_left = blob_read_uint8(blob);
+   state.pixel_center_integer = blob_read_uint8(blob);
+   state.bindless_sampler = blob_read_uint8(blob);
+   state.bindless_image = blob_read_uint8(blob);
+   state.bound_sampler = blob_read_uint8(blob);
+   state.bound_image = blob_read_uint8(blob);
+   blob_copy_bytes(blob, state.TransformFeedbackBufferStride,
+                   sizeof(state.TransformFeedbackBufferStride));
+   blob_copy_bytes(blob, &state.info, sizeof(state.info));
+
+   if (info_log == NULL || blob->overrun)
+      return false;
+
+   /* Same layout of the memory as after _mesa_glsl_compile_shader(). */
+   exec_list *ir = new(shader) exec_list;
+   void *ir_arena = ralloc_arena_context(ir);
+
+   if (!deserialize_glsl_ir(blob, ir_arena, ir)) {
+      ralloc_free(ir);
+      return false;
+   }
+
+   const glsl_type *per_vertex_in = decode_type_from_blob(blob);
+   const glsl_type *per_vertex_out = decode_type_from_blob(blob);
+   if (blob->overrun) {
+      ralloc_free(ir);
+      return false;
+   }
+
+   ralloc_free(shader->ir);
+   shader->ir = ir;
+
+   shader->symbols = new(shader->ir) glsl_symbol_table;
+   _mesa_glsl_copy_symbols_from_table(shader->ir, NULL, shader->symbols);
+   if (per_vertex_in != NULL) {
+      shader->symbols->add_interface(per_vertex_in->name, per_vertex_in,
+                                     ir_var_shader_in);
+   }
+   if (per_vertex_out != NULL) {
+      shader->symbols->add_interface(per_vertex_out->name, per_vertex_out,
+                                     ir_var_shader_out);
+   }
+
+   if (shader->InfoLog)
+      ralloc_free(shader->InfoLog);
+   shader->InfoLog = ralloc_strdup(shader, info_log);
+
+   shader->CompileStatus = COMPILE_SUCCESS;
+   shader->Version = version;
+   shader->IsES = is_es;
+   shader->BlendSupport = state.BlendSupport;
+   shader->EarlyFragmentTests = state.EarlyFragmentTests;
+   shader->ARB_fragment_coord_conventions_enable =
+      state.ARB_fragment_coord_conventions_enable;
+   shader->redeclares_gl_fragcoord = state.redeclares_gl_fragcoord;
+   shader->uses_gl_fragcoord = state.uses_gl_fragcoord;
+   shader->PostDepthCoverage = state.PostDepthCoverage;
+   shader->PixelInterlockOrdered = state.PixelInterlockOrdered;
+   shader->PixelInterlockUnordered = state.PixelInterlockUnordered;
+   shader->SampleInterlockOrdered = state.SampleInterlockOrdered;
+   shader->SampleInterlockUnordered = state.SampleInterlockUnordered;
+   shader->InnerCoverage = state.InnerCoverage;
+   shader->origin_upper_left = state.origin_upper_left;
+   shader->pixel_center_integer = state.pixel_center_integer;
+   shader->bindless_sampler = state.bindless_sampler;
+   shader->bindless_image = state.bindless_image;
+   shader->bound_sampler = state.bound_sampler;
+   shader->bound_image = state.bound_image;
+   memcpy(shader->TransformFeedbackBufferStride,
+          state.TransformFeedbackBufferStride,
+          sizeof(shader->TransformFeedbackBufferStride));
+   shader->info = state.info;
+
+   return true;
+}
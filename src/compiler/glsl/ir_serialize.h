@@ -0,0 +1,86 @@
+/* -*- c++ -*- */
+/*
+ * Copyright © 2026 xxGLSLCompiler contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file ir_serialize.h
+ *
+ * Binary serialization of GLSL IR.
+ *
+ * Unlike the s-expressions of ir_print_visitor and ir_reader, the binary form
+ * is only meant to be read back by the same build of the compiler, and as
+ * quickly as possible: types are written once and referred to by index, and
+ * variables and function signatures are referred to by the order in which
+ * they were declared.  This is enough to cache a compiled shader on disk
+ * and link it again in another process without running the front end.
+ */
+
+#ifndef IR_SERIALIZE_H
+#define IR_SERIALIZE_H
+
+#include "ir.h"
+
+struct blob;
+struct blob_reader;
+struct gl_shader;
+
+/**
+ * Write the instructions of \p instructions to \p blob.
+ *
+ * Calls to built-in functions are written by name and parameter types, and
+ * are bound to the signatures of the built-in function shader when read.
+ */
+void
+serialize_glsl_ir(struct blob *blob, exec_list *instructions);
+
+/**
+ * Read instructions written by serialize_glsl_ir() and append them to
+ * \p instructions, allocating them out of \p mem_ctx.
+ *
+ * \return false if the blob is truncated or inconsistent, in which case
+ *         \p instructions holds an unspecified part of the IR.
+ */
+bool
+deserialize_glsl_ir(struct blob_reader *blob, void *mem_ctx,
+                    exec_list *instructions);
+
+/**
+ * Write a compiled shader to \p blob: its IR and everything else that
+ * _mesa_glsl_compile_shader() leaves in the gl_shader for the linker.
+ */
+void
+serialize_glsl_shader(struct blob *blob, struct gl_shader *shader);
+
+/**
+ * Replace the IR, symbol table and compile state of \p shader by the ones
+ * written by serialize_glsl_shader(), as if the shader had just been
+ * compiled.
+ *
+ * \return false if the blob was written by another version of the
+ *         serializer or for another stage, or is truncated, in which case
+ *         \p shader is left as it was.
+ */
+bool
+deserialize_glsl_shader(struct blob_reader *blob, struct gl_shader *shader);
+
+#endif /* IR_SERIALIZE_H */
@@ -0,0 +1,267 @@
+/*
+ * Copyright © 2026 xxGLSLCompiler contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file link_cache.cpp
+ *
+ * The cache only holds the last IR linked for each stage, which is what an
+ * edit-and-relink loop needs, and doesn't grow with the number of edits.
+ */
+
+#include "link_cache.h"
+#include "ir.h"
+#include "glsl_parser_extras.h"
+#include "glsl_symbol_table.h"
+#include "main/mtypes.h"
+#include "util/ralloc.h"
+
+#define XXH_INLINE_ALL
+#include "util/xxhash.h"
+
+struct link_cache_stage {
+   uint64_t key;              /**< 0 if nothing is kept for the stage */
+   void *mem_ctx;
+   exec_list *ir;
+};
+
+struct link_cache {
+   link_cache_stage stages[MESA_SHADER_STAGES];
+
+   /**
+    * Summary of the interface between each stage and the next one that was
+    * last validated, or 0.
+    */
+   uint64_t interfaces[MESA_SHADER_STAGES];
+
+   unsigned reused_stages;
+   unsigned reused_interfaces;
+};
+
+struct link_cache *
+link_cache_create(void *mem_ctx)
+{
+   return rzalloc(mem_ctx, struct link_cache);
+}
+
+uint64_t
+link_cache_stage_key(const struct gl_shader_program *prog,
+                     struct gl_shader **shaders, unsigned num_shaders)
+{
+   if (prog->LinkCache == NULL || num_shaders == 0)
+      return 0;
+
+   /* resize_tes_inputs() sizes the inputs of the tessellation stages after
+    * the other stages, so their IR isn't a function of their sources alone.
+    */
+   const gl_shader_stage stage = shaders[0]->Stage;
+   if (stage == MESA_SHADER_TESS_CTRL || stage == MESA_SHADER_TESS_EVAL)
+      return 0;
+
+   /* The program settings that the linker checks before optimising. */
+   const unsigned settings[] = {
+      (unsigned) stage,
+      num_shaders,
+      prog->data->Version,
+      (unsigned) prog->IsES,
+      (unsigned) prog->SeparateShader,
+   };
+
+   XXH64_state_t state;
+   XXH64_reset(&state, 0);
+   XXH64_update(&state, settings, sizeof(settings));
+
+   for (unsigned i = 0; i < num_shaders; i++) {
+      if (shaders[i]->Source == NULL)
+         return 0;
+
+      /* Keep the NUL, so that the sources of two shaders can't run into one
+       * another.
+       */
+      XXH64_update(&state, shaders[i]->Source,
+                   strlen(shaders[i]->Source) + 1);
+   }
+
+   const uint64_t key = XXH64_digest(&state);
+   return key != 0 ? key : 1;
+}
+
+bool
+link_cache_restore_stage(struct gl_shader_program *prog,
+                         struct gl_linked_shader *sh, uint64_t key,
+                         void *mem_ctx)
+{
+   link_cache *const cache = prog->LinkCache;
+   if (cache == NULL || key == 0 || cache->stages[sh->Stage].key != key)
+      return false;
+
+   /* The IR that was linked is left for mem_ctx to free. */
+   sh->ir->make_empty();
+   clone_ir_list(mem_ctx, sh->ir, cache->stages[sh->Stage].ir);
+
+   /* lower_packed_varyings() finds main through the symbol table, which
+    * still has the functions that were just dropped.  The gl_PerVertex
+    * definitions aren't in the IR and are carried over.
+    */
+   glsl_symbol_table *const symbols = new(sh) glsl_symbol_table;
+   _mesa_glsl_copy_symbols_from_table(sh->ir, sh->symbols, symbols);
+   delete sh->symbols;
+   sh->symbols = symbols;
+
+   cache->reused_stages |= 1u << sh->Stage;
+   return true;
+}
+
+void
+link_cache_store_stage(struct gl_shader_program *prog,
+                       const struct gl_linked_shader *sh, uint64_t key)
+{
+   link_cache *const cache = prog->LinkCache;
+   if (cache == NULL || key == 0)
+      return;
+
+   link_cache_stage *const entry = &cache->stages[sh->Stage];
+
+   ralloc_free(entry->mem_ctx);
+   entry->mem_ctx = ralloc_context(cache);
+   entry->ir = new(entry->mem_ctx) exec_list;
+   clone_ir_list(entry->mem_ctx, entry->ir, sh->ir);
+   entry->key = key;
+}
+
+static void
+hash_variable(XXH64_state_t *state, const ir_variable *var)
+{
+   /* Types are unique, and ir_variable_data holds no pointers and is zeroed
+    * along with the variable, so all of it can be hashed as it is.
+    */
+   const glsl_type *const types[] = { var->type, var->get_interface_type() };
+
+   XXH64_update(state, var->name, strlen(var->name) + 1);
+   XXH64_update(state, types, sizeof(types));
+   XXH64_update(state, &var->data, sizeof(var->data));
+}
+
+uint64_t
+link_cache_globals_key(uint64_t key, struct gl_linked_shader *sh)
+{
+   if (key == 0)
+      return 0;
+
+   XXH64_state_t state;
+   XXH64_reset(&state, key);
+
+   foreach_in_list(ir_instruction, node, sh->ir) {
+      ir_variable *const var = node->as_variable();
+
+      if (var != NULL && var->data.mode != ir_var_temporary)
+         hash_variable(&state, var);
+   }
+
+   key = XXH64_digest(&state);
+   return key != 0 ? key : 1;
+}
+
+static void
+hash_interface(XXH64_state_t *state, struct gl_linked_shader *sh,
+               ir_variable_mode mode)
+{
+   foreach_in_list(ir_instruction, node, sh->ir) {
+      ir_variable *const var = node->as_variable();
+
+      if (var != NULL && var->data.mode == mode)
+         hash_variable(state, var);
+   }
+
+   const glsl_type *const per_vertex =
+      sh->symbols->get_interface("gl_PerVertex", mode);
+   XXH64_update(state, &per_vertex, sizeof(per_vertex));
+}
+
+uint64_t
+link_cache_interface_key(const struct gl_shader_program *prog,
+                         struct gl_linked_shader *producer,
+                         struct gl_linked_shader *consumer)
+{
+   if (prog->LinkCache == NULL)
+      return 0;
+
+   const unsigned settings[] = {
+      (unsigned) producer->Stage,
+      (unsigned) consumer->Stage,
+      prog->data->Version,
+      (unsigned) prog->IsES,
+      (unsigned) prog->SeparateShader,
+   };
+
+   XXH64_state_t state;
+   XXH64_reset(&state, 0);
+   XXH64_update(&state, settings, sizeof(settings));
+   hash_interface(&state, producer, ir_var_shader_out);
+   hash_interface(&state, consumer, ir_var_shader_in);
+
+   const uint64_t key = XXH64_digest(&state);
+   return key != 0 ? key : 1;
+}
+
+bool
+link_cache_has_interface(struct gl_shader_program *prog,
+                         const struct gl_linked_shader *producer,
+                         uint64_t key)
+{
+   link_cache *const cache = prog->LinkCache;
+   if (cache == NULL || key == 0 || cache->interfaces[producer->Stage] != key)
+      return false;
+
+   cache->reused_interfaces |= 1u << producer->Stage;
+   return true;
+}
+
+void
+link_cache_add_interface(struct gl_shader_program *prog,
+                         const struct gl_linked_shader *producer,
+                         uint64_t key)
+{
+   if (prog->LinkCache != NULL)
+      prog->LinkCache->interfaces[producer->Stage] = key;
+}
+
+void
+link_cache_begin(struct gl_shader_program *prog)
+{
+   if (prog->LinkCache != NULL) {
+      prog->LinkCache->reused_stages = 0;
+      prog->LinkCache->reused_interfaces = 0;
+   }
+}
+
+unsigned
+link_cache_reused_stages(const struct link_cache *cache)
+{
+   return cache->reused_stages;
+}
+
+unsigned
+link_cache_reused_interfaces(const struct link_cache *cache)
+{
+   return cache->reused_interfaces;
+}
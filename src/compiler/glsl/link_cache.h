@@ -0,0 +1,132 @@
+/* -*- c++ -*- */
+/*
+ * Copyright © 2026 xxGLSLCompiler contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file link_cache.h
+ *
+ * Incremental relinking of a program after some of its stages were edited.
+ *
+ * A program that has a link_cache in gl_shader_program::LinkCache keeps,
+ * for each stage, the IR that came out of the per-stage optimisation of its
+ * last link, keyed by a hash of the sources of the stage and of its global
+ * variables once the other stages were validated against them.  When the
+ * stage is linked again from the same sources, and with the same data from
+ * the other stages, that IR replaces the one that the optimisation loop
+ * would have produced.  Intrastage linking still runs, as
+ * it is cheap and sets up the gl_program of the stage.
+ *
+ * The cache also keeps a summary of the interface between each pair of
+ * consecutive stages that was validated, so that the outputs and inputs of
+ * two stages are only cross-validated again when either side changed.
+ *
+ * Varying and uniform locations are assigned again on every link, since they
+ * depend on all the stages at once.
+ */
+
+#ifndef GLSL_LINK_CACHE_H
+#define GLSL_LINK_CACHE_H
+
+#include <stdint.h>
+
+struct exec_list;
+struct gl_linked_shader;
+struct gl_shader;
+struct gl_shader_program;
+
+struct link_cache *
+link_cache_create(void *mem_ctx);
+
+/**
+ * Key of the stage linked from \c shaders, or 0 if the stage can't be cached
+ * because its IR also depends on the other stages of the program.
+ */
+uint64_t
+link_cache_stage_key(const struct gl_shader_program *prog,
+                     struct gl_shader **shaders, unsigned num_shaders);
+
+/**
+ * Fold into \c key, a key from link_cache_stage_key(), the global variables
+ * of \c sh as the interstage linking left them.  That is where the bindings,
+ * locations and array sizes that cross_validate_uniforms() copies over from
+ * the other stages end up, so that a stage is only restored if the other
+ * stages agree with them as well.
+ */
+uint64_t
+link_cache_globals_key(uint64_t key, struct gl_linked_shader *sh);
+
+/**
+ * Replace the IR of \c sh by a copy of the one kept for \c key, allocated
+ * out of \c mem_ctx like the rest of the IR being linked.
+ *
+ * \return false if there is no IR for \c key, in which case \c sh is left
+ *         as it was.
+ */
+bool
+link_cache_restore_stage(struct gl_shader_program *prog,
+                         struct gl_linked_shader *sh, uint64_t key,
+                         void *mem_ctx);
+
+/** Keep a copy of the IR of \c sh for \c key. */
+void
+link_cache_store_stage(struct gl_shader_program *prog,
+                       const struct gl_linked_shader *sh, uint64_t key);
+
+/**
+ * Summary of the interface between \c producer and \c consumer as the
+ * interstage validation sees it, or 0 if the program has no cache.
+ */
+uint64_t
+link_cache_interface_key(const struct gl_shader_program *prog,
+                         struct gl_linked_shader *producer,
+                         struct gl_linked_shader *consumer);
+
+/** Whether the interface \c key was validated by an earlier link. */
+bool
+link_cache_has_interface(struct gl_shader_program *prog,
+                         const struct gl_linked_shader *producer,
+                         uint64_t key);
+
+void
+link_cache_add_interface(struct gl_shader_program *prog,
+                         const struct gl_linked_shader *producer,
+                         uint64_t key);
+
+/**
+ * Start a link of \c prog.  The masks of what the link reuses are cleared.
+ */
+void
+link_cache_begin(struct gl_shader_program *prog);
+
+/** Mask of the stages whose IR the last link took from the cache. */
+unsigned
+link_cache_reused_stages(const struct link_cache *cache);
+
+/**
+ * Mask of the producer stages whose interface with the next stage the last
+ * link didn't validate again.
+ */
+unsigned
+link_cache_reused_interfaces(const struct link_cache *cache);
+
+#endif /* GLSL_LINK_CACHE_H */
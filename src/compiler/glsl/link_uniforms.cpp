@@ -475,7 +475,7 @@ public:
                       struct string_to_uint_map *hidden_map,
                       bool use_std430_as_default)
       : num_active_uniforms(0), num_hidden_uniforms(0), num_values(0),
-        num_shader_samplers(0), num_shader_images(0),
+        num_name_bytes(0), num_shader_samplers(0), num_shader_images(0),
         num_shader_uniform_components(0), num_shader_subroutines(0),
         is_buffer_block(false), is_shader_storage(false), map(map),
         hidden_map(hidden_map), current_var(NULL),
@@ -517,6 +517,12 @@ public:
     */
    unsigned num_values;
 
+   /**
+    * Number of bytes taken by the names of the active uniforms, including
+    * their NULs
+    */
+   unsigned num_name_bytes;
+
    /**
     * Number of samplers used
     */
@@ -604,6 +610,7 @@ private:
        * uniforms.
        */
       this->num_active_uniforms++;
+      this->num_name_bytes += strlen(name) + 1;
 
       if(!is_gl_identifier(name) && !is_shader_storage && !is_buffer_block)
          this->num_values += values;
@@ -684,9 +691,11 @@ public:
                               struct string_to_uint_map *map,
                               struct gl_uniform_storage *uniforms,
                               union gl_constant_value *values,
+                              char *names,
                               bool use_std430_as_default)
       : prog(prog), map(map), uniforms(uniforms),
         use_std430_as_default(use_std430_as_default), values(values),
+        names(names),
         bindless_targets(NULL), bindless_access(NULL),
         shader_storage_blocks_write_access(0)
    {
@@ -1101,7 +1110,16 @@ private:
          this->uniforms[id].remap_location = UNMAPPED_UNIFORM_LOC;
       }
 
-      this->uniforms[id].name = ralloc_strdup(this->uniforms, name);
+      /* Members of blocks have no storage, so they come here again for each
+       * stage that uses them, and keep the name they got the first time.
+       */
+      if (this->uniforms[id].name == NULL) {
+         const size_t size = strlen(name) + 1;
+
+         memcpy(this->names, name, size);
+         this->uniforms[id].name = this->names;
+         this->names += size;
+      }
       this->uniforms[id].type = base_type;
       this->uniforms[id].num_driver_storage = 0;
       this->uniforms[id].driver_storage = NULL;
@@ -1230,6 +1248,9 @@ private:
 public:
    union gl_constant_value *values;
 
+   /** Where the name of the next uniform goes */
+   char *names;
+
    gl_texture_index targets[MAX_SAMPLERS];
 
    /**
@@ -1439,6 +1460,24 @@ link_setup_uniform_remap_tables(struct gl_context *ctx,
       }
    }
 
+   /* Grow the table once for all the uniforms that have no location yet,
+    * as if none of them fit in the gaps left between explicit locations.
+    */
+   unsigned implicit_entries = 0;
+   for (unsigned i = 0; i < prog->data->NumUniformStorage; i++) {
+      const gl_uniform_storage *const uni = &prog->data->UniformStorage[i];
+
+      if (!uni->type->is_subroutine() && !uni->is_shader_storage &&
+          !uni->builtin && uni->remap_location == UNMAPPED_UNIFORM_LOC)
+         implicit_entries += MAX2(1, uni->array_elements);
+   }
+
+   if (implicit_entries > 0) {
+      prog->UniformRemapTable =
+         reralloc(prog, prog->UniformRemapTable, gl_uniform_storage *,
+                  prog->NumUniformRemapTable + implicit_entries);
+   }
+
    /* Reserve locations for rest of the uniforms. */
    for (unsigned i = 0; i < prog->data->NumUniformStorage; i++) {
 
@@ -1475,13 +1514,6 @@ link_setup_uniform_remap_tables(struct gl_context *ctx,
          empty_locs -= entries;
       } else {
          chosen_location = prog->NumUniformRemapTable;
-
-         /* resize remap table to fit new entries */
-         prog->UniformRemapTable =
-            reralloc(prog,
-                     prog->UniformRemapTable,
-                     gl_uniform_storage *,
-                     prog->NumUniformRemapTable + entries);
          prog->NumUniformRemapTable += entries;
       }
 
@@ -1536,6 +1568,38 @@ link_setup_uniform_remap_tables(struct gl_context *ctx,
       }
    }
 
+   /* Likewise, grow the subroutine table of each stage once. */
+   unsigned subroutine_entries[MESA_SHADER_STAGES] = { 0 };
+   for (unsigned i = 0; i < prog->data->NumUniformStorage; i++) {
+      const gl_uniform_storage *const uni = &prog->data->UniformStorage[i];
+
+      if (!uni->type->is_subroutine() ||
+          uni->remap_location != UNMAPPED_UNIFORM_LOC)
+         continue;
+
+      unsigned mask = prog->data->linked_stages;
+      while (mask) {
+         const int j = u_bit_scan(&mask);
+
+         if (uni->opaque[j].active)
+            subroutine_entries[j] += MAX2(1, uni->array_elements);
+      }
+   }
+
+   unsigned stages = prog->data->linked_stages;
+   while (stages) {
+      const int j = u_bit_scan(&stages);
+      struct gl_program *p = prog->_LinkedShaders[j]->Program;
+
+      if (subroutine_entries[j] > 0) {
+         p->sh.SubroutineUniformRemapTable =
+            reralloc(p, p->sh.SubroutineUniformRemapTable,
+                     gl_uniform_storage *,
+                     p->sh.NumSubroutineUniformRemapTable +
+                     subroutine_entries[j]);
+      }
+   }
+
    /* reserve subroutine locations */
    for (unsigned i = 0; i < prog->data->NumUniformStorage; i++) {
       if (!prog->data->UniformStorage[i].type->is_subroutine())
@@ -1556,12 +1620,6 @@ link_setup_uniform_remap_tables(struct gl_context *ctx,
          if (!prog->data->UniformStorage[i].opaque[j].active)
             continue;
 
-         p->sh.SubroutineUniformRemapTable =
-            reralloc(p,
-                     p->sh.SubroutineUniformRemapTable,
-                     gl_uniform_storage *,
-                     p->sh.NumSubroutineUniformRemapTable + entries);
-
          for (unsigned k = 0; k < entries; k++) {
             p->sh.SubroutineUniformRemapTable[p->sh.NumSubroutineUniformRemapTable + k] =
                &prog->data->UniformStorage[i];
@@ -1576,7 +1634,8 @@ link_setup_uniform_remap_tables(struct gl_context *ctx,
 static void
 link_assign_uniform_storage(struct gl_context *ctx,
                             struct gl_shader_program *prog,
-                            const unsigned num_data_slots)
+                            const unsigned num_data_slots,
+                            const unsigned num_name_bytes)
 {
    /* On the outside chance that there were no uniforms, bail out.
     */
@@ -1586,25 +1645,33 @@ link_assign_uniform_storage(struct gl_context *ctx,
    unsigned int boolean_true = ctx->Const.UniformBooleanTrue;
 
    union gl_constant_value *data;
+   char *names = NULL;
    if (prog->data->UniformStorage == NULL) {
-      prog->data->UniformStorage = rzalloc_array(prog->data,
-                                                 struct gl_uniform_storage,
-                                                 prog->data->NumUniformStorage);
-      data = rzalloc_array(prog->data->UniformStorage,
-                           union gl_constant_value, num_data_slots);
+      /* The uniforms, their values, the default values and the names of the
+       * uniforms all go in one block, sized by the first pass.
+       */
+      const size_t storage_size =
+         prog->data->NumUniformStorage * sizeof(struct gl_uniform_storage);
+      const size_t data_size = num_data_slots * sizeof(union gl_constant_value);
+      char *block = (char *) rzalloc_size(prog->data, storage_size +
+                                          2 * data_size + num_name_bytes);
+
+      prog->data->UniformStorage = (struct gl_uniform_storage *) block;
+      data = (union gl_constant_value *) (block + storage_size);
       prog->data->UniformDataDefaults =
-         rzalloc_array(prog->data->UniformStorage,
-                       union gl_constant_value, num_data_slots);
+         (union gl_constant_value *) (block + storage_size + data_size);
+      names = block + storage_size + 2 * data_size;
    } else {
       data = prog->data->UniformDataSlots;
    }
 
 #ifndef NDEBUG
    union gl_constant_value *data_end = &data[num_data_slots];
+   const char *names_end = names != NULL ? names + num_name_bytes : NULL;
 #endif
 
    parcel_out_uniform_storage parcel(prog, prog->UniformHash,
-                                     prog->data->UniformStorage, data,
+                                     prog->data->UniformStorage, data, names,
                                      ctx->Const.UseSTD430AsDefaultPacking);
 
    for (unsigned i = 0; i < MESA_SHADER_STAGES; i++) {
@@ -1667,6 +1734,7 @@ link_assign_uniform_storage(struct gl_context *ctx,
    }
 
    assert(parcel.values == data_end);
+   assert(parcel.names <= names_end);
 #endif
 
    link_setup_uniform_remap_tables(ctx, prog);
@@ -1763,5 +1831,6 @@ link_assign_uniform_locations(struct gl_shader_program *prog,
    hiddenUniforms->iterate(assign_hidden_uniform_slot_id, &uniform_size);
    delete hiddenUniforms;
 
-   link_assign_uniform_storage(ctx, prog, uniform_size.num_values);
+   link_assign_uniform_storage(ctx, prog, uniform_size.num_values,
+                               uniform_size.num_name_bytes);
 }
@@ -732,6 +732,13 @@ validate_first_and_last_interface_explicit_locations(struct gl_context *ctx,
    }
 }
 
+static ir_variable *
+find_output(hash_table *outputs, const char *name)
+{
+   hash_entry *entry = _mesa_hash_table_search(outputs, name);
+   return entry ? (ir_variable *) entry->data : NULL;
+}
+
 /**
  * Validate that outputs from one stage match inputs of another
  */
@@ -741,7 +748,8 @@ cross_validate_outputs_to_inputs(struct gl_context *ctx,
                                  gl_linked_shader *producer,
                                  gl_linked_shader *consumer)
 {
-   glsl_symbol_table parameters;
+   hash_table *parameters = _mesa_hash_table_create(NULL, _mesa_hash_string,
+                                                    _mesa_key_string_equal);
    struct explicit_location_info output_explicit_locations[MAX_VARYING][4] = {};
    struct explicit_location_info input_explicit_locations[MAX_VARYING][4] = {};
 
@@ -754,15 +762,23 @@ cross_validate_outputs_to_inputs(struct gl_context *ctx,
          continue;
 
       if (!var->data.explicit_location
-          || var->data.location < VARYING_SLOT_VAR0)
-         parameters.add_variable(var);
-      else {
+          || var->data.location < VARYING_SLOT_VAR0) {
+         /* The names are borrowed from the variables, which outlive the
+          * table.  Keep the first of two outputs of the same name, as the
+          * symbol table did.
+          */
+         const uint32_t hash = _mesa_hash_string(var->name);
+         if (!_mesa_hash_table_search_pre_hashed(parameters, hash, var->name))
+            _mesa_hash_table_insert_pre_hashed(parameters, hash, var->name,
+                                               var);
+      } else {
          /* User-defined varyings with explicit locations are handled
           * differently because they do not need to have matching names.
           */
          if (!validate_explicit_variable_location(ctx,
                                                   output_explicit_locations,
                                                   var, prog, producer)) {
+            _mesa_hash_table_destroy(parameters, NULL);
             return;
          }
       }
@@ -785,20 +801,20 @@ cross_validate_outputs_to_inputs(struct gl_context *ctx,
 
       if (strcmp(input->name, "gl_Color") == 0 && input->data.used) {
          const ir_variable *const front_color =
-            parameters.get_variable("gl_FrontColor");
+            find_output(parameters, "gl_FrontColor");
 
          const ir_variable *const back_color =
-            parameters.get_variable("gl_BackColor");
+            find_output(parameters, "gl_BackColor");
 
          cross_validate_front_and_back_color(ctx, prog, input,
                                              front_color, back_color,
                                              consumer->Stage, producer->Stage);
       } else if (strcmp(input->name, "gl_SecondaryColor") == 0 && input->data.used) {
          const ir_variable *const front_color =
-            parameters.get_variable("gl_FrontSecondaryColor");
+            find_output(parameters, "gl_FrontSecondaryColor");
 
          const ir_variable *const back_color =
-            parameters.get_variable("gl_BackSecondaryColor");
+            find_output(parameters, "gl_BackSecondaryColor");
 
          cross_validate_front_and_back_color(ctx, prog, input,
                                              front_color, back_color,
@@ -822,6 +838,7 @@ cross_validate_outputs_to_inputs(struct gl_context *ctx,
             if (!validate_explicit_variable_location(ctx,
                                                      input_explicit_locations,
                                                      input, prog, consumer)) {
+               _mesa_hash_table_destroy(parameters, NULL);
                return;
             }
 
@@ -859,7 +876,7 @@ cross_validate_outputs_to_inputs(struct gl_context *ctx,
                idx++;
             }
          } else {
-            output = parameters.get_variable(input->name);
+            output = find_output(parameters, input->name);
          }
 
          if (output != NULL) {
@@ -887,6 +904,8 @@ cross_validate_outputs_to_inputs(struct gl_context *ctx,
          }
       }
    }
+
+   _mesa_hash_table_destroy(parameters, NULL);
 }
 
 /**
@@ -2322,10 +2341,45 @@ private:
 };
 
 
+/**
+ * Hash of an input or output in an interface block, keyed on the block and
+ * variable names as if they were joined as "block.var".
+ */
+static uint32_t
+interface_member_hash(const void *key)
+{
+   const ir_variable *const var = (const ir_variable *) key;
+   const glsl_type *const iface = var->get_interface_type()->without_array();
+
+   return _mesa_hash_string(iface->name) * 31 + _mesa_hash_string(var->name);
+}
+
+static bool
+interface_member_equal(const void *a, const void *b)
+{
+   const ir_variable *const x = (const ir_variable *) a;
+   const ir_variable *const y = (const ir_variable *) b;
+
+   return strcmp(x->name, y->name) == 0 &&
+          strcmp(x->get_interface_type()->without_array()->name,
+                 y->get_interface_type()->without_array()->name) == 0;
+}
+
 namespace linker {
 
+/**
+ * Create the table of consumer_interface_inputs, which is keyed on the
+ * ir_variables themselves and looked up with the producer's outputs.
+ */
+hash_table *
+create_interface_member_table(void *mem_ctx)
+{
+   return _mesa_hash_table_create(mem_ctx, interface_member_hash,
+                                  interface_member_equal);
+}
+
 void
-populate_consumer_input_sets(void *mem_ctx, exec_list *ir,
+populate_consumer_input_sets(exec_list *ir,
                              hash_table *consumer_inputs,
                              hash_table *consumer_interface_inputs,
                              ir_variable *consumer_inputs_with_locations[VARYING_SLOT_TESS_MAX])
@@ -2361,15 +2415,13 @@ populate_consumer_input_sets(void *mem_ctx, exec_list *ir,
             consumer_inputs_with_locations[input_var->data.location] =
                input_var;
          } else if (input_var->get_interface_type() != NULL) {
-            char *const iface_field_name =
-               ralloc_asprintf(mem_ctx, "%s.%s",
-                  input_var->get_interface_type()->without_array()->name,
-                  input_var->name);
             _mesa_hash_table_insert(consumer_interface_inputs,
-                                    iface_field_name, input_var);
+                                    input_var, input_var);
          } else {
-            _mesa_hash_table_insert(consumer_inputs,
-                                    ralloc_strdup(mem_ctx, input_var->name),
+            /* The tables only live while locations are assigned, so they
+             * can borrow the names of the variables.
+             */
+            _mesa_hash_table_insert(consumer_inputs, input_var->name,
                                     input_var);
          }
       }
@@ -2383,8 +2435,7 @@ populate_consumer_input_sets(void *mem_ctx, exec_list *ir,
  * validation (here) that the types, etc. are compatible.
  */
 ir_variable *
-get_matching_input(void *mem_ctx,
-                   const ir_variable *output_var,
+get_matching_input(const ir_variable *output_var,
                    hash_table *consumer_inputs,
                    hash_table *consumer_interface_inputs,
                    ir_variable *consumer_inputs_with_locations[VARYING_SLOT_TESS_MAX])
@@ -2394,11 +2445,7 @@ get_matching_input(void *mem_ctx,
    if (output_var->data.explicit_location) {
       input_var = consumer_inputs_with_locations[output_var->data.location];
    } else if (output_var->get_interface_type() != NULL) {
-      char *const iface_field_name =
-         ralloc_asprintf(mem_ctx, "%s.%s",
-            output_var->get_interface_type()->without_array()->name,
-            output_var->name);
-      hash_entry *entry = _mesa_hash_table_search(consumer_interface_inputs, iface_field_name);
+      hash_entry *entry = _mesa_hash_table_search(consumer_interface_inputs, output_var);
       input_var = entry ? (ir_variable *) entry->data : NULL;
    } else {
       hash_entry *entry = _mesa_hash_table_search(consumer_inputs, output_var->name);
@@ -2589,8 +2636,7 @@ assign_varying_locations(struct gl_context *ctx,
          _mesa_hash_table_create(hash_table_ctx, _mesa_hash_string,
                                  _mesa_key_string_equal);
    hash_table *consumer_interface_inputs =
-         _mesa_hash_table_create(hash_table_ctx, _mesa_hash_string,
-                                 _mesa_key_string_equal);
+         linker::create_interface_member_table(hash_table_ctx);
    ir_variable *consumer_inputs_with_locations[VARYING_SLOT_TESS_MAX] = {
       NULL,
    };
@@ -2621,7 +2667,7 @@ assign_varying_locations(struct gl_context *ctx,
       canonicalize_shader_io(producer->ir, ir_var_shader_out);
 
    if (consumer)
-      linker::populate_consumer_input_sets(mem_ctx, consumer->ir,
+      linker::populate_consumer_input_sets(consumer->ir,
                                            consumer_inputs,
                                            consumer_interface_inputs,
                                            consumer_inputs_with_locations);
@@ -2664,7 +2710,7 @@ assign_varying_locations(struct gl_context *ctx,
          }
 
          ir_variable *const input_var =
-            linker::get_matching_input(mem_ctx, output_var, consumer_inputs,
+            linker::get_matching_input(output_var, consumer_inputs,
                                        consumer_interface_inputs,
                                        consumer_inputs_with_locations);
 
@@ -2728,7 +2774,7 @@ assign_varying_locations(struct gl_context *ctx,
        * start removing things we shouldn't.
        */
       ir_variable *const input_var =
-         linker::get_matching_input(mem_ctx, matched_candidate->toplevel_var,
+         linker::get_matching_input(matched_candidate->toplevel_var,
                                     consumer_inputs,
                                     consumer_interface_inputs,
                                     consumer_inputs_with_locations);
@@ -65,6 +65,7 @@
  */
 
 #include <ctype.h>
+#include "c11/threads.h"
 #include "util/strndup.h"
 #include "glsl_symbol_table.h"
 #include "glsl_parser_extras.h"
@@ -77,10 +78,12 @@
 #include "linker.h"
 #include "linker_util.h"
 #include "link_varyings.h"
+#include "link_cache.h"
 #include "ir_optimization.h"
 #include "ir_rvalue_visitor.h"
 #include "ir_uniform.h"
 #include "builtin_functions.h"
+#include "util/bitscan.h"
 #include "util/u_string.h"
 #include "util/u_math.h"
 
@@ -4501,6 +4504,91 @@ linker_optimisation_loop(struct gl_context *ctx, exec_list *ir,
       }
 }
 
+static void
+optimise_linked_shader(struct gl_context *ctx, struct gl_linked_shader *sh)
+{
+   /* Call opts before lowering const arrays to uniforms so we can const
+    * propagate any elements accessed directly.
+    */
+   linker_optimisation_loop(ctx, sh->ir, sh->Stage);
+
+   /* Call opts after lowering const arrays to copy propagate things. */
+   if (ctx->Const.GLSLLowerConstArrays &&
+       lower_const_arrays_to_uniforms(sh->ir, sh->Stage,
+                                      ctx->Const.Program[sh->Stage].MaxUniformComponents))
+      linker_optimisation_loop(ctx, sh->ir, sh->Stage);
+}
+
+struct optimise_thread {
+   struct gl_context *ctx;
+   struct gl_linked_shader *sh;
+   thrd_t thread;
+   bool started;
+};
+
+static int
+optimise_thread_main(void *data)
+{
+   struct optimise_thread *thread = (struct optimise_thread *) data;
+
+   optimise_linked_shader(thread->ctx, thread->sh);
+   return 0;
+}
+
+/**
+ * Optimise each of the linked shaders of \c prog in the mask \c stages.
+ *
+ * Until their varyings are linked, the IR of the stages is independent, so
+ * with GLSLParallelLink every stage but the last is optimised on a thread of
+ * its own.  ralloc isn't thread-safe, so the IR of each of these stages is
+ * first moved from \c mem_ctx to a context of its own, which is where the
+ * optimisation passes then allocate from.
+ */
+static void
+optimise_linked_shaders(struct gl_context *ctx, struct gl_shader_program *prog,
+                        unsigned stages, void *mem_ctx)
+{
+   if (!ctx->Const.GLSLParallelLink || util_bitcount(stages) < 2) {
+      while (stages) {
+         const int i = u_bit_scan(&stages);
+         optimise_linked_shader(ctx, prog->_LinkedShaders[i]);
+      }
+      return;
+   }
+
+   struct optimise_thread threads[MESA_SHADER_STAGES];
+   unsigned mask = stages;
+   while (mask) {
+      const int i = u_bit_scan(&mask);
+
+      threads[i].ctx = ctx;
+      threads[i].sh = prog->_LinkedShaders[i];
+      threads[i].started = false;
+      reparent_ir(threads[i].sh->ir, ralloc_context(mem_ctx));
+   }
+
+   mask = stages;
+   while (mask) {
+      const int i = u_bit_scan(&mask);
+
+      if (mask != 0) {
+         threads[i].started = thrd_create(&threads[i].thread,
+                                          optimise_thread_main,
+                                          &threads[i]) == thrd_success;
+      }
+      if (!threads[i].started)
+         optimise_thread_main(&threads[i]);
+   }
+
+   mask = stages;
+   while (mask) {
+      const int i = u_bit_scan(&mask);
+
+      if (threads[i].started)
+         thrd_join(threads[i].thread, NULL);
+   }
+}
+
 void
 link_shaders(struct gl_context *ctx, struct gl_shader_program *prog)
 {
@@ -4535,6 +4623,10 @@ link_shaders(struct gl_context *ctx, struct gl_shader_program *prog)
 
    prog->ARB_fragment_coord_conventions_enable = false;
 
+   link_cache_begin(prog);
+   uint64_t cache_keys[MESA_SHADER_STAGES] = { 0 };
+   unsigned optimise_stages = 0;
+
    /* Separate the shaders into groups based on their type.
     */
    struct gl_shader **shader_list[MESA_SHADER_STAGES];
@@ -4654,8 +4746,12 @@ link_shaders(struct gl_context *ctx, struct gl_shader_program *prog)
 
    /* Link all shaders for a particular stage and validate the result.
     */
+   ralloc_stats_site("intrastage linking");
    for (int stage = 0; stage < MESA_SHADER_STAGES; stage++) {
       if (num_shaders[stage] > 0) {
+         cache_keys[stage] = link_cache_stage_key(prog, shader_list[stage],
+                                                  num_shaders[stage]);
+
          gl_linked_shader *const sh =
             link_intrastage_shaders(mem_ctx, ctx, prog, shader_list[stage],
                                     num_shaders[stage], false);
@@ -4698,6 +4794,7 @@ link_shaders(struct gl_context *ctx, struct gl_shader_program *prog)
     * performed, then locations are assigned for uniforms, attributes, and
     * varyings.
     */
+   ralloc_stats_site("interstage linking");
    cross_validate_uniforms(ctx, prog);
    if (!prog->data->LinkStatus)
       goto done;
@@ -4733,16 +4830,29 @@ link_shaders(struct gl_context *ctx, struct gl_shader_program *prog)
       if (prog->_LinkedShaders[i] == NULL)
          continue;
 
-      validate_interstage_inout_blocks(prog, prog->_LinkedShaders[prev],
-                                       prog->_LinkedShaders[i]);
-      if (!prog->data->LinkStatus)
-         goto done;
+      /* Outputs and inputs that were validated against each other by an
+       * earlier link still match.
+       */
+      const uint64_t interface_key =
+         link_cache_interface_key(prog, prog->_LinkedShaders[prev],
+                                  prog->_LinkedShaders[i]);
+
+      if (!link_cache_has_interface(prog, prog->_LinkedShaders[prev],
+                                    interface_key)) {
+         validate_interstage_inout_blocks(prog, prog->_LinkedShaders[prev],
+                                          prog->_LinkedShaders[i]);
+         if (!prog->data->LinkStatus)
+            goto done;
 
-      cross_validate_outputs_to_inputs(ctx, prog,
-                                       prog->_LinkedShaders[prev],
-                                       prog->_LinkedShaders[i]);
-      if (!prog->data->LinkStatus)
-         goto done;
+         cross_validate_outputs_to_inputs(ctx, prog,
+                                          prog->_LinkedShaders[prev],
+                                          prog->_LinkedShaders[i]);
+         if (!prog->data->LinkStatus)
+            goto done;
+
+         link_cache_add_interface(prog, prog->_LinkedShaders[prev],
+                                  interface_key);
+      }
 
       prev = i;
    }
@@ -4837,17 +4947,22 @@ link_shaders(struct gl_context *ctx, struct gl_shader_program *prog)
          }
       }
 
-      /* Call opts before lowering const arrays to uniforms so we can const
-       * propagate any elements accessed directly.
+      /* A stage linked from the same sources as last time, whose
+       * variables got the same bindings, locations and sizes from the other
+       * stages, is optimised into the same IR as last time.
        */
-      linker_optimisation_loop(ctx, prog->_LinkedShaders[i]->ir, i);
+      cache_keys[i] = link_cache_globals_key(cache_keys[i],
+                                             prog->_LinkedShaders[i]);
+      if (!link_cache_restore_stage(prog, prog->_LinkedShaders[i],
+                                    cache_keys[i], mem_ctx))
+         optimise_stages |= 1 << i;
+   }
 
-      /* Call opts after lowering const arrays to copy propagate things. */
-      if (ctx->Const.GLSLLowerConstArrays &&
-          lower_const_arrays_to_uniforms(prog->_LinkedShaders[i]->ir, i,
-                                         ctx->Const.Program[i].MaxUniformComponents))
-         linker_optimisation_loop(ctx, prog->_LinkedShaders[i]->ir, i);
+   optimise_linked_shaders(ctx, prog, optimise_stages, mem_ctx);
 
+   for (unsigned i = 0; i < MESA_SHADER_STAGES; i++) {
+      if (optimise_stages & (1 << i))
+         link_cache_store_stage(prog, prog->_LinkedShaders[i], cache_keys[i]);
    }
 
    /* Validation for special cases where we allow sampler array indexing
@@ -4865,6 +4980,7 @@ link_shaders(struct gl_context *ctx, struct gl_shader_program *prog)
 
    store_fragdepth_layout(prog);
 
+   ralloc_stats_site("varyings and uniforms");
    if(!link_varyings_and_uniforms(first, last, ctx, prog, mem_ctx))
       goto done;
 
@@ -30,6 +30,9 @@
 
 /* Utility methods shared between the GLSL IR and the NIR */
 
+/** Size of the resource list when its first resource is added. */
+#define PROGRAM_RESOURCE_LIST_MIN_SIZE 16
+
 /* From the OpenGL 4.6 specification, 7.3.1.1 Naming Active Resources:
  *
  *    "For an active shader storage block member declared as an array of an
@@ -78,15 +81,25 @@ link_util_add_program_resource(struct gl_shader_program *prog,
    if (_mesa_set_search(resource_set, data))
       return true;
 
-   prog->data->ProgramResourceList =
-      reralloc(prog->data,
-               prog->data->ProgramResourceList,
-               gl_program_resource,
-               prog->data->NumProgramResourceList + 1);
-
-   if (!prog->data->ProgramResourceList) {
-      linker_error(prog, "Out of memory during linking.\n");
-      return false;
+   /* The list is only ever built up from empty by this function, so rather
+    * than tracking its capacity, grow it to twice its size whenever the
+    * count reaches a power of two.  Adding N resources then copies O(N) of
+    * them instead of O(N^2).
+    */
+   const unsigned num = prog->data->NumProgramResourceList;
+   if (num == 0 ||
+       (num >= PROGRAM_RESOURCE_LIST_MIN_SIZE &&
+        util_is_power_of_two_nonzero(num))) {
+      prog->data->ProgramResourceList =
+         reralloc(prog->data,
+                  prog->data->ProgramResourceList,
+                  gl_program_resource,
+                  MAX2(num * 2, PROGRAM_RESOURCE_LIST_MIN_SIZE));
+
+      if (!prog->data->ProgramResourceList) {
+         linker_error(prog, "Out of memory during linking.\n");
+         return false;
+      }
    }
 
    struct gl_program_resource *res =
@@ -46,6 +46,9 @@ extern bool
 unroll_loops(exec_list *instructions, loop_state *ls,
              const struct gl_shader_compiler_options *options);
 
+extern bool
+hoist_loop_invariants(exec_list *instructions, loop_state *ls);
+
 
 /**
  * Tracking for all variables used in a loop
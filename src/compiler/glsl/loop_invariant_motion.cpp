@@ -0,0 +1,234 @@
+/*
+ * Copyright © 2026 xxGLSLCompiler contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file loop_invariant_motion.cpp
+ *
+ * Hoists loop-invariant expressions out of loops.
+ *
+ * An expression is invariant in a loop when every variable it reads is
+ * declared outside of the loop and never assigned inside it, as recorded by
+ * analyze_loop_variables().
+ * The largest such expression trees are computed once into a temporary
+ * declared just before the ir_loop, and the loop body reads the temporary
+ * instead.  Expressions have no side effects, so evaluating them when the
+ * loop would have run zero times is harmless.
+ *
+ * Loops that contain calls are left alone, since the analysis can't tell
+ * what the callee writes.
+ */
+
+#include "compiler/glsl_types.h"
+#include "loop_analysis.h"
+#include "ir_hierarchical_visitor.h"
+#include "ir_rvalue_visitor.h"
+#include "util/set.h"
+
+namespace {
+
+class loop_declaration_visitor : public ir_hierarchical_visitor {
+public:
+   loop_declaration_visitor()
+   {
+      this->locals = _mesa_pointer_set_create(NULL);
+   }
+
+   ~loop_declaration_visitor()
+   {
+      _mesa_set_destroy(this->locals, NULL);
+   }
+
+   virtual ir_visitor_status visit(ir_variable *ir)
+   {
+      _mesa_set_add(locals, ir);
+      return visit_continue;
+   }
+
+   struct set *locals;
+};
+
+
+class loop_invariant_visitor : public ir_hierarchical_visitor {
+public:
+   loop_invariant_visitor(loop_variable_state *ls, struct set *locals)
+      : ls(ls), locals(locals), invariant(true)
+   {
+   }
+
+   virtual ir_visitor_status visit(ir_dereference_variable *ir)
+   {
+      /* Values that another invocation may change while the loop runs
+       * can't be read once up front.
+       */
+      switch (ir->var->data.mode) {
+      case ir_var_shader_storage:
+      case ir_var_shader_shared:
+      case ir_var_shader_out:
+         invariant = false;
+         return visit_stop;
+      default:
+         break;
+      }
+
+      if (ir->var->data.memory_volatile) {
+         invariant = false;
+         return visit_stop;
+      }
+
+      /* A variable declared in the loop, even one that is never assigned,
+       * doesn't exist yet in front of it.
+       */
+      if (_mesa_set_search(locals, ir->var) != NULL) {
+         invariant = false;
+         return visit_stop;
+      }
+
+      /* Variables that the analysis never saw in the loop were created by
+       * an earlier hoist, and are only assigned outside of it.  Any other
+       * variable assigned in the loop is variant, even a const local, as
+       * its initializer needn't be constant since GLSL 4.20.
+       */
+      loop_variable *lv = ls->get(ir->var);
+      if (lv != NULL && lv->num_assignments != 0) {
+         invariant = false;
+         return visit_stop;
+      }
+
+      return visit_continue;
+   }
+
+   virtual ir_visitor_status visit_enter(ir_texture *)
+   {
+      /* Implicit derivatives depend on where the lookup happens. */
+      invariant = false;
+      return visit_stop;
+   }
+
+   loop_variable_state *ls;
+   struct set *locals;
+   bool invariant;
+};
+
+
+class loop_hoist_visitor : public ir_rvalue_enter_visitor {
+public:
+   loop_hoist_visitor(ir_loop *loop, loop_variable_state *ls,
+                      struct set *locals)
+      : loop(loop), ls(ls), locals(locals), progress(false)
+   {
+   }
+
+   virtual void handle_rvalue(ir_rvalue **rvalue);
+
+   ir_loop *loop;
+   loop_variable_state *ls;
+   struct set *locals;
+   bool progress;
+};
+
+
+class loop_motion_visitor : public ir_hierarchical_visitor {
+public:
+   loop_motion_visitor(loop_state *state)
+      : state(state), progress(false)
+   {
+   }
+
+   virtual ir_visitor_status visit_enter(ir_loop *ir);
+
+   loop_state *state;
+   bool progress;
+};
+
+} /* anonymous namespace */
+
+
+void
+loop_hoist_visitor::handle_rvalue(ir_rvalue **rvalue)
+{
+   if (*rvalue == NULL)
+      return;
+
+   ir_expression *expr = (*rvalue)->as_expression();
+   if (expr == NULL)
+      return;
+
+   if (!expr->type->is_scalar() && !expr->type->is_vector() &&
+       !expr->type->is_matrix())
+      return;
+
+   loop_invariant_visitor v(ls, locals);
+   expr->accept(&v);
+   if (!v.invariant)
+      return;
+
+   /* Since this is an enter visitor, the outermost invariant expression is
+    * seen first, and its operands are never visited once it is replaced.
+    */
+   void *mem_ctx = ralloc_parent(expr);
+   ir_variable *var = new(mem_ctx) ir_variable(expr->type, "loop_invariant",
+                                               ir_var_temporary);
+
+   loop->insert_before(var);
+   loop->insert_before(new(mem_ctx) ir_assignment(
+                          new(mem_ctx) ir_dereference_variable(var), expr));
+
+   *rvalue = new(mem_ctx) ir_dereference_variable(var);
+   progress = true;
+}
+
+
+ir_visitor_status
+loop_motion_visitor::visit_enter(ir_loop *ir)
+{
+   loop_variable_state *const ls = this->state->get(ir);
+
+   /* Function calls may contain side effects, so the analysis of the loop
+    * wasn't completed.
+    */
+   if (ls == NULL || ls->contains_calls)
+      return visit_continue;
+
+   /* Hoist out of the outer loop first, so that an expression invariant in
+    * both loops ends up in front of the outermost one.
+    */
+   loop_declaration_visitor d;
+   visit_list_elements(&d, &ir->body_instructions);
+
+   loop_hoist_visitor v(ir, ls, d.locals);
+   visit_list_elements(&v, &ir->body_instructions);
+   this->progress |= v.progress;
+
+   return visit_continue;
+}
+
+
+bool
+hoist_loop_invariants(exec_list *instructions, loop_state *ls)
+{
+   loop_motion_visitor v(ls);
+
+   v.run(instructions);
+
+   return v.progress;
+}
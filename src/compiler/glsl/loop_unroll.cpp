@@ -55,19 +55,39 @@ public:
 
 } /* anonymous namespace */
 
+/**
+ * SPIR-V words spent on the loop itself: OpLoopMerge, the header, body,
+ * continue and merge labels, and the branches between them.
+ */
+static const unsigned loop_overhead_words = 4 + 4 * 2 + 3 * 2;
+
+/**
+ * Estimates the size of a loop body, in SPIR-V words, before and after
+ * unrolling.
+ *
+ * \c cost is the size of one iteration as the body stands.  \c folded is
+ * the part of it that unrolling is expected to remove: the limiting
+ * terminator, the induction variable updates, and every expression whose
+ * operands are constants or induction variables, which constant
+ * propagation folds away once each copy of the body has a fixed induction
+ * value.
+ */
 class loop_unroll_count : public ir_hierarchical_visitor {
 public:
-   int nodes;
+   unsigned cost;
+   unsigned folded;
    bool unsupported_variable_indexing;
    bool array_indexed_by_induction_var_with_exact_iterations;
-   /* If there are nested loops, the node count will be inaccurate. */
+   /* If there are nested loops, the cost will be inaccurate. */
    bool nested_loop;
 
    loop_unroll_count(exec_list *list, loop_variable_state *ls,
                      const struct gl_shader_compiler_options *options)
       : ls(ls), options(options)
    {
-      nodes = 0;
+      cost = 0;
+      folded = 0;
+      folded_root = NULL;
       nested_loop = false;
       unsupported_variable_indexing = false;
       array_indexed_by_induction_var_with_exact_iterations = false;
@@ -75,15 +95,94 @@ public:
       run(list);
    }
 
-   virtual ir_visitor_status visit_enter(ir_assignment *)
+   virtual ir_visitor_status visit_enter(ir_assignment *ir)
+   {
+      /* OpStore, plus an OpVectorShuffle to merge a partial write. */
+      unsigned words = 3;
+      if (ir->lhs->type->is_vector() &&
+          ir->write_mask != (1u << ir->lhs->type->vector_elements) - 1)
+         words += 5 + ir->lhs->type->vector_elements;
+
+      ir_variable *var = ir->lhs->variable_referenced();
+      loop_variable *lv = var != NULL ? ls->get(var) : NULL;
+      if (lv != NULL && lv->is_induction_var())
+         return begin_folded(ir, words);
+
+      add(words);
+      return visit_continue;
+   }
+
+   virtual ir_visitor_status visit_leave(ir_assignment *ir)
+   {
+      end_folded(ir);
+      return visit_continue;
+   }
+
+   virtual ir_visitor_status visit_enter(ir_expression *ir)
+   {
+      /* Opcode, result type and result id, plus one word per operand. */
+      const unsigned words = 3 + ir->num_operands;
+
+      if (folded_root == NULL && is_induction_constant(ir))
+         return begin_folded(ir, words);
+
+      add(words);
+      return visit_continue;
+   }
+
+   virtual ir_visitor_status visit_leave(ir_expression *ir)
+   {
+      end_folded(ir);
+      return visit_continue;
+   }
+
+   virtual ir_visitor_status visit_enter(ir_swizzle *ir)
+   {
+      /* OpCompositeExtract or OpVectorShuffle */
+      add(ir->type->is_scalar() ? 5 : 5 + ir->type->vector_elements);
+      return visit_continue;
+   }
+
+   virtual ir_visitor_status visit_enter(ir_texture *ir)
+   {
+      add(7 + (ir->offset != NULL ? 2 : 0));
+      return visit_continue;
+   }
+
+   virtual ir_visitor_status visit_enter(ir_call *ir)
+   {
+      add(4 + ir->actual_parameters.length());
+      return visit_continue;
+   }
+
+   virtual ir_visitor_status visit(ir_dereference_variable *ir)
    {
-      nodes++;
+      /* OpLoad, which becomes a constant once the body is unrolled when
+       * it reads the induction variable.
+       */
+      loop_variable *lv = ls->get(ir->var);
+      add(4);
+      if (folded_root == NULL && lv != NULL && lv->is_induction_var())
+         folded += 4;
+
       return visit_continue;
    }
 
-   virtual ir_visitor_status visit_enter(ir_expression *)
+   virtual ir_visitor_status visit_enter(ir_if *ir)
    {
-      nodes++;
+      /* OpSelectionMerge, OpBranchConditional, two labels and branches. */
+      const unsigned words = 3 + 4 + 2 * 2 + 2 * 2;
+
+      if (ls->limiting_terminator != NULL && ir == ls->limiting_terminator->ir)
+         return begin_folded(ir, words);
+
+      add(words);
+      return visit_continue;
+   }
+
+   virtual ir_visitor_status visit_leave(ir_if *ir)
+   {
+      end_folded(ir);
       return visit_continue;
    }
 
@@ -159,8 +258,62 @@ public:
    }
 
 private:
+   void add(unsigned words)
+   {
+      cost += words;
+      if (folded_root != NULL)
+         folded += words;
+   }
+
+   ir_visitor_status begin_folded(ir_instruction *ir, unsigned words)
+   {
+      if (folded_root == NULL)
+         folded_root = ir;
+      add(words);
+      return visit_continue;
+   }
+
+   void end_folded(ir_instruction *ir)
+   {
+      if (folded_root == ir)
+         folded_root = NULL;
+   }
+
+   /**
+    * Whether \p ir only reads constants and induction variables, so that it
+    * becomes a constant in each unrolled copy of the body.
+    */
+   bool is_induction_constant(ir_rvalue *ir)
+   {
+      if (ir->as_constant())
+         return true;
+
+      ir_dereference_variable *deref = ir->as_dereference_variable();
+      if (deref != NULL) {
+         loop_variable *lv = ls->get(deref->var);
+         return lv != NULL && lv->is_induction_var();
+      }
+
+      ir_swizzle *swiz = ir->as_swizzle();
+      if (swiz != NULL)
+         return is_induction_constant(swiz->val);
+
+      ir_expression *expr = ir->as_expression();
+      if (expr != NULL) {
+         for (unsigned i = 0; i < expr->num_operands; i++) {
+            if (!is_induction_constant(expr->operands[i]))
+               return false;
+         }
+         return true;
+      }
+
+      return false;
+   }
+
    loop_variable_state *ls;
    const struct gl_shader_compiler_options *options;
+   /** Outermost instruction being counted into \c folded, if any. */
+   ir_instruction *folded_root;
 };
 
 
@@ -472,15 +625,28 @@ loop_unroll_visitor::visit_leave(ir_loop *ir)
    if (iterations > max_iterations)
       return visit_continue;
 
-   /* Don't try to unroll nested loops and loops with a huge body.
+   /* Don't try to unroll nested loops, or loops whose unrolled body would
+    * exceed the size budget.  A loop that gets smaller by unrolling, since
+    * most of its body folds away, is always unrolled.
     */
    loop_unroll_count count(&ir->body_instructions, ls, options);
 
+   const unsigned rolled_size = count.cost + loop_overhead_words;
+   const unsigned unrolled_size = (count.cost - count.folded) * iterations;
+
    bool loop_too_large =
-      count.nested_loop || count.nodes * iterations > max_iterations * 5;
+      count.nested_loop || (unrolled_size > options->MaxUnrollBudget &&
+                            unrolled_size > rolled_size);
+
+   /* Loops walking an array of exactly their trip count are still worth
+    * unrolling above the budget, but not at any cost to compile time.
+    */
+   bool exact_array_walk =
+      count.array_indexed_by_induction_var_with_exact_iterations &&
+      unrolled_size <= options->MaxUnrollBudget * 4;
 
    if (loop_too_large && !count.unsupported_variable_indexing &&
-       !count.array_indexed_by_induction_var_with_exact_iterations)
+       !exact_array_walk)
       return visit_continue;
 
    /* Note: the limiting terminator contributes 1 to ls->num_loop_jumps.
@@ -21,6 +21,8 @@
  * DEALINGS IN THE SOFTWARE.
  */
 
+#include <errno.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <getopt.h>
@@ -48,9 +50,22 @@ const struct option compiler_opts[] = {
    { "dump-spirv", no_argument, &options.dump_spirv, 1 },
    { "dump-spirv-validation", no_argument, &options.dump_spirv_validation, 1 },
    { "dump-spirv-glsl", no_argument, &options.dump_spirv_glsl, 1 },
+   { "dump-uniform-layout", no_argument, &options.dump_uniform_layout, 1 },
    { "link",     no_argument, &options.do_link,  1 },
    { "just-log", no_argument, &options.just_log, 1 },
+   { "mem-stats", no_argument, &options.mem_stats, 1 },
    { "version",  required_argument, NULL, 'v' },
+   { "unroll-budget", required_argument, NULL, 'u' },
+   { "bench",    required_argument, NULL, 'b' },
+   { "threads",  required_argument, NULL, 't' },
+   { "stream-hir", no_argument, &options.stream_hir, 1 },
+   { "parallel-link", no_argument, &options.parallel_link, 1 },
+   { "ir-cache", required_argument, NULL, 'c' },
+   { "push-constants", optional_argument, NULL, 'p' },
+   { "pack-varyings", no_argument, &options.pack_varyings, 1 },
+   { "reflect", required_argument, NULL, 'r' },
+   { "reflect-binary", required_argument, NULL, 'R' },
+   { "relink", required_argument, NULL, 'l' },
    { NULL, 0, NULL, 0 }
 };
 
@@ -70,16 +85,37 @@ usage_fail(const char *name)
       printf("    --%s", o->name);
       if (o->has_arg == required_argument)
          printf(" (mandatory)");
+      else if (o->has_arg == optional_argument)
+         printf("[=value]");
       printf("\n");
    }
    exit(EXIT_FAILURE);
 }
 
+/**
+ * \brief Parse a count that can't be negative, or return -1.
+ */
+static int
+parse_count(const char *arg)
+{
+   char *end;
+   errno = 0;
+   long value = strtol(arg, &end, 10);
+   if (end == arg || *end != '\0' || errno != 0 || value < 0 ||
+       value > INT_MAX)
+      return -1;
+
+   return (int) value;
+}
+
 int
 main(int argc, char * const* argv)
 {
    int status = EXIT_SUCCESS;
 
+   /* Unless it is given, the budget is the driver's. */
+   options.unroll_budget = -1;
+
    int c;
    int idx = 0;
    while ((c = getopt_long(argc, argv, "", compiler_opts, &idx)) != -1) {
@@ -87,6 +123,35 @@ main(int argc, char * const* argv)
       case 'v':
          options.glsl_version = strtol(optarg, NULL, 10);
          break;
+      case 'u':
+         options.unroll_budget = parse_count(optarg);
+         if (options.unroll_budget < 0) {
+            fprintf(stderr, "Invalid unroll budget `%s'\n", optarg);
+            usage_fail(argv[0]);
+         }
+         break;
+      case 'b':
+         options.bench = strtol(optarg, NULL, 10);
+         break;
+      case 't':
+         options.threads = strtol(optarg, NULL, 10);
+         break;
+      case 'c':
+         options.ir_cache = optarg;
+         break;
+      case 'p':
+         options.push_constants = optarg ? strtol(optarg, NULL, 10) : 128;
+         break;
+      case 'r':
+         options.reflect = optarg;
+         break;
+      case 'R':
+         options.reflect_binary = optarg;
+         break;
+      case 'l':
+         options.relink = optarg;
+         options.do_link = 1;
+         break;
       default:
          break;
       }
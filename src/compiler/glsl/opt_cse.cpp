@@ -0,0 +1,868 @@
+/*
+ * Copyright © 2013 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file opt_cse.cpp
+ *
+ * Common subexpression elimination at the GLSL IR level.
+ *
+ * Every candidate expression or texture lookup is value numbered by a
+ * structural hash of its tree, and an exact match is confirmed with
+ * ir_instruction::equals().  When an expression is seen a second time, the
+ * first occurrence is moved into a temporary and both sites are replaced by
+ * a dereference of that temporary.
+ *
+ * Available expressions are killed when one of the variables they read is
+ * assigned.  Because GLSL IR is structured, the expressions available before
+ * an if-statement or a loop dominate its bodies, so they are kept available
+ * inside them unless the construct writes one of their variables.
+ * Expressions found inside a nested block are forgotten when that block is
+ * left.
+ */
+
+#include "ir.h"
+#include "ir_visitor.h"
+#include "ir_rvalue_visitor.h"
+#include "ir_optimization.h"
+#include "compiler/glsl_types.h"
+#include "util/hash_table.h"
+#include "util/set.h"
+#include "util/fnv1a.h"
+
+static bool debug = false;
+
+namespace {
+
+class ae_entry;
+
+/**
+ * Link from a variable or a value number to an available expression.
+ */
+class ae_link : public exec_node
+{
+public:
+   /* override operator new from exec_node */
+   DECLARE_LINEAR_ZALLOC_CXX_OPERATORS(ae_link)
+
+   ae_link(ae_entry *entry = NULL)
+      : entry(entry)
+   {
+   }
+
+   ae_entry *entry;
+};
+
+/**
+ * This is the record of an available expression for common subexpression
+ * elimination.
+ */
+class ae_entry : public exec_node
+{
+public:
+   /* override operator new from exec_node */
+   DECLARE_LINEAR_ZALLOC_CXX_OPERATORS(ae_entry)
+
+   ae_entry(ir_instruction *base_ir, ir_rvalue **val, unsigned depth)
+      : val(val), base_ir(base_ir), var(NULL), depth(depth)
+   {
+      assert(val);
+      assert(*val);
+      assert(base_ir);
+
+      link.entry = this;
+   }
+
+   /**
+    * The pointer to the expression that we might be able to reuse
+    *
+    * Note the double pointer -- this is the place in the base_ir expression
+    * tree that we would rewrite to move the expression out to a new variable
+    * assignment.
+    */
+   ir_rvalue **val;
+
+   /**
+    * Root instruction in the basic block where the expression appeared.
+    *
+    * This is used so that we can insert the new variable declaration into the
+    * instruction stream (since *val is just somewhere in base_ir's expression
+    * tree).
+    */
+   ir_instruction *base_ir;
+
+   /**
+    * The variable that the expression has been stored in, if it's been CSEd
+    * once already.
+    */
+   ir_variable *var;
+
+   /** Block nesting depth at which the expression was found. */
+   unsigned depth;
+
+   /** Node in the ae_bucket of the expression's value number */
+   ae_link link;
+};
+
+/**
+ * All the available expressions that share a value number.
+ */
+class ae_bucket
+{
+public:
+   DECLARE_LINEAR_ZALLOC_CXX_OPERATORS(ae_bucket)
+
+   ae_bucket(uint32_t hash)
+      : hash(hash)
+   {
+   }
+
+   uint32_t hash;
+   exec_list entries;
+};
+
+class cse_visitor : public ir_rvalue_visitor {
+public:
+   cse_visitor(exec_list *validate_instructions)
+      : validate_instructions(validate_instructions)
+   {
+      progress = false;
+      depth = 0;
+      mem_ctx = ralloc_context(NULL);
+      lin_ctx = linear_alloc_parent(mem_ctx, 0);
+      values = _mesa_hash_table_create(mem_ctx, value_number_hash,
+                                       _mesa_key_u32_equal);
+      uses = _mesa_pointer_hash_table_create(mem_ctx);
+   }
+
+   ~cse_visitor()
+   {
+      ralloc_free(mem_ctx);
+   }
+
+   virtual ir_visitor_status visit_enter(ir_function_signature *ir);
+   virtual ir_visitor_status visit_enter(ir_loop *ir);
+   virtual ir_visitor_status visit_enter(ir_if *ir);
+   virtual ir_visitor_status visit_enter(ir_call *ir);
+   virtual ir_visitor_status visit_leave(ir_assignment *ir);
+   virtual void handle_rvalue(ir_rvalue **rvalue);
+
+   bool progress;
+
+private:
+   /** The keys of \c values are already hashes. */
+   static uint32_t value_number_hash(const void *key)
+   {
+      return *(const uint32_t *) key;
+   }
+
+   ir_rvalue *try_cse(ir_rvalue *rvalue, uint32_t hash);
+   void add_to_ae(ir_rvalue **rvalue, uint32_t hash);
+   void add_use(ir_variable *var, ae_entry *entry);
+
+   /** Find the available expression equal to \c rvalue, if any. */
+   ae_entry *find_value(ir_rvalue *rvalue, uint32_t hash);
+
+   /** File \c entry under the value number \c hash. */
+   void insert_value(ae_entry *entry, uint32_t hash);
+
+   /** Recompute the value number of an entry whose tree was rewritten. */
+   void rehash(ae_entry *entry);
+
+   /** Forget an available expression. */
+   void kill_entry(ae_entry *entry);
+
+   /** Forget every available expression that reads \c var. */
+   void kill_variable(ir_variable *var);
+
+   /** Forget every available expression. */
+   void kill_all();
+
+   /** Forget the available expressions found deeper than \c depth. */
+   void leave_block();
+
+   /** Kill everything that \c body may invalidate before visiting it. */
+   void enter_block(exec_list *body, exec_list *other_body);
+
+   void *mem_ctx;
+   void *lin_ctx;
+
+   /** List of ae_entry: The available expressions, in program order */
+   exec_list ae;
+
+   /** Map from value number to ae_bucket */
+   struct hash_table *values;
+
+   /** Map from ir_variable to a list of ae_link */
+   struct hash_table *uses;
+
+   /** Current block nesting depth */
+   unsigned depth;
+
+   /**
+    * The whole shader, so that we can validate_ir_tree in debug mode.
+    *
+    * This proved quite useful when trying to get the tree manipulation
+    * right.
+    */
+   exec_list *validate_instructions;
+};
+
+/**
+ * Visitor to walk an expression tree to check that all variables referenced
+ * can be reused between two points of the same invocation.
+ */
+class is_cse_candidate_visitor : public ir_hierarchical_visitor
+{
+public:
+
+   is_cse_candidate_visitor()
+      : ok(true)
+   {
+   }
+
+   virtual ir_visitor_status visit(ir_dereference_variable *ir);
+
+   bool ok;
+};
+
+/**
+ * Visitor to collect the variables an instruction list may write.
+ */
+class cse_kill_visitor : public ir_hierarchical_visitor
+{
+public:
+
+   cse_kill_visitor(struct set *vars)
+      : vars(vars), has_call(false)
+   {
+   }
+
+   virtual ir_visitor_status visit_enter(ir_assignment *ir);
+   virtual ir_visitor_status visit_enter(ir_call *ir);
+
+   struct set *vars;
+   bool has_call;
+};
+
+/**
+ * Visitor to collect the variables read by an expression tree.
+ */
+class cse_use_visitor : public ir_hierarchical_visitor
+{
+public:
+
+   cse_use_visitor(struct set *vars)
+      : vars(vars)
+   {
+   }
+
+   virtual ir_visitor_status visit(ir_dereference_variable *ir);
+
+   struct set *vars;
+};
+
+class contains_rvalue_visitor : public ir_rvalue_visitor
+{
+public:
+
+   contains_rvalue_visitor(ir_rvalue *val)
+      : val(val)
+   {
+      found = false;
+   }
+
+   virtual void handle_rvalue(ir_rvalue **rvalue);
+
+   bool found;
+
+private:
+   ir_rvalue *val;
+};
+
+} /* unnamed namespace */
+
+static void
+dump_ae(exec_list *ae)
+{
+   int i = 0;
+
+   printf("CSE: AE contents:\n");
+   foreach_in_list(ae_entry, entry, ae) {
+      printf("CSE:   AE %2d (%p): ", i, entry);
+      (*entry->val)->print();
+      printf("\n");
+
+      if (entry->var)
+         printf("CSE:     in var %p:\n", entry->var);
+
+      i++;
+   }
+}
+
+static uint32_t hash_rvalue(const ir_rvalue *ir);
+
+static inline uint32_t
+accumulate_rvalue(uint32_t hash, const ir_rvalue *ir)
+{
+   const uint32_t value = hash_rvalue(ir);
+   return _mesa_fnv32_1a_accumulate(hash, value);
+}
+
+/**
+ * Compute the value number of an rvalue tree.
+ *
+ * Trees for which ir_instruction::equals() returns true get the same hash,
+ * except for double constants that differ only in the sign of zero, which
+ * merely costs a missed match.  Nodes that equals() doesn't know about hash
+ * to a value of their own, so they never compare equal anyway.
+ */
+static uint32_t
+hash_rvalue(const ir_rvalue *ir)
+{
+   uint32_t hash = _mesa_fnv32_1a_offset_bias;
+
+   if (ir == NULL)
+      return hash;
+
+   hash = _mesa_fnv32_1a_accumulate(hash, ir->ir_type);
+   hash = _mesa_fnv32_1a_accumulate(hash, ir->type);
+
+   switch (ir->ir_type) {
+   case ir_type_constant: {
+      const ir_constant *c = (const ir_constant *) ir;
+      for (unsigned i = 0; i < ir->type->components(); i++) {
+         if (ir->type->is_double())
+            hash = _mesa_fnv32_1a_accumulate(hash, c->value.d[i]);
+         else if (ir->type->is_64bit())
+            hash = _mesa_fnv32_1a_accumulate(hash, c->value.u64[i]);
+         else
+            hash = _mesa_fnv32_1a_accumulate(hash, c->value.u[i]);
+      }
+      break;
+   }
+   case ir_type_dereference_variable: {
+      const ir_dereference_variable *deref =
+         (const ir_dereference_variable *) ir;
+      hash = _mesa_fnv32_1a_accumulate(hash, deref->var);
+      break;
+   }
+   case ir_type_dereference_array: {
+      const ir_dereference_array *deref = (const ir_dereference_array *) ir;
+      hash = accumulate_rvalue(hash, deref->array);
+      hash = accumulate_rvalue(hash, deref->array_index);
+      break;
+   }
+   case ir_type_dereference_record: {
+      const ir_dereference_record *deref = (const ir_dereference_record *) ir;
+      hash = accumulate_rvalue(hash, deref->record);
+      hash = _mesa_fnv32_1a_accumulate(hash, deref->field_idx);
+      break;
+   }
+   case ir_type_swizzle: {
+      const ir_swizzle *swiz = (const ir_swizzle *) ir;
+      const unsigned mask = swiz->mask.x | swiz->mask.y << 2 |
+                            swiz->mask.z << 4 | swiz->mask.w << 6;
+      hash = _mesa_fnv32_1a_accumulate(hash, mask);
+      hash = accumulate_rvalue(hash, swiz->val);
+      break;
+   }
+   case ir_type_expression: {
+      const ir_expression *expr = (const ir_expression *) ir;
+      hash = _mesa_fnv32_1a_accumulate(hash, expr->operation);
+      for (unsigned i = 0; i < expr->num_operands; i++)
+         hash = accumulate_rvalue(hash, expr->operands[i]);
+      break;
+   }
+   case ir_type_texture: {
+      const ir_texture *tex = (const ir_texture *) ir;
+      hash = _mesa_fnv32_1a_accumulate(hash, tex->op);
+      hash = accumulate_rvalue(hash, tex->sampler);
+      hash = accumulate_rvalue(hash, tex->coordinate);
+      hash = accumulate_rvalue(hash, tex->projector);
+      hash = accumulate_rvalue(hash, tex->shadow_comparator);
+      hash = accumulate_rvalue(hash, tex->offset);
+      break;
+   }
+   default:
+      hash = _mesa_fnv32_1a_accumulate(hash, ir);
+      break;
+   }
+
+   return hash;
+}
+
+ir_visitor_status
+is_cse_candidate_visitor::visit(ir_dereference_variable *ir)
+{
+   /* Values that another invocation may change behind our back can't be
+    * reused.  Everything else is tracked by killing the available
+    * expressions when the variable is assigned.
+    */
+   switch (ir->var->data.mode) {
+   case ir_var_shader_storage:
+   case ir_var_shader_shared:
+   case ir_var_shader_out:
+      break;
+   default:
+      if (!ir->var->data.memory_volatile)
+         return visit_continue;
+      break;
+   }
+
+   if (debug)
+      printf("CSE: non-candidate: var %s may be shared\n", ir->var->name);
+   ok = false;
+   return visit_stop;
+}
+
+ir_visitor_status
+cse_kill_visitor::visit_enter(ir_assignment *ir)
+{
+   _mesa_set_add(vars, ir->lhs->variable_referenced());
+   return visit_continue_with_parent;
+}
+
+ir_visitor_status
+cse_kill_visitor::visit_enter(ir_call *)
+{
+   has_call = true;
+   return visit_stop;
+}
+
+ir_visitor_status
+cse_use_visitor::visit(ir_dereference_variable *ir)
+{
+   _mesa_set_add(vars, ir->var);
+   return visit_continue;
+}
+
+void
+contains_rvalue_visitor::handle_rvalue(ir_rvalue **rvalue)
+{
+   if (*rvalue == val)
+      found = true;
+}
+
+static bool
+contains_rvalue(ir_rvalue *haystack, ir_rvalue *needle)
+{
+   contains_rvalue_visitor v(needle);
+   haystack->accept(&v);
+   return v.found;
+}
+
+static bool
+is_cse_candidate(ir_rvalue *ir)
+{
+   /* Our temporary variable assignment generation isn't ready to handle
+    * anything bigger than a matrix.
+    */
+   if (!ir->type->is_vector() && !ir->type->is_scalar() &&
+       !ir->type->is_matrix()) {
+      if (debug)
+         printf("CSE: non-candidate: not a vector/scalar/matrix\n");
+      return false;
+   }
+
+   /* Only handle expressions and textures.  Swizzles and dereferences are
+    * free to recompute, so they are only matched as operands.
+    */
+   switch (ir->ir_type) {
+   case ir_type_expression:
+   case ir_type_texture:
+      break;
+   default:
+      if (debug)
+         printf("CSE: non-candidate: not an expression/texture\n");
+      return false;
+   }
+
+   is_cse_candidate_visitor v;
+
+   ir->accept(&v);
+
+   return v.ok;
+}
+
+void
+cse_visitor::add_use(ir_variable *var, ae_entry *entry)
+{
+   struct hash_entry *he = _mesa_hash_table_search(uses, var);
+   exec_list *list;
+
+   if (he) {
+      list = (exec_list *) he->data;
+   } else {
+      list = new(mem_ctx) exec_list;
+      _mesa_hash_table_insert(uses, var, list);
+   }
+
+   list->push_tail(new(lin_ctx) ae_link(entry));
+}
+
+ae_entry *
+cse_visitor::find_value(ir_rvalue *rvalue, uint32_t hash)
+{
+   struct hash_entry *he =
+      _mesa_hash_table_search_pre_hashed(values, hash, &hash);
+   if (!he)
+      return NULL;
+
+   ae_bucket *bucket = (ae_bucket *) he->data;
+   foreach_in_list(ae_link, link, &bucket->entries) {
+      if (debug) {
+         printf("Comparing to AE %p: ", link->entry);
+         (*link->entry->val)->print();
+         printf("\n");
+      }
+
+      if (rvalue->equals(*link->entry->val))
+         return link->entry;
+   }
+
+   return NULL;
+}
+
+void
+cse_visitor::insert_value(ae_entry *entry, uint32_t hash)
+{
+   struct hash_entry *he =
+      _mesa_hash_table_search_pre_hashed(values, hash, &hash);
+   ae_bucket *bucket;
+
+   if (he) {
+      bucket = (ae_bucket *) he->data;
+   } else {
+      bucket = new(lin_ctx) ae_bucket(hash);
+      _mesa_hash_table_insert_pre_hashed(values, hash, &bucket->hash, bucket);
+   }
+
+   bucket->entries.push_tail(&entry->link);
+}
+
+void
+cse_visitor::rehash(ae_entry *entry)
+{
+   const uint32_t hash = hash_rvalue(*entry->val);
+
+   entry->link.remove();
+
+   /* The rewritten tree may now match another available expression, in
+    * which case that one is kept.
+    */
+   if (find_value(*entry->val, hash)) {
+      entry->remove();
+      return;
+   }
+
+   insert_value(entry, hash);
+}
+
+void
+cse_visitor::kill_entry(ae_entry *entry)
+{
+   if (debug) {
+      printf("CSE: Kill: ");
+      (*entry->val)->print();
+      printf("\n");
+   }
+
+   entry->link.remove();
+   entry->remove();
+}
+
+void
+cse_visitor::kill_variable(ir_variable *var)
+{
+   struct hash_entry *he = _mesa_hash_table_search(uses, var);
+   if (!he)
+      return;
+
+   exec_list *list = (exec_list *) he->data;
+   foreach_in_list(ae_link, use, list) {
+      if (use->entry->next)
+         kill_entry(use->entry);
+   }
+   list->make_empty();
+}
+
+void
+cse_visitor::kill_all()
+{
+   foreach_in_list_safe(ae_entry, entry, &ae) {
+      kill_entry(entry);
+   }
+}
+
+void
+cse_visitor::leave_block()
+{
+   while (!ae.is_empty()) {
+      ae_entry *entry = (ae_entry *) ae.get_tail();
+      if (entry->depth <= depth)
+         break;
+      kill_entry(entry);
+   }
+}
+
+void
+cse_visitor::enter_block(exec_list *body, exec_list *other_body)
+{
+   struct set *vars = _mesa_pointer_set_create(NULL);
+   cse_kill_visitor v(vars);
+
+   visit_list_elements(&v, body, false);
+   if (other_body && !v.has_call)
+      visit_list_elements(&v, other_body, false);
+
+   if (v.has_call) {
+      kill_all();
+   } else {
+      set_foreach(vars, entry) {
+         kill_variable((ir_variable *) entry->key);
+      }
+   }
+
+   _mesa_set_destroy(vars, NULL);
+}
+
+/**
+ * Tries to find and return a reference to a previous computation of a given
+ * expression.
+ *
+ * Look up the value number of the rvalue among the available expressions,
+ * and if there is a match, move the previous copy of the expression to a
+ * temporary and return a reference of the temporary.
+ */
+ir_rvalue *
+cse_visitor::try_cse(ir_rvalue *rvalue, uint32_t hash)
+{
+   ae_entry *entry = find_value(rvalue, hash);
+   if (!entry)
+      return NULL;
+
+   if (debug) {
+      printf("CSE: Replacing: ");
+      (*entry->val)->print();
+      printf("\n");
+      printf("CSE:      with: ");
+      rvalue->print();
+      printf("\n");
+   }
+
+   if (!entry->var) {
+      ir_instruction *base_ir = entry->base_ir;
+
+      ir_variable *var = new(rvalue) ir_variable(rvalue->type,
+                                                 "cse",
+                                                 ir_var_temporary);
+
+      /* Write the previous expression result into a new variable. */
+      base_ir->insert_before(var);
+      ir_assignment *assignment =
+         new(rvalue) ir_assignment(new(rvalue) ir_dereference_variable(var),
+                                   *entry->val);
+      base_ir->insert_before(assignment);
+
+      /* Replace the expression in the original tree with a deref of the
+       * variable, but keep tracking the expression for further reuse.
+       */
+      ir_dereference_variable *deref =
+         new(rvalue) ir_dereference_variable(var);
+      *entry->val = deref;
+      entry->val = &assignment->rhs;
+      entry->base_ir = assignment;
+
+      entry->var = var;
+
+      /* Update the AE list.  We have to be careful when doing so, because
+       * if we had an expression like
+       *
+       *     (a + b) + (a + b)
+       *
+       * The ae list would have the entries
+       *
+       *     (a + b) in base_ir1
+       *     (a + b) + (a + b) in base_ir1
+       *
+       * and when moving the (a + b) out, the second entry would need to be
+       * rehashed since it now reads the new variable.  Entries for the
+       * subexpressions of (a + b) would need to have assignment as their
+       * base_ir.
+       */
+      foreach_in_list_safe(ae_entry, other, &ae) {
+         if (other == entry || other->base_ir != base_ir)
+            continue;
+
+         if (contains_rvalue(assignment->rhs, *other->val))
+            other->base_ir = assignment;
+         else if (contains_rvalue(*other->val, deref))
+            rehash(other);
+      }
+
+      if (debug)
+         validate_ir_tree(validate_instructions);
+   }
+
+   return new(rvalue) ir_dereference_variable(entry->var);
+}
+
+/** Add the rvalue to the list of available expressions for CSE. */
+void
+cse_visitor::add_to_ae(ir_rvalue **rvalue, uint32_t hash)
+{
+   if (debug) {
+      printf("CSE: Add to AE: ");
+      (*rvalue)->print();
+      printf("\n");
+   }
+
+   ae_entry *entry = new(lin_ctx) ae_entry(base_ir, rvalue, depth);
+   insert_value(entry, hash);
+   ae.push_tail(entry);
+
+   struct set *vars = _mesa_pointer_set_create(NULL);
+   cse_use_visitor v(vars);
+   (*rvalue)->accept(&v);
+   set_foreach(vars, s) {
+      add_use((ir_variable *) s->key, entry);
+   }
+   _mesa_set_destroy(vars, NULL);
+
+   if (debug)
+      dump_ae(&ae);
+}
+
+void
+cse_visitor::handle_rvalue(ir_rvalue **rvalue)
+{
+   if (!*rvalue || depth == 0)
+      return;
+
+   if (debug) {
+      printf("CSE: handle_rvalue ");
+      (*rvalue)->print();
+      printf("\n");
+   }
+
+   if (!is_cse_candidate(*rvalue))
+      return;
+
+   const uint32_t hash = hash_rvalue(*rvalue);
+   ir_rvalue *new_rvalue = try_cse(*rvalue, hash);
+   if (new_rvalue) {
+      *rvalue = new_rvalue;
+      progress = true;
+
+      if (debug)
+         validate_ir_tree(validate_instructions);
+   } else {
+      add_to_ae(rvalue, hash);
+   }
+}
+
+ir_visitor_status
+cse_visitor::visit_leave(ir_assignment *ir)
+{
+   ir_visitor_status s = ir_rvalue_visitor::visit_leave(ir);
+
+   /* The right-hand side is evaluated before the write happens, so any
+    * expression reading the destination is only killed afterwards.
+    */
+   kill_variable(ir->lhs->variable_referenced());
+
+   return s;
+}
+
+ir_visitor_status
+cse_visitor::visit_enter(ir_if *ir)
+{
+   handle_rvalue(&ir->condition);
+
+   enter_block(&ir->then_instructions, &ir->else_instructions);
+
+   depth++;
+   visit_list_elements(this, &ir->then_instructions);
+   leave_block();
+   visit_list_elements(this, &ir->else_instructions);
+   depth--;
+   leave_block();
+
+   return visit_continue_with_parent;
+}
+
+ir_visitor_status
+cse_visitor::visit_enter(ir_function_signature *ir)
+{
+   kill_all();
+
+   depth++;
+   visit_list_elements(this, &ir->body);
+   depth--;
+
+   kill_all();
+   return visit_continue_with_parent;
+}
+
+ir_visitor_status
+cse_visitor::visit_enter(ir_loop *ir)
+{
+   /* Anything written in the body also changes on the next iteration. */
+   enter_block(&ir->body_instructions, NULL);
+
+   depth++;
+   visit_list_elements(this, &ir->body_instructions);
+   depth--;
+   leave_block();
+
+   return visit_continue_with_parent;
+}
+
+ir_visitor_status
+cse_visitor::visit_enter(ir_call *)
+{
+   /* Because call is an exec_list of ir_rvalues, handle_rvalue gets passed a
+    * pointer to the (ir_rvalue *) on the stack.  Since we save those pointers
+    * in the AE list, we can't let handle_rvalue get called.
+    *
+    * The callee may also write its out parameters, globals or memory shared
+    * with other invocations (barriers, atomics, image stores), so nothing
+    * stays available across it.
+    */
+   kill_all();
+   return visit_continue_with_parent;
+}
+
+/**
+ * Does a common subexpression elimination pass on the code present in the
+ * instruction stream.
+ */
+bool
+do_cse(exec_list *instructions)
+{
+   cse_visitor v(instructions);
+
+   visit_list_elements(&v, instructions);
+
+   return v.progress;
+}
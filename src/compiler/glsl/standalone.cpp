@@ -21,6 +21,7 @@
  * DEALINGS IN THE SOFTWARE.
  */
 #include <getopt.h>
+#include <chrono>
 
 /** @file standalone.cpp
  *
@@ -39,6 +40,7 @@
 #include "string_to_uint_map.h"
 #include "util/set.h"
 #include "linker.h"
+#include "link_cache.h"
 #include "glsl_parser_extras.h"
 #include "ir_builder_print_visitor.h"
 #include "builtin_functions.h"
@@ -47,6 +49,14 @@
 #include "program/program.h"
 #include "ir_print_glsl_visitor.h"
 #include "ir_print_spirv_visitor.h"
+#include "program_reflection.h"
+#include "util/os_file.h"
+#include "util/u_atomic.h"
+#include "util/blob.h"
+#include "ir_serialize.h"
+
+#define XXH_INLINE_ALL
+#include "util/xxhash.h"
 
 class dead_variable_visitor : public ir_hierarchical_visitor {
 public:
@@ -167,6 +177,25 @@ initialize_context(struct gl_context *ctx, gl_api api)
    ctx->Const.Program[MESA_SHADER_COMPUTE].MaxImageUniforms = 8;
    ctx->Const.Program[MESA_SHADER_COMPUTE].MaxUniformBlocks = 12;
 
+   /* A budget of 0 turns unrolling off altogether. */
+   if (options->unroll_budget >= 0) {
+      for (int sh = 0; sh < MESA_SHADER_STAGES; ++sh) {
+         ctx->Const.ShaderCompilerOptions[sh].MaxUnrollBudget = options->unroll_budget;
+         if (options->unroll_budget == 0)
+            ctx->Const.ShaderCompilerOptions[sh].MaxUnrollIterations = 0;
+      }
+   }
+
+   ctx->Const.GLSLStreamHIR = options->stream_hir;
+
+   ctx->Const.GLSLParallelLink = options->parallel_link;
+
+   /* Varyings that the linker packs together then keep their own variables
+    * and are told apart by component, rather than being lowered to vec4s.
+    */
+   if (options->pack_varyings)
+      ctx->Extensions.ARB_enhanced_layouts = true;
+
    switch (ctx->Const.GLSLVersion) {
    case 100:
       ctx->Const.MaxClipPlanes = 0;
@@ -276,6 +305,7 @@ initialize_context(struct gl_context *ctx, gl_api api)
       ctx->Const.MaxShaderStorageBlockSize = 4096;
       ctx->Const.MaxAtomicBufferBindings = 4;
       ctx->Const.MaxImageUnits = 8;
+      ctx->Const.MaxCombinedShaderOutputResources = 8;
 
       ctx->Const.Program[MESA_SHADER_VERTEX].MaxAttribs = 16;
       ctx->Const.Program[MESA_SHADER_VERTEX].MaxTextureImageUnits = 16;
@@ -298,8 +328,39 @@ initialize_context(struct gl_context *ctx, gl_api api)
          ctx->Const.Program[MESA_SHADER_GEOMETRY].MaxOutputComponents;
       ctx->Const.Program[MESA_SHADER_FRAGMENT].MaxOutputComponents = 0; /* not used */
 
+      /* Tessellation shaders are core from GLSL 4.00 on. */
+      if (ctx->Const.GLSLVersion >= 400) {
+         ctx->Const.MaxTessGenLevel = 64;
+         ctx->Const.MaxTessPatchComponents = 120;
+         ctx->Const.MaxTessControlTotalOutputComponents = 4096;
+
+         for (int sh = MESA_SHADER_TESS_CTRL; sh <= MESA_SHADER_TESS_EVAL; sh++) {
+            ctx->Const.Program[sh].MaxTextureImageUnits = 16;
+            ctx->Const.Program[sh].MaxUniformComponents = 1024;
+            ctx->Const.Program[sh].MaxCombinedUniformComponents = 1024;
+            ctx->Const.Program[sh].MaxInputComponents = 128;
+            ctx->Const.Program[sh].MaxOutputComponents = 128;
+         }
+      }
+
+      /* Uniform blocks, with the limits that Mesa's drivers report. */
+      ctx->Const.MaxUniformBlockSize = 65536;
+      for (int sh = 0; sh < MESA_SHADER_COMPUTE; sh++) {
+         if (ctx->Const.Program[sh].MaxUniformComponents == 0)
+            continue;
+
+         ctx->Const.Program[sh].MaxUniformBlocks = 14;
+         ctx->Const.Program[sh].MaxCombinedUniformComponents +=
+            ctx->Const.Program[sh].MaxUniformBlocks *
+            ctx->Const.MaxUniformBlockSize / 4;
+         ctx->Const.MaxCombinedUniformBlocks +=
+            ctx->Const.Program[sh].MaxUniformBlocks;
+      }
+
       ctx->Const.MaxCombinedTextureImageUnits =
          ctx->Const.Program[MESA_SHADER_VERTEX].MaxTextureImageUnits
+         + ctx->Const.Program[MESA_SHADER_TESS_CTRL].MaxTextureImageUnits
+         + ctx->Const.Program[MESA_SHADER_TESS_EVAL].MaxTextureImageUnits
          + ctx->Const.Program[MESA_SHADER_GEOMETRY].MaxTextureImageUnits
          + ctx->Const.Program[MESA_SHADER_FRAGMENT].MaxTextureImageUnits;
 
@@ -348,10 +409,33 @@ initialize_context(struct gl_context *ctx, gl_api api)
    ctx->Driver.NewProgram = new_program;
 }
 
-/* Returned string will have 'ctx' as its ralloc owner. */
-static char *
+struct mapped_text_file {
+   const char *data;
+   size_t size;
+};
+
+static void
+unmap_text_file(void *ptr)
+{
+   struct mapped_text_file *file = (struct mapped_text_file *) ptr;
+   os_unmap_file(file->data, file->size);
+}
+
+/* Returned string will live as long as 'ctx'.  Where possible, it is the
+ * file's mapped pages themselves, handed to the preprocessor without being
+ * copied.
+ */
+static const char *
 load_text_file(void *ctx, const char *file_name)
 {
+   struct mapped_text_file *file = ralloc(ctx, struct mapped_text_file);
+   file->data = os_map_text_file(file_name, &file->size);
+   if (file->data != NULL) {
+      ralloc_set_destructor(file, unmap_text_file);
+      return file->data;
+   }
+   ralloc_free(file);
+
    char *text = NULL;
    size_t size;
    size_t total_read = 0;
@@ -371,7 +455,7 @@ load_text_file(void *ctx, const char *file_name)
          size_t bytes = fread(text + total_read,
                1, size - total_read, fp);
          if (bytes < size - total_read) {
-            free(text);
+            ralloc_free(text);
             text = NULL;
             goto error;
          }
@@ -392,6 +476,380 @@ load_text_file(void *ctx, const char *file_name)
    return text;
 }
 
+/**
+ * Shader type named by the extension of \c file_name, or 0.
+ */
+static GLenum
+shader_type(const char *file_name)
+{
+   const unsigned len = strlen(file_name);
+   if (len < 6)
+      return 0;
+
+   const char *const ext = & file_name[len - 5];
+   /* TODO add support to read a .shader_test */
+   if (strncmp(".vert", ext, 5) == 0 || strncmp(".glsl", ext, 5) == 0)
+      return GL_VERTEX_SHADER;
+   else if (strncmp(".tesc", ext, 5) == 0)
+      return GL_TESS_CONTROL_SHADER;
+   else if (strncmp(".tese", ext, 5) == 0)
+      return GL_TESS_EVALUATION_SHADER;
+   else if (strncmp(".geom", ext, 5) == 0)
+      return GL_GEOMETRY_SHADER;
+   else if (strncmp(".frag", ext, 5) == 0)
+      return GL_FRAGMENT_SHADER;
+   else if (strncmp(".comp", ext, 5) == 0)
+      return GL_COMPUTE_SHADER;
+   else
+      return 0;
+}
+
+struct bench_thread {
+   struct gl_context *ctx;
+   const struct gl_shader *shader;
+   int count;
+   int mismatches;
+};
+
+static int
+bench_thread_main(void *data)
+{
+   struct bench_thread *bench = (struct bench_thread *) data;
+
+   for (int i = 0; i < bench->count; i++) {
+      struct gl_shader *copy = rzalloc(NULL, struct gl_shader);
+      copy->Type = bench->shader->Type;
+      copy->Stage = bench->shader->Stage;
+      copy->Source = bench->shader->Source;
+
+      struct _mesa_glsl_parse_state *state =
+         _mesa_glsl_compile_shader(bench->ctx, copy, false, false, true);
+      if (copy->CompileStatus != bench->shader->CompileStatus)
+         bench->mismatches++;
+
+      ralloc_free(state);
+      ralloc_free(copy);
+   }
+
+   return 0;
+}
+
+/**
+ * Compile the source of \c shader \c count more times on each of
+ * \c num_threads threads, each time into a fresh gl_shader, and print the
+ * average time taken per compile.
+ *
+ * With more than one thread, this doubles as a stress test of the state
+ * that compiles share, such as the glsl_type tables: every compile has to
+ * come out the same as \c shader did.
+ */
+static bool
+bench_compile_shader(struct gl_context *ctx, const struct gl_shader *shader,
+                     const char *name, int count, int num_threads)
+{
+   struct bench_thread *bench = rzalloc_array(NULL, struct bench_thread,
+                                              num_threads);
+   thrd_t *threads = ralloc_array(bench, thrd_t, num_threads);
+
+   for (int i = 0; i < num_threads; i++) {
+      bench[i].ctx = ctx;
+      bench[i].shader = shader;
+      bench[i].count = count;
+   }
+
+   const auto start = std::chrono::steady_clock::now();
+
+   if (num_threads == 1) {
+      bench_thread_main(&bench[0]);
+   } else {
+      for (int i = 0; i < num_threads; i++)
+         thrd_create(&threads[i], bench_thread_main, &bench[i]);
+      for (int i = 0; i < num_threads; i++)
+         thrd_join(threads[i], NULL);
+   }
+
+   const std::chrono::duration<double, std::micro> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+   int mismatches = 0;
+   for (int i = 0; i < num_threads; i++)
+      mismatches += bench[i].mismatches;
+   ralloc_free(bench);
+
+   if (num_threads == 1) {
+      printf("%s: %d compiles, %.1f us per compile\n", name, count,
+             elapsed.count() / count);
+   } else {
+      printf("%s: %d compiles on %d threads, %.1f us per compile\n", name,
+             count * num_threads, num_threads,
+             elapsed.count() / (count * num_threads));
+   }
+
+   if (mismatches != 0) {
+      printf("%s: %d compiles came out differently\n", name, mismatches);
+      return false;
+   }
+
+   return true;
+}
+
+static bool
+dump_spirv()
+{
+   return options->dump_spirv || options->dump_spirv_validation ||
+          options->dump_spirv_glsl || options->dump_uniform_layout ||
+          options->push_constants || options->reflect ||
+          options->reflect_binary;
+}
+
+/**
+ * Whether a dump is asked for that is printed while compiling a shader on
+ * its own, which --ir-cache can't print from the IR that it reads back.
+ */
+static bool
+dump_compile()
+{
+   return options->dump_ast || options->dump_hir || options->dump_glsl ||
+          (!options->do_link && dump_spirv());
+}
+
+static void
+run_spirv_tool(const char *tool, const char *file_name)
+{
+   char *command = ralloc_asprintf(NULL, "%s %s", tool, file_name);
+   system(command);
+   ralloc_free(command);
+}
+
+static void
+write_uniform_list(FILE *f, spirv_buffer *buffer, bool push_constant)
+{
+   bool first = true;
+   for (unsigned i = 0; i < buffer->uniform_count; i++) {
+      const spirv_uniform *uniform = &buffer->uniform_layout[i];
+      if (uniform->push_constant != push_constant)
+         continue;
+
+      fprintf(f, "%s\n    { \"name\": \"%s\", \"type\": \"%s\", "
+              "\"offset\": %u, \"size\": %u }",
+              first ? "" : ",", uniform->name, uniform->type->name,
+              uniform->offset, uniform->size);
+      first = false;
+   }
+   fprintf(f, "%s]", first ? "" : "\n  ");
+}
+
+/**
+ * Write the members of the block of default-block uniforms in \c buffer, and
+ * of its push constants, to \c file_name as JSON, so that the application
+ * can find every uniform in what it uploads.  Uniforms that the shader never
+ * reads are in neither.
+ */
+static void
+write_uniform_layout(spirv_buffer *buffer, const char *file_name)
+{
+   FILE* f = fopen(file_name, "w");
+   if (!f)
+      return;
+
+   fprintf(f, "{\n");
+   fprintf(f, "  \"size\": %u,\n", buffer->uniform_offset);
+   fprintf(f, "  \"uniforms\": [");
+   write_uniform_list(f, buffer, false);
+   fprintf(f, ",\n");
+   fprintf(f, "  \"push_constant_end\": %u,\n", buffer->push_constant_offset);
+   fprintf(f, "  \"push_constants\": [");
+   write_uniform_list(f, buffer, true);
+   fprintf(f, "\n");
+   fprintf(f, "}\n");
+   fclose(f);
+}
+
+/**
+ * Print how the uniforms of \c buffer were split between the push constants
+ * and the uniform buffer.
+ */
+static void
+print_push_constants(spirv_buffer *buffer, const char *file_name)
+{
+   unsigned pushed = 0;
+   for (unsigned i = 0; i < buffer->uniform_count; i++)
+      pushed += buffer->uniform_layout[i].push_constant;
+
+   printf("%s: %u uniforms in push constants up to byte %u, "
+          "%u uniforms in %u bytes of uniform buffer\n",
+          file_name, pushed, buffer->push_constant_offset,
+          buffer->uniform_count - pushed, buffer->uniform_offset);
+}
+
+/**
+ * Write the module in \c buffer to \c file_name, and hand the file to the
+ * SPIR-V tools that were asked for.
+ */
+static void
+write_spirv(spirv_buffer *buffer, const char *file_name)
+{
+   FILE* f = fopen(file_name, "wb");
+   if (f) {
+      fwrite(buffer->data(), sizeof(int), buffer->count(), f);
+      fclose(f);
+   }
+
+   if (options->dump_uniform_layout) {
+      const char *ext = strrchr(file_name, '.');
+      char *layout_name = ralloc_asprintf(NULL, "%.*s.layout.json",
+                                          (int) (ext - file_name), file_name);
+      write_uniform_layout(buffer, layout_name);
+      ralloc_free(layout_name);
+   }
+
+   if (options->push_constants) {
+      print_push_constants(buffer, file_name);
+   }
+
+   if (options->dump_spirv) {
+      run_spirv_tool("spirv-dis.exe", file_name);
+   }
+   if (options->dump_spirv_validation) {
+      run_spirv_tool("spirv-val.exe", file_name);
+   }
+   if (options->dump_spirv_glsl) {
+      run_spirv_tool("spirv-cross.exe", file_name);
+   }
+}
+
+/**
+ * Number of generic varying slots that the \c mode variables of \c shader
+ * use as they are, and that they would use if each had slots of its own,
+ * which is what they had before the linker packed them.
+ */
+static void
+count_varying_slots(struct gl_linked_shader *shader, ir_variable_mode mode,
+                    unsigned *packed, unsigned *unpacked)
+{
+   const bool arrayed =
+      (mode == ir_var_shader_in && shader->Stage != MESA_SHADER_VERTEX &&
+       shader->Stage != MESA_SHADER_FRAGMENT) ||
+      (mode == ir_var_shader_out && shader->Stage == MESA_SHADER_TESS_CTRL);
+   uint64_t used = 0;
+
+   *unpacked = 0;
+
+   foreach_in_list(ir_instruction, node, shader->ir) {
+      ir_variable *var = node->as_variable();
+      if (var == NULL || var->data.mode != mode ||
+          var->data.location < VARYING_SLOT_VAR0 || var->data.patch)
+         continue;
+
+      const glsl_type *type = arrayed ? var->type->fields.array : var->type;
+      unsigned slots = type->count_attribute_slots(false);
+      unsigned slot = var->data.location - VARYING_SLOT_VAR0;
+
+      used |= BITFIELD64_RANGE(slot, MIN2(slots, 64 - slot));
+      if (strncmp(var->name, "packed:", 7) != 0)
+         *unpacked += slots;
+   }
+
+   /* The varyings that lower_packed_varyings() replaced by the packed ones. */
+   if (shader->packed_varyings) {
+      foreach_in_list(ir_variable, var, shader->packed_varyings) {
+         if (var->data.mode != mode || var->data.patch)
+            continue;
+
+         const glsl_type *type = arrayed ? var->type->fields.array : var->type;
+         *unpacked += type->count_attribute_slots(false);
+      }
+   }
+
+   *packed = util_bitcount64(used);
+}
+
+/**
+ * Print how many varying slots the stages of \c prog pass on to each other.
+ */
+static void
+print_varying_slots(struct gl_shader_program *prog)
+{
+   for (unsigned i = 0; i < MESA_SHADER_STAGES; i++) {
+      struct gl_linked_shader *shader = prog->_LinkedShaders[i];
+      if (!shader || i == MESA_SHADER_FRAGMENT)
+         continue;
+
+      unsigned packed, unpacked;
+      count_varying_slots(shader, ir_var_shader_out, &packed, &unpacked);
+      printf("%s outputs: %u varying slots, %u without packing\n",
+             _mesa_shader_stage_to_string(i), packed, unpacked);
+   }
+}
+
+/**
+ * Print a SPIR-V module for every stage of the linked program \c prog, to
+ * output.<stage>.spv.  Varyings that the next stage doesn't read are gone
+ * by now, and the rest are at the locations that the linker matched them
+ * to.  Bindings and push constant offsets carry on from one stage to the
+ * next, so that no two stages use the same ones.  The explicit bindings of
+ * every stage are kept clear of the ones that get assigned.
+ *
+ * With --reflect or --reflect-binary, the resources of \c prog and what
+ * every module binds where are written out as well.
+ */
+static void
+write_linked_spirv(struct gl_shader_program *prog)
+{
+   static const char *const stage_ext[] = {
+      "vert", "tesc", "tese", "geom", "frag", "comp",
+   };
+   STATIC_ASSERT(ARRAY_SIZE(stage_ext) == MESA_SHADER_STAGES);
+
+   unsigned binding = 0;
+   unsigned push_constant_offset = 0;
+
+   for (unsigned i = 0; i < MESA_SHADER_STAGES; i++) {
+      if (prog->_LinkedShaders[i]) {
+         binding = _mesa_spirv_first_free_binding(prog->_LinkedShaders[i]->ir,
+                                                  binding);
+      }
+   }
+
+   struct program_reflection *reflection = NULL;
+   if (options->reflect || options->reflect_binary)
+      reflection = program_reflection_create(NULL, prog);
+
+   for (unsigned i = 0; i < MESA_SHADER_STAGES; i++) {
+      struct gl_linked_shader *shader = prog->_LinkedShaders[i];
+      if (!shader)
+         continue;
+
+      spirv_buffer buffer;
+      buffer.push_constant_budget = options->push_constants;
+      buffer.push_constant_offset = push_constant_offset;
+      _mesa_print_spirv_stage(&buffer, shader->ir, (gl_shader_stage) i,
+                              prog->data->Version, prog->IsES, true,
+                              binding);
+      binding = buffer.binding_id;
+      push_constant_offset = buffer.push_constant_offset;
+
+      char file_name[32];
+      snprintf(file_name, sizeof(file_name), "output.%s.spv", stage_ext[i]);
+      write_spirv(&buffer, file_name);
+
+      if (reflection) {
+         program_reflection_add_stage(reflection, i, &buffer, shader->ir,
+                                      file_name);
+      }
+   }
+
+   if (options->reflect &&
+       !program_reflection_write_json(reflection, options->reflect)) {
+      printf("%s: couldn't write the reflection\n", options->reflect);
+   }
+   if (options->reflect_binary &&
+       !program_reflection_write_binary(reflection, options->reflect_binary)) {
+      printf("%s: couldn't write the reflection\n", options->reflect_binary);
+   }
+   ralloc_free(reflection);
+}
+
 static void
 compile_shader(struct gl_context *ctx, struct gl_shader *shader)
 {
@@ -408,29 +866,361 @@ compile_shader(struct gl_context *ctx, struct gl_shader *shader)
       _mesa_print_glsl(stdout, fprintf, shader->ir, state);
    }
 
-   if (!state->error && (options->dump_spirv || options->dump_spirv_validation || options->dump_spirv_glsl)) {
+   /* With --link, the linked stages are printed instead, once their
+    * interfaces have been matched up.
+    */
+   if (!state->error && !options->do_link && dump_spirv()) {
+      ralloc_stats_phase("spirv");
+
       spirv_buffer buffer;
+      buffer.push_constant_budget = options->push_constants;
       _mesa_print_spirv(&buffer, shader->ir, state, 0);
+      write_spirv(&buffer, "output.spv");
+   }
 
-      FILE* f = fopen("output.spv", "wb");
-      if (f) {
-         fwrite(buffer.data(), sizeof(int), buffer.count(), f);
-         fclose(f);
-      }
+   ralloc_free(state);
+   return;
+}
+
+/**
+ * Serialize the IR of each stage that \c prog linked to \c blobs, which
+ * have to be initialized.
+ */
+static void
+serialize_linked_ir(const struct gl_shader_program *prog, struct blob *blobs)
+{
+   for (unsigned i = 0; i < MESA_SHADER_STAGES; i++) {
+      if (prog->_LinkedShaders[i])
+         serialize_glsl_ir(&blobs[i], prog->_LinkedShaders[i]->ir);
+   }
+}
+
+/**
+ * Link the shaders of \c prog again into a fresh gl_shader_program that
+ * uses \c cache, which may be NULL.  The copy is freed with
+ * free_program_copy().
+ */
+static struct gl_shader_program *
+link_program_copy(struct gl_context *ctx, const struct gl_shader_program *prog,
+          struct link_cache *cache)
+{
+   struct gl_shader_program *copy = rzalloc(NULL, struct gl_shader_program);
+   copy->data = rzalloc(copy, struct gl_shader_program_data);
+   copy->data->InfoLog = ralloc_strdup(copy->data, "");
+   copy->AttributeBindings = new string_to_uint_map;
+   copy->FragDataBindings = new string_to_uint_map;
+   copy->FragDataIndexBindings = new string_to_uint_map;
+   copy->Shaders = prog->Shaders;
+   copy->NumShaders = prog->NumShaders;
+   copy->LinkCache = cache;
+
+   link_shaders(ctx, copy);
+   return copy;
+}
+
+static void
+free_program_copy(struct gl_context *ctx, struct gl_shader_program *copy)
+{
+   for (unsigned j = 0; j < MESA_SHADER_STAGES; j++) {
+      if (copy->_LinkedShaders[j])
+         ralloc_free(copy->_LinkedShaders[j]->Program);
+   }
+   delete copy->UniformHash;
+   _mesa_clear_shader_program_data(ctx, copy);
+
+   delete copy->AttributeBindings;
+   delete copy->FragDataBindings;
+   delete copy->FragDataIndexBindings;
+   ralloc_free(copy);
+}
+
+/**
+ * Link the shaders of \c prog \c count more times, each time into a fresh
+ * gl_shader_program, and print the average time taken per link, including
+ * the enumeration of the program's resources.
+ *
+ * This doubles as a test of the determinism of the linker: every link has
+ * to come out the same as a serial link without a cache, however the links
+ * are made and whichever stage finishes first.
+ */
+static bool
+bench_link_program(struct gl_context *ctx,
+                   const struct gl_shader_program *prog, int count)
+{
+   unsigned num_resources = 0;
+   int failures = 0;
+   int mismatches = 0;
+
+   struct blob expected[MESA_SHADER_STAGES];
+   for (unsigned j = 0; j < MESA_SHADER_STAGES; j++)
+      blob_init(&expected[j]);
+
+   const bool parallel_link = ctx->Const.GLSLParallelLink;
+   ctx->Const.GLSLParallelLink = false;
+   struct gl_shader_program *serial = link_program_copy(ctx, prog, NULL);
+   ctx->Const.GLSLParallelLink = parallel_link;
+
+   const bool check = serial->data->LinkStatus;
+   if (check)
+      serialize_linked_ir(serial, expected);
+   free_program_copy(ctx, serial);
+
+   std::chrono::duration<double, std::micro> elapsed(0);
 
-      if (options->dump_spirv) {
-         system("spirv-dis.exe output.spv");
+   for (int i = 0; i < count; i++) {
+      const auto start = std::chrono::steady_clock::now();
+
+      struct gl_shader_program *copy = link_program_copy(ctx, prog, prog->LinkCache);
+      if (copy->data->LinkStatus) {
+         build_program_resource_list(ctx, copy, false);
+         num_resources = copy->data->NumProgramResourceList;
+      } else {
+         failures++;
       }
-      if (options->dump_spirv_validation) {
-         system("spirv-val.exe output.spv");
+
+      elapsed += std::chrono::steady_clock::now() - start;
+
+      /* The linker doesn't touch the IR once the resources are enumerated,
+       * so it is compared after the link is timed.
+       */
+      if (check && copy->data->LinkStatus) {
+         struct blob linked[MESA_SHADER_STAGES];
+         for (unsigned j = 0; j < MESA_SHADER_STAGES; j++)
+            blob_init(&linked[j]);
+         serialize_linked_ir(copy, linked);
+
+         bool same = true;
+         for (unsigned j = 0; j < MESA_SHADER_STAGES; j++) {
+            same = same && linked[j].size == expected[j].size &&
+                   (linked[j].size == 0 ||
+                    memcmp(linked[j].data, expected[j].data,
+                           linked[j].size) == 0);
+            blob_finish(&linked[j]);
+         }
+         if (!same)
+            mismatches++;
       }
-      if (options->dump_spirv_glsl) {
-         system("spirv-cross.exe output.spv");
+
+      free_program_copy(ctx, copy);
+   }
+
+   for (unsigned j = 0; j < MESA_SHADER_STAGES; j++)
+      blob_finish(&expected[j]);
+
+   printf("link: %d links, %.1f us per link, %u resources\n", count,
+          elapsed.count() / count, num_resources);
+
+   if (failures != 0) {
+      printf("link: %d links failed\n", failures);
+      return false;
+   }
+
+   if (mismatches != 0) {
+      printf("link: %d links came out differently\n", mismatches);
+      return false;
+   }
+
+   return true;
+}
+
+/**
+ * Relink \c prog after replacing its shader of the same stage as \c file by
+ * the one compiled from \c file, as a shader editor would after an edit,
+ * and print what the relink could reuse from the link that took
+ * \c link_time.
+ */
+static bool
+relink_program(struct gl_context *ctx, struct gl_shader_program *prog,
+               const char *file, double link_time)
+{
+   const GLenum type = shader_type(file);
+
+   unsigned i;
+   for (i = 0; i < prog->NumShaders; i++) {
+      if (type != 0 && prog->Shaders[i]->Type == type)
+         break;
+   }
+
+   if (i == prog->NumShaders) {
+      printf("relink: no shader of the stage of \"%s\" to replace\n", file);
+      return false;
+   }
+
+   struct gl_shader *shader = rzalloc(prog, gl_shader);
+   shader->Type = type;
+   shader->Stage = _mesa_shader_enum_to_shader_stage(type);
+   shader->Source = load_text_file(prog, file);
+   if (shader->Source == NULL) {
+      printf("File \"%s\" does not exist.\n", file);
+      return false;
+   }
+
+   compile_shader(ctx, shader);
+
+   if (strlen(shader->InfoLog) > 0) {
+      if (!options->just_log)
+         printf("Info log for %s:\n", file);
+
+      printf("%s", shader->InfoLog);
+      if (!options->just_log)
+         printf("\n");
+   }
+
+   if (!shader->CompileStatus)
+      return false;
+
+   prog->Shaders[i] = shader;
+
+   for (unsigned j = 0; j < MESA_SHADER_STAGES; j++) {
+      if (prog->_LinkedShaders[j])
+         ralloc_free(prog->_LinkedShaders[j]->Program);
+   }
+   delete prog->UniformHash;
+   _mesa_clear_shader_program_data(ctx, prog);
+   prog->data->linked_stages = 0;
+
+   const auto start = std::chrono::steady_clock::now();
+   link_shaders(ctx, prog);
+   const std::chrono::duration<double, std::micro> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+   if (!prog->data->LinkStatus)
+      return false;
+
+   const unsigned reused = link_cache_reused_stages(prog->LinkCache);
+   const unsigned interfaces = util_bitcount(prog->data->linked_stages) - 1;
+
+   printf("relink:");
+   for (unsigned j = 0; j < MESA_SHADER_STAGES; j++) {
+      if (prog->_LinkedShaders[j]) {
+         printf(" %s %s", _mesa_shader_stage_to_string(j),
+                reused & (1 << j) ? "reused" : "linked");
       }
    }
+   printf(", %u of %u interfaces reused\n",
+          util_bitcount(link_cache_reused_interfaces(prog->LinkCache)),
+          interfaces);
+   printf("relink: %.1f us to link, %.1f us to relink\n", link_time,
+          elapsed.count());
 
-   ralloc_free(state);
-   return;
+   return true;
+}
+
+/**
+ * Hash of the compiler's own executable in \c id, so that the IR that
+ * another build cached, whose passes may differ, isn't read back.
+ *
+ * \return false if the executable can't be read.
+ */
+static bool
+build_identifier(uint64_t *id)
+{
+   static int known = -1;
+   static uint64_t hash;
+
+   if (known < 0) {
+      size_t size;
+      char *executable = os_read_executable(&size);
+
+      known = executable != NULL;
+      if (known)
+         hash = XXH64(executable, size, 0);
+      else
+         fprintf(stderr, "warning: the compiler can't read its executable, "
+                 "so --ir-cache isn't used\n");
+      free(executable);
+   }
+
+   *id = hash;
+   return known;
+}
+
+/**
+ * Path of the file in the --ir-cache directory for the compile of \c shader,
+ * named after a hash of its source, of the options and limits that the
+ * compile depends on, and of the compiler itself, or NULL if the compiler
+ * can't be identified.
+ */
+static char *
+ir_cache_path(void *mem_ctx, const struct gl_context *ctx,
+              const struct gl_shader *shader)
+{
+   uint64_t id;
+   if (!build_identifier(&id))
+      return NULL;
+
+   const int settings[] = {
+      shader->Stage,
+      options->glsl_version,
+      options->unroll_budget,
+      options->pack_varyings,
+   };
+
+   XXH64_state_t state;
+   XXH64_reset(&state, id);
+   XXH64_update(&state, settings, sizeof(settings));
+   XXH64_update(&state, &ctx->Const.Program[shader->Stage],
+                sizeof(ctx->Const.Program[shader->Stage]));
+   XXH64_update(&state, &ctx->Const.ShaderCompilerOptions[shader->Stage],
+                sizeof(ctx->Const.ShaderCompilerOptions[shader->Stage]));
+   XXH64_update(&state, shader->Source, strlen(shader->Source));
+   const uint64_t key = XXH64_digest(&state);
+
+   return ralloc_asprintf(mem_ctx, "%s/%016" PRIx64 ".ir", options->ir_cache,
+                          key);
+}
+
+static bool
+load_cached_shader(struct gl_context *ctx, struct gl_shader *shader,
+                   const char *path)
+{
+   size_t size;
+   char *data = os_read_file(path, &size);
+   if (data == NULL)
+      return false;
+
+   struct blob_reader blob;
+   blob_reader_init(&blob, data, size);
+   const bool loaded = deserialize_glsl_shader(&blob, shader);
+   free(data);
+
+   /* A compile turns on the names of temporaries, which the linker gives
+    * to the ones it makes too, so a cached shader has to link the same.
+    */
+   if (loaded && ctx->Const.GenerateTemporaryNames)
+      (void) p_atomic_cmpxchg(&ir_variable::temporaries_allocate_names,
+                              false, true);
+
+   /* There is no parse state to print the structure declarations from. */
+   if (loaded && options->dump_lir)
+      _mesa_print_ir(stdout, shader->ir, NULL);
+
+   return loaded;
+}
+
+static void
+store_cached_shader(struct gl_shader *shader, const char *path)
+{
+   struct blob blob;
+   blob_init(&blob);
+   serialize_glsl_shader(&blob, shader);
+
+   /* Write to a file of its own first, so that nobody ever reads half of a
+    * cached shader.
+    */
+   char *tmp_path = ralloc_asprintf(NULL, "%s.tmp", path);
+   FILE *f = fopen(tmp_path, "wb");
+   if (f) {
+      const bool written = !blob.out_of_memory &&
+         fwrite(blob.data, 1, blob.size, f) == blob.size;
+      fclose(f);
+
+      if (!written || rename(tmp_path, path) != 0)
+         remove(tmp_path);
+   }
+
+   ralloc_free(tmp_path);
+   blob_finish(&blob);
 }
 
 extern "C" struct gl_shader_program *
@@ -467,6 +1257,9 @@ standalone_compile_shader(const struct standalone_options *_options,
       return NULL;
    }
 
+   if (options->mem_stats)
+      ralloc_stats_enable(stdout);
+
    if (glsl_es) {
       initialize_context(ctx, API_OPENGLES2);
    } else {
@@ -497,25 +1290,8 @@ standalone_compile_shader(const struct standalone_options *_options,
       whole_program->Shaders[whole_program->NumShaders] = shader;
       whole_program->NumShaders++;
 
-      const unsigned len = strlen(files[i]);
-      if (len < 6)
-         goto fail;
-
-      const char *const ext = & files[i][len - 5];
-      /* TODO add support to read a .shader_test */
-      if (strncmp(".vert", ext, 5) == 0 || strncmp(".glsl", ext, 5) == 0)
-	 shader->Type = GL_VERTEX_SHADER;
-      else if (strncmp(".tesc", ext, 5) == 0)
-	 shader->Type = GL_TESS_CONTROL_SHADER;
-      else if (strncmp(".tese", ext, 5) == 0)
-	 shader->Type = GL_TESS_EVALUATION_SHADER;
-      else if (strncmp(".geom", ext, 5) == 0)
-	 shader->Type = GL_GEOMETRY_SHADER;
-      else if (strncmp(".frag", ext, 5) == 0)
-	 shader->Type = GL_FRAGMENT_SHADER;
-      else if (strncmp(".comp", ext, 5) == 0)
-         shader->Type = GL_COMPUTE_SHADER;
-      else
+      shader->Type = shader_type(files[i]);
+      if (shader->Type == 0)
          goto fail;
       shader->Stage = _mesa_shader_enum_to_shader_stage(shader->Type);
 
@@ -525,7 +1301,27 @@ standalone_compile_shader(const struct standalone_options *_options,
          exit(EXIT_FAILURE);
       }
 
-      compile_shader(ctx, shader);
+      /* With --ir-cache, the IR of a source that was compiled before is read
+       * back instead, as it was left for the linker.  Only --dump-lir can be
+       * printed from that IR, so the other dumps of a compile bypass it.
+       */
+      char *cache_path = options->ir_cache ?
+         ir_cache_path(shader, ctx, shader) : NULL;
+
+      if (cache_path == NULL || dump_compile() ||
+          !load_cached_shader(ctx, shader, cache_path)) {
+         compile_shader(ctx, shader);
+
+         if (cache_path != NULL && shader->CompileStatus == COMPILE_SUCCESS)
+            store_cached_shader(shader, cache_path);
+      }
+
+      const int num_threads = MAX2(options->threads, 1);
+
+      if (options->bench > 0 &&
+          !bench_compile_shader(ctx, shader, files[i], options->bench,
+                                num_threads))
+         status = EXIT_FAILURE;
 
       if (strlen(shader->InfoLog) > 0) {
          if (!options->just_log)
@@ -543,10 +1339,34 @@ standalone_compile_shader(const struct standalone_options *_options,
    }
 
    if (status == EXIT_SUCCESS) {
+      ralloc_stats_phase("link");
+
       _mesa_clear_shader_program_data(ctx, whole_program);
 
       if (options->do_link)  {
+         /* With --relink, link once with a cache of the stages, then again
+          * with one of the shaders edited.
+          */
+         if (options->relink)
+            whole_program->LinkCache = link_cache_create(whole_program);
+
+         const auto start = std::chrono::steady_clock::now();
          link_shaders(ctx, whole_program);
+         const std::chrono::duration<double, std::micro> link_time =
+            std::chrono::steady_clock::now() - start;
+
+         if (whole_program->data->LinkStatus && options->relink &&
+             !relink_program(ctx, whole_program, options->relink,
+                             link_time.count()))
+            whole_program->data->LinkStatus = LINKING_FAILURE;
+
+         /* Enumerate the active resources, as glLinkProgram does. */
+         if (whole_program->data->LinkStatus)
+            build_program_resource_list(ctx, whole_program, false);
+
+         if (whole_program->data->LinkStatus && options->bench > 0 &&
+             !bench_link_program(ctx, whole_program, options->bench))
+            whole_program->data->LinkStatus = LINKING_FAILURE;
       } else {
          const gl_shader_stage stage = whole_program->Shaders[0]->Stage;
 
@@ -610,6 +1430,16 @@ standalone_compile_shader(const struct standalone_options *_options,
          dv.remove_dead_variables();
       }
 
+      if (options->do_link && whole_program->data->LinkStatus && dump_spirv()) {
+         ralloc_stats_phase("spirv");
+         write_linked_spirv(whole_program);
+      }
+
+      if (options->do_link && whole_program->data->LinkStatus &&
+          options->pack_varyings) {
+         print_varying_slots(whole_program);
+      }
+
       if (options->dump_builder) {
          for (unsigned i = 0; i < MESA_SHADER_STAGES; i++) {
             struct gl_linked_shader *shader = whole_program->_LinkedShaders[i];
@@ -622,6 +1452,11 @@ standalone_compile_shader(const struct standalone_options *_options,
       }
    }
 
+   if (options->mem_stats) {
+      ralloc_stats_phase("cleanup");
+      ralloc_stats_print_tree(stdout, whole_program);
+   }
+
    return whole_program;
 
 fail:
@@ -645,6 +1480,7 @@ standalone_compiler_cleanup(struct gl_shader_program *whole_program)
    delete whole_program->AttributeBindings;
    delete whole_program->FragDataBindings;
    delete whole_program->FragDataIndexBindings;
+   delete whole_program->UniformHash;
 
    ralloc_free(whole_program);
    _mesa_glsl_builtin_functions_decref();
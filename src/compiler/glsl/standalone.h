@@ -38,8 +38,21 @@ struct standalone_options {
    int dump_spirv;
    int dump_spirv_validation;
    int dump_spirv_glsl;
+   int dump_uniform_layout;
+   int push_constants;
+   int pack_varyings;
    int do_link;
    int just_log;
+   int unroll_budget;
+   int mem_stats;
+   int bench;
+   int threads;
+   int stream_hir;
+   int parallel_link;
+   const char *ir_cache;
+   const char *reflect;
+   const char *reflect_binary;
+   const char *relink;
 };
 
 struct gl_shader_program;
@@ -269,6 +269,7 @@ void initialize_context_to_defaults(struct gl_context *ctx, gl_api api)
    struct gl_shader_compiler_options options;
    memset(&options, 0, sizeof(options));
    options.MaxUnrollIterations = 32;
+   options.MaxUnrollBudget = 1024;
    options.MaxIfDepth = UINT_MAX;
 
    for (int sh = 0; sh < MESA_SHADER_STAGES; ++sh)
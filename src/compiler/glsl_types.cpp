@@ -25,17 +25,57 @@
 #include "main/macros.h"
 #include "compiler/glsl/glsl_parser_extras.h"
 #include "glsl_types.h"
+#include "util/blob.h"
 #include "util/hash_table.h"
 #include "util/u_string.h"
 
 
+#define GLSL_TYPE_TABLE_SHARD_BITS 4
+#define GLSL_TYPE_TABLE_SHARDS (1 << GLSL_TYPE_TABLE_SHARD_BITS)
+
+/**
+ * One of the flyweight tables of glsl_type.
+ *
+ * The table is split by key hash into shards that each have their own lock,
+ * so that threads compiling at the same time only wait for each other when
+ * they look up types that land in the same shard.  Types are only removed
+ * once the last user releases the singleton, so a type found under a shard
+ * lock stays valid after it is dropped.
+ */
+struct glsl_type_table {
+   uint32_t (*key_hash)(const void *key);
+   bool (*key_equals)(const void *a, const void *b);
+
+   struct {
+      mtx_t mutex;
+      struct hash_table *types;
+   } shards[GLSL_TYPE_TABLE_SHARDS];
+};
+
+static uint32_t array_type_key_hash(const void *key);
+static bool array_type_key_equal(const void *a, const void *b);
+static uint32_t function_key_hash(const void *key);
+static bool function_key_compare(const void *a, const void *b);
+
 mtx_t glsl_type::hash_mutex = _MTX_INITIALIZER_NP;
-hash_table *glsl_type::explicit_matrix_types = NULL;
-hash_table *glsl_type::array_types = NULL;
-hash_table *glsl_type::struct_types = NULL;
-hash_table *glsl_type::interface_types = NULL;
-hash_table *glsl_type::function_types = NULL;
-hash_table *glsl_type::subroutine_types = NULL;
+glsl_type_table glsl_type::explicit_matrix_types = {
+   _mesa_hash_counted_string, _mesa_key_string_equal
+};
+glsl_type_table glsl_type::array_types = {
+   array_type_key_hash, array_type_key_equal
+};
+glsl_type_table glsl_type::struct_types = {
+   record_key_hash, record_key_compare
+};
+glsl_type_table glsl_type::interface_types = {
+   record_key_hash, record_key_compare
+};
+glsl_type_table glsl_type::function_types = {
+   function_key_hash, function_key_compare
+};
+glsl_type_table glsl_type::subroutine_types = {
+   record_key_hash, record_key_compare
+};
 
 /* There might be multiple users for types (e.g. application using OpenGL
  * and Vulkan simultanously or app using multiple Vulkan instances). Counter
@@ -474,11 +514,68 @@ hash_free_type_function(struct hash_entry *entry)
    delete type;
 }
 
+static void
+type_table_init(glsl_type_table *table)
+{
+   for (unsigned i = 0; i < GLSL_TYPE_TABLE_SHARDS; i++) {
+      mtx_init(&table->shards[i].mutex, mtx_plain);
+      table->shards[i].types =
+         _mesa_hash_table_create(NULL, table->key_hash, table->key_equals);
+   }
+}
+
+static void
+type_table_fini(glsl_type_table *table)
+{
+   for (unsigned i = 0; i < GLSL_TYPE_TABLE_SHARDS; i++) {
+      _mesa_hash_table_destroy(table->shards[i].types,
+                               hash_free_type_function);
+      table->shards[i].types = NULL;
+      mtx_destroy(&table->shards[i].mutex);
+   }
+}
+
+static unsigned
+type_table_shard(uint32_t hash)
+{
+   /* Some of the key hashes are sums of pointers, whose low bits say little,
+    * so mix them all into the shard index.
+    */
+   return (hash * 0x9e3779b9u) >> (32 - GLSL_TYPE_TABLE_SHARD_BITS);
+}
+
+/**
+ * Lock the shard of \c table that keys with \c hash belong to, and return
+ * its hash table.
+ */
+static struct hash_table *
+type_table_lock(glsl_type_table *table, uint32_t hash)
+{
+   assert(glsl_type_users > 0);
+
+   const unsigned shard = type_table_shard(hash);
+   mtx_lock(&table->shards[shard].mutex);
+   return table->shards[shard].types;
+}
+
+static void
+type_table_unlock(glsl_type_table *table, uint32_t hash)
+{
+   mtx_unlock(&table->shards[type_table_shard(hash)].mutex);
+}
+
 void
 glsl_type_singleton_init_or_ref()
 {
    mtx_lock(&glsl_type::hash_mutex);
-   glsl_type_users++;
+   if (glsl_type_users++ == 0) {
+      type_table_init(&glsl_type::explicit_matrix_types);
+      type_table_init(&glsl_type::array_types);
+      type_table_init(&glsl_type::struct_types);
+      type_table_init(&glsl_type::interface_types);
+      type_table_init(&glsl_type::function_types);
+      type_table_init(&glsl_type::subroutine_types);
+   }
    mtx_unlock(&glsl_type::hash_mutex);
 }
 
@@ -494,36 +591,12 @@ glsl_type_singleton_decref()
       return;
    }
 
-   if (glsl_type::explicit_matrix_types != NULL) {
-      _mesa_hash_table_destroy(glsl_type::explicit_matrix_types,
-                               hash_free_type_function);
-      glsl_type::explicit_matrix_types = NULL;
-   }
-
-   if (glsl_type::array_types != NULL) {
-      _mesa_hash_table_destroy(glsl_type::array_types, hash_free_type_function);
-      glsl_type::array_types = NULL;
-   }
-
-   if (glsl_type::struct_types != NULL) {
-      _mesa_hash_table_destroy(glsl_type::struct_types, hash_free_type_function);
-      glsl_type::struct_types = NULL;
-   }
-
-   if (glsl_type::interface_types != NULL) {
-      _mesa_hash_table_destroy(glsl_type::interface_types, hash_free_type_function);
-      glsl_type::interface_types = NULL;
-   }
-
-   if (glsl_type::function_types != NULL) {
-      _mesa_hash_table_destroy(glsl_type::function_types, hash_free_type_function);
-      glsl_type::function_types = NULL;
-   }
-
-   if (glsl_type::subroutine_types != NULL) {
-      _mesa_hash_table_destroy(glsl_type::subroutine_types, hash_free_type_function);
-      glsl_type::subroutine_types = NULL;
-   }
+   type_table_fini(&glsl_type::explicit_matrix_types);
+   type_table_fini(&glsl_type::array_types);
+   type_table_fini(&glsl_type::struct_types);
+   type_table_fini(&glsl_type::interface_types);
+   type_table_fini(&glsl_type::function_types);
+   type_table_fini(&glsl_type::subroutine_types);
 
    mtx_unlock(&glsl_type::hash_mutex);
 }
@@ -634,28 +707,25 @@ glsl_type::get_instance(unsigned base_type, unsigned rows, unsigned columns,
       assert(columns > 1 || !row_major);
 
       char name[128];
-      snprintf(name, sizeof(name), "%sx%uB%s", bare_type->name,
-               explicit_stride, row_major ? "RM" : "");
-
-      mtx_lock(&glsl_type::hash_mutex);
-      assert(glsl_type_users > 0);
+      const int length = snprintf(name, sizeof(name), "%sx%uB%s",
+                                  bare_type->name, explicit_stride,
+                                  row_major ? "RM" : "");
+      assert(length > 0 && length < (int) sizeof(name));
 
-      if (explicit_matrix_types == NULL) {
-         explicit_matrix_types =
-            _mesa_hash_table_create(NULL, _mesa_hash_string,
-                                    _mesa_key_string_equal);
-      }
+      const uint32_t hash = _mesa_hash_string_with_length(name, length);
+      struct hash_table *types =
+         type_table_lock(&explicit_matrix_types, hash);
 
       const struct hash_entry *entry =
-         _mesa_hash_table_search(explicit_matrix_types, name);
+         _mesa_hash_table_search_string_pre_hashed(types, hash, name, length);
       if (entry == NULL) {
          const glsl_type *t = new glsl_type(bare_type->gl_type,
                                             (glsl_base_type)base_type,
                                             rows, columns, name,
                                             explicit_stride, row_major);
 
-         entry = _mesa_hash_table_insert(explicit_matrix_types,
-                                         t->name, (void *)t);
+         entry = _mesa_hash_table_insert_pre_hashed(types, hash,
+                                                    t->name, (void *)t);
       }
 
       assert(((glsl_type *) entry->data)->base_type == base_type);
@@ -663,9 +733,10 @@ glsl_type::get_instance(unsigned base_type, unsigned rows, unsigned columns,
       assert(((glsl_type *) entry->data)->matrix_columns == columns);
       assert(((glsl_type *) entry->data)->explicit_stride == explicit_stride);
 
-      mtx_unlock(&glsl_type::hash_mutex);
+      const glsl_type *t = (const glsl_type *) entry->data;
+      type_table_unlock(&explicit_matrix_types, hash);
 
-      return (const glsl_type *) entry->data;
+      return t;
    }
 
    assert(!row_major);
@@ -989,44 +1060,72 @@ glsl_type::get_image_instance(enum glsl_sampler_dim dim,
    unreachable("switch statement above should be complete");
 }
 
+/**
+ * Key of glsl_type::array_types.
+ *
+ * The base type is identified by its pointer rather than its name, since the
+ * name of the base type may not be unique across shaders.  For example, two
+ * shaders may have different record types named 'foo'.
+ */
+struct array_type_key {
+   const glsl_type *base;
+   unsigned array_size;
+   unsigned explicit_stride;
+};
+
+static uint32_t
+array_type_key_hash(const void *a)
+{
+   const array_type_key *key = (const array_type_key *) a;
+   uint64_t hash = (uintptr_t) key->base;
+
+   hash ^= ((uint64_t) key->array_size << 32) | key->explicit_stride;
+   hash *= 0x9e3779b97f4a7c15ull;
+
+   return (uint32_t) (hash >> 32);
+}
+
+static bool
+array_type_key_equal(const void *a, const void *b)
+{
+   const array_type_key *key1 = (const array_type_key *) a;
+   const array_type_key *key2 = (const array_type_key *) b;
+
+   return key1->base == key2->base &&
+          key1->array_size == key2->array_size &&
+          key1->explicit_stride == key2->explicit_stride;
+}
+
 const glsl_type *
 glsl_type::get_array_instance(const glsl_type *base,
                               unsigned array_size,
                               unsigned explicit_stride)
 {
-   /* Generate a name using the base type pointer in the key.  This is
-    * done because the name of the base type may not be unique across
-    * shaders.  For example, two shaders may have different record types
-    * named 'foo'.
-    */
-   char key[128];
-   snprintf(key, sizeof(key), "%p[%u]x%uB", (void *) base, array_size,
-            explicit_stride);
-
-   mtx_lock(&glsl_type::hash_mutex);
-   assert(glsl_type_users > 0);
+   const array_type_key key = { base, array_size, explicit_stride };
 
-   if (array_types == NULL) {
-      array_types = _mesa_hash_table_create(NULL, _mesa_hash_string,
-                                            _mesa_key_string_equal);
-   }
+   const uint32_t hash = array_type_key_hash(&key);
+   struct hash_table *types = type_table_lock(&array_types, hash);
 
-   const struct hash_entry *entry = _mesa_hash_table_search(array_types, key);
+   const struct hash_entry *entry =
+      _mesa_hash_table_search_pre_hashed(types, hash, &key);
    if (entry == NULL) {
       const glsl_type *t = new glsl_type(base, array_size, explicit_stride);
+      array_type_key *stored_key =
+         (array_type_key *) malloc(sizeof(array_type_key));
+      *stored_key = key;
 
-      entry = _mesa_hash_table_insert(array_types,
-                                      strdup(key),
-                                      (void *) t);
+      entry = _mesa_hash_table_insert_pre_hashed(types, hash, stored_key,
+                                                 (void *) t);
    }
 
    assert(((glsl_type *) entry->data)->base_type == GLSL_TYPE_ARRAY);
    assert(((glsl_type *) entry->data)->length == array_size);
    assert(((glsl_type *) entry->data)->fields.array == base);
 
-   mtx_unlock(&glsl_type::hash_mutex);
+   const glsl_type *t = (const glsl_type *) entry->data;
+   type_table_unlock(&array_types, hash);
 
-   return (glsl_type *) entry->data;
+   return t;
 }
 
 bool
@@ -1204,20 +1303,15 @@ glsl_type::get_struct_instance(const glsl_struct_field *fields,
 {
    const glsl_type key(fields, num_fields, name, packed);
 
-   mtx_lock(&glsl_type::hash_mutex);
-   assert(glsl_type_users > 0);
-
-   if (struct_types == NULL) {
-      struct_types = _mesa_hash_table_create(NULL, record_key_hash,
-                                             record_key_compare);
-   }
+   const uint32_t hash = record_key_hash(&key);
+   struct hash_table *types = type_table_lock(&struct_types, hash);
 
-   const struct hash_entry *entry = _mesa_hash_table_search(struct_types,
-                                                            &key);
+   const struct hash_entry *entry =
+      _mesa_hash_table_search_pre_hashed(types, hash, &key);
    if (entry == NULL) {
       const glsl_type *t = new glsl_type(fields, num_fields, name, packed);
 
-      entry = _mesa_hash_table_insert(struct_types, t, (void *) t);
+      entry = _mesa_hash_table_insert_pre_hashed(types, hash, t, (void *) t);
    }
 
    assert(((glsl_type *) entry->data)->base_type == GLSL_TYPE_STRUCT);
@@ -1225,9 +1319,10 @@ glsl_type::get_struct_instance(const glsl_struct_field *fields,
    assert(strcmp(((glsl_type *) entry->data)->name, name) == 0);
    assert(((glsl_type *) entry->data)->packed == packed);
 
-   mtx_unlock(&glsl_type::hash_mutex);
+   const glsl_type *t = (const glsl_type *) entry->data;
+   type_table_unlock(&struct_types, hash);
 
-   return (glsl_type *) entry->data;
+   return t;
 }
 
 
@@ -1240,30 +1335,26 @@ glsl_type::get_interface_instance(const glsl_struct_field *fields,
 {
    const glsl_type key(fields, num_fields, packing, row_major, block_name);
 
-   mtx_lock(&glsl_type::hash_mutex);
-   assert(glsl_type_users > 0);
-
-   if (interface_types == NULL) {
-      interface_types = _mesa_hash_table_create(NULL, record_key_hash,
-                                                record_key_compare);
-   }
+   const uint32_t hash = record_key_hash(&key);
+   struct hash_table *types = type_table_lock(&interface_types, hash);
 
-   const struct hash_entry *entry = _mesa_hash_table_search(interface_types,
-                                                            &key);
+   const struct hash_entry *entry =
+      _mesa_hash_table_search_pre_hashed(types, hash, &key);
    if (entry == NULL) {
       const glsl_type *t = new glsl_type(fields, num_fields,
                                          packing, row_major, block_name);
 
-      entry = _mesa_hash_table_insert(interface_types, t, (void *) t);
+      entry = _mesa_hash_table_insert_pre_hashed(types, hash, t, (void *) t);
    }
 
    assert(((glsl_type *) entry->data)->base_type == GLSL_TYPE_INTERFACE);
    assert(((glsl_type *) entry->data)->length == num_fields);
    assert(strcmp(((glsl_type *) entry->data)->name, block_name) == 0);
 
-   mtx_unlock(&glsl_type::hash_mutex);
+   const glsl_type *t = (const glsl_type *) entry->data;
+   type_table_unlock(&interface_types, hash);
 
-   return (glsl_type *) entry->data;
+   return t;
 }
 
 const glsl_type *
@@ -1271,28 +1362,24 @@ glsl_type::get_subroutine_instance(const char *subroutine_name)
 {
    const glsl_type key(subroutine_name);
 
-   mtx_lock(&glsl_type::hash_mutex);
-   assert(glsl_type_users > 0);
-
-   if (subroutine_types == NULL) {
-      subroutine_types = _mesa_hash_table_create(NULL, record_key_hash,
-                                                 record_key_compare);
-   }
+   const uint32_t hash = record_key_hash(&key);
+   struct hash_table *types = type_table_lock(&subroutine_types, hash);
 
-   const struct hash_entry *entry = _mesa_hash_table_search(subroutine_types,
-                                                            &key);
+   const struct hash_entry *entry =
+      _mesa_hash_table_search_pre_hashed(types, hash, &key);
    if (entry == NULL) {
       const glsl_type *t = new glsl_type(subroutine_name);
 
-      entry = _mesa_hash_table_insert(subroutine_types, t, (void *) t);
+      entry = _mesa_hash_table_insert_pre_hashed(types, hash, t, (void *) t);
    }
 
    assert(((glsl_type *) entry->data)->base_type == GLSL_TYPE_SUBROUTINE);
    assert(strcmp(((glsl_type *) entry->data)->name, subroutine_name) == 0);
 
-   mtx_unlock(&glsl_type::hash_mutex);
+   const glsl_type *t = (const glsl_type *) entry->data;
+   type_table_unlock(&subroutine_types, hash);
 
-   return (glsl_type *) entry->data;
+   return t;
 }
 
 
@@ -1325,19 +1412,15 @@ glsl_type::get_function_instance(const glsl_type *return_type,
 {
    const glsl_type key(return_type, params, num_params);
 
-   mtx_lock(&glsl_type::hash_mutex);
-   assert(glsl_type_users > 0);
+   const uint32_t hash = function_key_hash(&key);
+   struct hash_table *types = type_table_lock(&function_types, hash);
 
-   if (function_types == NULL) {
-      function_types = _mesa_hash_table_create(NULL, function_key_hash,
-                                               function_key_compare);
-   }
-
-   struct hash_entry *entry = _mesa_hash_table_search(function_types, &key);
+   struct hash_entry *entry =
+      _mesa_hash_table_search_pre_hashed(types, hash, &key);
    if (entry == NULL) {
       const glsl_type *t = new glsl_type(return_type, params, num_params);
 
-      entry = _mesa_hash_table_insert(function_types, t, (void *) t);
+      entry = _mesa_hash_table_insert_pre_hashed(types, hash, t, (void *) t);
    }
 
    const glsl_type *t = (const glsl_type *)entry->data;
@@ -1345,7 +1428,7 @@ glsl_type::get_function_instance(const glsl_type *return_type,
    assert(t->base_type == GLSL_TYPE_FUNCTION);
    assert(t->length == num_params);
 
-   mtx_unlock(&glsl_type::hash_mutex);
+   type_table_unlock(&function_types, hash);
 
    return t;
 }
@@ -2661,6 +2744,229 @@ union packed_type {
    } strct;
 };
 
+void
+encode_type_to_blob(struct blob *blob, const glsl_type *type)
+{
+   if (!type) {
+      blob_write_uint32(blob, 0);
+      return;
+   }
+
+   STATIC_ASSERT(sizeof(union packed_type) == 4);
+   union packed_type encoded;
+   encoded.u32 = 0;
+   encoded.basic.base_type = type->base_type;
+
+   switch (type->base_type) {
+   case GLSL_TYPE_UINT:
+   case GLSL_TYPE_INT:
+   case GLSL_TYPE_FLOAT:
+   case GLSL_TYPE_FLOAT16:
+   case GLSL_TYPE_DOUBLE:
+   case GLSL_TYPE_UINT8:
+   case GLSL_TYPE_INT8:
+   case GLSL_TYPE_UINT16:
+   case GLSL_TYPE_INT16:
+   case GLSL_TYPE_UINT64:
+   case GLSL_TYPE_INT64:
+   case GLSL_TYPE_BOOL:
+      encoded.basic.interface_row_major = type->interface_row_major;
+      assert(type->vector_elements < 8);
+      assert(type->matrix_columns < 8);
+      encoded.basic.vector_elements = type->vector_elements;
+      encoded.basic.matrix_columns = type->matrix_columns;
+      encoded.basic.explicit_stride = MIN2(type->explicit_stride, 0xfffff);
+      blob_write_uint32(blob, encoded.u32);
+      /* If we don't have enough bits for explicit_stride, store it
+       * separately.
+       */
+      if (encoded.basic.explicit_stride == 0xfffff)
+         blob_write_uint32(blob, type->explicit_stride);
+      return;
+   case GLSL_TYPE_SAMPLER:
+      encoded.sampler.dimensionality = type->sampler_dimensionality;
+      encoded.sampler.shadow = type->sampler_shadow;
+      encoded.sampler.array = type->sampler_array;
+      encoded.sampler.sampled_type = type->sampled_type;
+      break;
+   case GLSL_TYPE_SUBROUTINE:
+      blob_write_uint32(blob, encoded.u32);
+      blob_write_string(blob, type->name);
+      return;
+   case GLSL_TYPE_IMAGE:
+      encoded.sampler.dimensionality = type->sampler_dimensionality;
+      encoded.sampler.array = type->sampler_array;
+      encoded.sampler.sampled_type = type->sampled_type;
+      break;
+   case GLSL_TYPE_ATOMIC_UINT:
+      break;
+   case GLSL_TYPE_ARRAY:
+      encoded.array.length = MIN2(type->length, 0x1fff);
+      encoded.array.explicit_stride = MIN2(type->explicit_stride, 0x3fff);
+      blob_write_uint32(blob, encoded.u32);
+      /* If we don't have enough bits for length or explicit_stride, store it
+       * separately.
+       */
+      if (encoded.array.length == 0x1fff)
+         blob_write_uint32(blob, type->length);
+      if (encoded.array.explicit_stride == 0x3fff)
+         blob_write_uint32(blob, type->explicit_stride);
+      encode_type_to_blob(blob, type->fields.array);
+      return;
+   case GLSL_TYPE_STRUCT:
+   case GLSL_TYPE_INTERFACE: {
+      encoded.strct.length = MIN2(type->length, 0xffffff);
+      if (type->is_interface()) {
+         encoded.strct.interface_packing_or_packed = type->interface_packing;
+         encoded.strct.interface_row_major = type->interface_row_major;
+      } else {
+         encoded.strct.interface_packing_or_packed = type->packed;
+      }
+      blob_write_uint32(blob, encoded.u32);
+      blob_write_string(blob, type->name);
+
+      /* If we don't have enough bits for length, store it separately. */
+      if (encoded.strct.length == 0xffffff)
+         blob_write_uint32(blob, type->length);
+
+      size_t s_field_size, s_field_ptrs;
+      get_struct_type_field_and_pointer_sizes(&s_field_size, &s_field_ptrs);
+
+      for (unsigned i = 0; i < type->length; i++) {
+         encode_type_to_blob(blob, type->fields.structure[i].type);
+         blob_write_string(blob, type->fields.structure[i].name);
+
+         /* Write the struct field skipping the pointers */
+         blob_write_bytes(blob,
+                          ((char *)&type->fields.structure[i]) + s_field_ptrs,
+                          s_field_size - s_field_ptrs);
+      }
+      return;
+   }
+   case GLSL_TYPE_VOID:
+      break;
+   case GLSL_TYPE_ERROR:
+   default:
+      assert(!"Cannot encode type!");
+      encoded.u32 = 0;
+      break;
+   }
+
+   blob_write_uint32(blob, encoded.u32);
+}
+
+const glsl_type *
+decode_type_from_blob(struct blob_reader *blob)
+{
+   union packed_type encoded;
+   encoded.u32 = blob_read_uint32(blob);
+
+   if (encoded.u32 == 0) {
+      return NULL;
+   }
+
+   glsl_base_type base_type = (glsl_base_type) encoded.basic.base_type;
+
+   switch (base_type) {
+   case GLSL_TYPE_UINT:
+   case GLSL_TYPE_INT:
+   case GLSL_TYPE_FLOAT:
+   case GLSL_TYPE_FLOAT16:
+   case GLSL_TYPE_DOUBLE:
+   case GLSL_TYPE_UINT8:
+   case GLSL_TYPE_INT8:
+   case GLSL_TYPE_UINT16:
+   case GLSL_TYPE_INT16:
+   case GLSL_TYPE_UINT64:
+   case GLSL_TYPE_INT64:
+   case GLSL_TYPE_BOOL: {
+      unsigned explicit_stride = encoded.basic.explicit_stride;
+      if (explicit_stride == 0xfffff)
+         explicit_stride = blob_read_uint32(blob);
+      return glsl_type::get_instance(base_type, encoded.basic.vector_elements,
+                                     encoded.basic.matrix_columns,
+                                     explicit_stride,
+                                     encoded.basic.interface_row_major);
+   }
+   case GLSL_TYPE_SAMPLER:
+      return glsl_type::get_sampler_instance((enum glsl_sampler_dim)encoded.sampler.dimensionality,
+                                             encoded.sampler.shadow,
+                                             encoded.sampler.array,
+                                             (glsl_base_type) encoded.sampler.sampled_type);
+   case GLSL_TYPE_SUBROUTINE: {
+      const char *name = blob_read_string(blob);
+      return name ? glsl_type::get_subroutine_instance(name) : NULL;
+   }
+   case GLSL_TYPE_IMAGE:
+      return glsl_type::get_image_instance((enum glsl_sampler_dim)encoded.sampler.dimensionality,
+                                           encoded.sampler.array,
+                                           (glsl_base_type) encoded.sampler.sampled_type);
+   case GLSL_TYPE_ATOMIC_UINT:
+      return glsl_type::atomic_uint_type;
+   case GLSL_TYPE_ARRAY: {
+      unsigned length = encoded.array.length;
+      if (length == 0x1fff)
+         length = blob_read_uint32(blob);
+      unsigned explicit_stride = encoded.array.explicit_stride;
+      if (explicit_stride == 0x3fff)
+         explicit_stride = blob_read_uint32(blob);
+      const glsl_type *element_type = decode_type_from_blob(blob);
+      if (element_type == NULL)
+         return NULL;
+      return glsl_type::get_array_instance(element_type, length,
+                                           explicit_stride);
+   }
+   case GLSL_TYPE_STRUCT:
+   case GLSL_TYPE_INTERFACE: {
+      char *name = blob_read_string(blob);
+      unsigned num_fields = encoded.strct.length;
+      if (num_fields == 0xffffff)
+         num_fields = blob_read_uint32(blob);
+      if (name == NULL || blob->overrun)
+         return NULL;
+
+      size_t s_field_size, s_field_ptrs;
+      get_struct_type_field_and_pointer_sizes(&s_field_size, &s_field_ptrs);
+
+      glsl_struct_field *fields = new glsl_struct_field[num_fields];
+      for (unsigned i = 0; i < num_fields; i++) {
+         fields[i].type = decode_type_from_blob(blob);
+         fields[i].name = blob_read_string(blob);
+
+         blob_copy_bytes(blob, ((uint8_t *) &fields[i]) + s_field_ptrs,
+                         s_field_size - s_field_ptrs);
+
+         /* A truncated blob leaves the rest of the fields unusable. */
+         if (fields[i].type == NULL || fields[i].name == NULL) {
+            delete [] fields;
+            return NULL;
+         }
+      }
+
+      const glsl_type *t;
+      if (base_type == GLSL_TYPE_INTERFACE) {
+         enum glsl_interface_packing packing =
+            (glsl_interface_packing) encoded.strct.interface_packing_or_packed;
+         bool row_major = encoded.strct.interface_row_major;
+         t = glsl_type::get_interface_instance(fields, num_fields, packing,
+                                               row_major, name);
+      } else {
+         unsigned packed = encoded.strct.interface_packing_or_packed;
+         t = glsl_type::get_struct_instance(fields, num_fields, name, packed);
+      }
+
+      delete [] fields;
+      return t;
+   }
+   case GLSL_TYPE_VOID:
+      return glsl_type::void_type;
+   case GLSL_TYPE_ERROR:
+   default:
+      assert(!"Cannot decode type!");
+      return NULL;
+   }
+}
+
 unsigned
 glsl_type::cl_alignment() const
 {
@@ -55,6 +55,10 @@ glsl_type_singleton_decref();
 extern void
 _mesa_glsl_initialize_types(struct _mesa_glsl_parse_state *state);
 
+extern void
+_mesa_glsl_add_builtin_types(struct _mesa_glsl_parse_state *state,
+                             struct glsl_symbol_table *symbols);
+
 void encode_type_to_blob(struct blob *blob, const struct glsl_type *type);
 
 const struct glsl_type *decode_type_from_blob(struct blob_reader *blob);
@@ -1130,6 +1134,7 @@ public:
 
 private:
 
+   /** Mutex protecting the count of users of the type tables. */
    static mtx_t hash_mutex;
 
    /**
@@ -1167,23 +1172,23 @@ private:
    /** Constructor for subroutine types */
    glsl_type(const char *name);
 
-   /** Hash table containing the known explicit matrix and vector types. */
-   static struct hash_table *explicit_matrix_types;
+   /** Table containing the known explicit matrix and vector types. */
+   static struct glsl_type_table explicit_matrix_types;
 
-   /** Hash table containing the known array types. */
-   static struct hash_table *array_types;
+   /** Table containing the known array types. */
+   static struct glsl_type_table array_types;
 
-   /** Hash table containing the known struct types. */
-   static struct hash_table *struct_types;
+   /** Table containing the known struct types. */
+   static struct glsl_type_table struct_types;
 
-   /** Hash table containing the known interface types. */
-   static struct hash_table *interface_types;
+   /** Table containing the known interface types. */
+   static struct glsl_type_table interface_types;
 
-   /** Hash table containing the known subroutine types. */
-   static struct hash_table *subroutine_types;
+   /** Table containing the known subroutine types. */
+   static struct glsl_type_table subroutine_types;
 
-   /** Hash table containing the known function types. */
-   static struct hash_table *function_types;
+   /** Table containing the known function types. */
+   static struct glsl_type_table function_types;
 
    static bool record_key_compare(const void *a, const void *b);
    static unsigned record_key_hash(const void *key);
@@ -1210,6 +1215,8 @@ private:
    friend void glsl_type_singleton_init_or_ref(void);
    friend void glsl_type_singleton_decref(void);
    friend void _mesa_glsl_initialize_types(struct _mesa_glsl_parse_state *);
+   friend void _mesa_glsl_add_builtin_types(struct _mesa_glsl_parse_state *,
+                                            struct glsl_symbol_table *);
    /*@}*/
 };
 
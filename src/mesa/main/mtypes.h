@@ -3078,6 +3078,13 @@ struct gl_shader_program
     */
    struct gl_linked_shader *_LinkedShaders[MESA_SHADER_STAGES];
 
+   /**
+    * IR kept from the earlier links of this program, so that relinking it
+    * after some of its shaders were edited doesn't optimise the other stages
+    * again, or NULL.  See link_cache.h.
+    */
+   struct link_cache *LinkCache;
+
    /**
     * True if any of the fragment shaders attached to this program use:
     * #extension ARB_fragment_coord_conventions: enable
@@ -3180,6 +3187,7 @@ struct gl_shader_compiler_options
 
    GLuint MaxIfDepth;               /**< Maximum nested IF blocks */
    GLuint MaxUnrollIterations;
+   GLuint MaxUnrollBudget;          /**< Max unrolled loop size, in SPIR-V words */
 
    /**
     * Optimize code for array of structures backends.
@@ -3935,6 +3943,19 @@ struct gl_constants
     */
    bool GLSLOptimizeConservatively;
 
+   /**
+    * Convert each external declaration to HIR as soon as it is parsed, and
+    * release the AST of each function once it is converted, rather than
+    * keeping the AST of the whole shader alive next to its HIR.
+    */
+   bool GLSLStreamHIR;
+
+   /**
+    * Optimise the stages of a program that is being linked on threads of
+    * their own, up to where their varyings are linked.
+    */
+   bool GLSLParallelLink;
+
    /**
     * Whether to call lower_const_arrays_to_uniforms() during linking.
     */
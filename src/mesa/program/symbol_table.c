@@ -25,47 +25,60 @@
 #include "main/errors.h"
 #include "symbol_table.h"
 #include "../../util/hash_table.h"
+#include "util/ralloc.h"
+#include "util/set.h"
 #include "util/u_string.h"
 
-struct symbol {
-   /** Symbol name. */
-   char *name;
+struct _mesa_atom_table {
+   /** Interned strings, keyed by their contents. */
+   struct hash_table *strings;
 
-    /**
-     * Link to the next symbol in the table with the same name
-     *
-     * The linked list of symbols with the same name is ordered by scope
-     * from inner-most to outer-most.
-     */
-    struct symbol *next_with_same_name;
+   /** The same strings, keyed by their address. */
+   struct set *atoms;
 
-    /**
-     * Link to the next symbol in the table with the same scope
-     *
-     * The linked list of symbols with the same scope is unordered.  Symbols
-     * in this list my have unique names.
-     */
-    struct symbol *next_with_same_scope;
+   /**
+    * Read-only table whose atoms are returned in preference to new copies,
+    * so that names it knows can also be looked up by pointer in symbol
+    * tables built on \c parent.
+    */
+   const struct _mesa_atom_table *parent;
+};
 
-    /** Scope depth where this symbol was defined. */
-    unsigned depth;
+/**
+ * One declaration of a name
+ */
+struct symbol {
+   /** Scope depth where this symbol was defined. */
+   unsigned depth;
 
-    /**
-     * Arbitrary user supplied data.
-     */
-    void *data;
+   /**
+    * Arbitrary user supplied data.
+    */
+   void *data;
 };
 
+/** Number of declarations of a name that fit in its slot. */
+#define SYMBOL_SLOT_INLINE 2
 
 /**
- * Element of the scope stack.
+ * All declarations of one name that are currently visible
+ *
+ * The declarations form a stack ordered by depth, with the inner-most one on
+ * top.  Names are rarely shadowed more than once, so the stack normally lives
+ * in the slot itself and only moves to \c overflow when it outgrows it.
  */
-struct scope_level {
-    /** Link to next (inner) scope level. */
-    struct scope_level *next;
-    
-    /** Linked list of symbols with the same scope. */
-    struct symbol *symbols;
+struct symbol_slot {
+   /** Interned name, or NULL if the slot was never used. */
+   const char *name;
+
+   /** Number of declarations on the stack. */
+   unsigned count;
+
+   /** Size of \c overflow, or zero while the inline stack is used. */
+   unsigned capacity;
+
+   struct symbol *overflow;
+   struct symbol syms[SYMBOL_SLOT_INLINE];
 };
 
 
@@ -73,44 +86,261 @@ struct scope_level {
  *
  */
 struct _mesa_symbol_table {
-    /** Hash table containing all symbols in the symbol table. */
-    struct hash_table *ht;
+    /**
+     * Open-addressed table of every name that has been declared, keyed by
+     * atom.  Slots are never removed, so a name that goes out of scope just
+     * leaves an empty stack behind for its next declaration.
+     */
+    struct symbol_slot *slots;
+
+    /** Number of entries in \c slots, a power of two. */
+    unsigned size;
 
-    /** Top of scope stack. */
-    struct scope_level *current_scope;
+    /** Number of slots in use. */
+    unsigned entries;
+
+    /** Names of the symbols.  \c slots is keyed by these pointers. */
+    struct _mesa_atom_table *atoms;
+
+    /**
+     * Undo log of names declared in the open scopes, in declaration order.
+     * Popping a scope pops one declaration off each of the names it logged.
+     */
+    const char **undo;
+    unsigned undo_length;
+    unsigned undo_capacity;
+
+    /** Length of \c undo when each scope was pushed, indexed by depth. */
+    unsigned *scope_marks;
+    unsigned scope_capacity;
 
     /** Current scope depth. */
     unsigned depth;
 };
 
+struct _mesa_atom_table *
+_mesa_atom_table_ctor(void *mem_ctx)
+{
+   struct _mesa_atom_table *atoms = ralloc(mem_ctx, struct _mesa_atom_table);
+
+   atoms->strings = _mesa_string_hash_table_create(atoms);
+   atoms->atoms = _mesa_pointer_set_create(atoms);
+   atoms->parent = NULL;
+
+   return atoms;
+}
+
+
+void
+_mesa_atom_table_set_parent(struct _mesa_atom_table *atoms,
+                            const struct _mesa_atom_table *parent)
+{
+   atoms->parent = parent;
+}
+
+
+bool
+_mesa_atom_table_owns(const struct _mesa_atom_table *atoms, const char *str)
+{
+   return _mesa_set_search(atoms->atoms, str) != NULL;
+}
+
+
+static bool
+is_atom(const struct _mesa_atom_table *atoms, const char *str)
+{
+   return _mesa_set_search(atoms->atoms, str) != NULL ||
+          (atoms->parent != NULL &&
+           _mesa_set_search(atoms->parent->atoms, str) != NULL);
+}
+
+
+static const char *
+find_atom(const struct _mesa_atom_table *atoms, uint32_t hash,
+          const char *str, size_t len)
+{
+   struct hash_entry *entry = NULL;
+
+   if (atoms->parent != NULL)
+      entry = _mesa_hash_table_search_string_pre_hashed(atoms->parent->strings,
+                                                        hash, str, len);
+   if (entry == NULL)
+      entry = _mesa_hash_table_search_string_pre_hashed(atoms->strings,
+                                                        hash, str, len);
+
+   return entry ? (const char *) entry->key : NULL;
+}
+
+
+const char *
+_mesa_atom_table_find(struct _mesa_atom_table *atoms, const char *str)
+{
+   if (is_atom(atoms, str))
+      return str;
+
+   const size_t len = strlen(str);
+   return find_atom(atoms, _mesa_hash_string_with_length(str, len), str, len);
+}
+
+
+const char *
+_mesa_atom_table_intern(struct _mesa_atom_table *atoms, const char *str,
+                        size_t len)
+{
+   /* Strings that are atoms already are found by their contents like any
+    * other, so there's no need to look for \c str itself first.
+    */
+   const uint32_t hash = _mesa_hash_string_with_length(str, len);
+   const char *found = find_atom(atoms, hash, str, len);
+   if (found != NULL)
+      return found;
+
+   char *atom = ralloc_size(atoms, len + 1);
+   memcpy(atom, str, len);
+   atom[len] = '\0';
+
+   _mesa_hash_table_insert_pre_hashed(atoms->strings, hash, atom, NULL);
+   _mesa_set_add(atoms->atoms, atom);
+
+   return atom;
+}
+
+
+/**
+ * Return the atom for \c name.  Names given to the symbol table mostly come
+ * from the AST, where they are atoms already.
+ */
+static const char *
+intern_name(struct _mesa_atom_table *atoms, const char *name)
+{
+   if (is_atom(atoms, name))
+      return name;
+
+   return _mesa_atom_table_intern(atoms, name, strlen(name));
+}
+
+
+static inline struct symbol *
+slot_syms(struct symbol_slot *slot)
+{
+   return slot->overflow != NULL ? slot->overflow : slot->syms;
+}
+
+
+static struct symbol_slot *
+find_slot(const struct _mesa_symbol_table *table, const char *atom)
+{
+   const unsigned mask = table->size - 1;
+
+   for (unsigned i = _mesa_hash_pointer(atom) & mask; ; i = (i + 1) & mask) {
+      struct symbol_slot *const slot = &table->slots[i];
+
+      if (slot->name == atom || slot->name == NULL)
+         return slot;
+   }
+}
+
+
+static bool
+resize_slots(struct _mesa_symbol_table *table, unsigned size)
+{
+   struct symbol_slot *const old_slots = table->slots;
+   const unsigned old_size = table->size;
+
+   table->slots = rzalloc_array(table, struct symbol_slot, size);
+   if (table->slots == NULL) {
+      table->slots = old_slots;
+      _mesa_error_no_memory(__func__);
+      return false;
+   }
+
+   table->size = size;
+   for (unsigned i = 0; i < old_size; i++) {
+      if (old_slots[i].name != NULL)
+         *find_slot(table, old_slots[i].name) = old_slots[i];
+   }
+
+   ralloc_free(old_slots);
+   return true;
+}
+
+
+/**
+ * Return the slot for \c atom, claiming an empty one if there is none yet.
+ */
+static struct symbol_slot *
+get_slot(struct _mesa_symbol_table *table, const char *atom)
+{
+   struct symbol_slot *slot = find_slot(table, atom);
+
+   if (slot->name == NULL) {
+      /* Keep the load factor under 1/2 so that probe sequences stay short. */
+      if (2 * (table->entries + 1) > table->size) {
+         if (!resize_slots(table, table->size * 2))
+            return NULL;
+
+         slot = find_slot(table, atom);
+      }
+
+      slot->name = atom;
+      table->entries++;
+   }
+
+   return slot;
+}
+
+
+/**
+ * Make room for one more declaration on the stack of \c slot.
+ */
+static bool
+grow_slot(struct _mesa_symbol_table *table, struct symbol_slot *slot)
+{
+   const unsigned capacity = slot->capacity ? slot->capacity : SYMBOL_SLOT_INLINE;
+
+   if (slot->count < capacity)
+      return true;
+
+   struct symbol *syms = reralloc(table, slot->overflow, struct symbol,
+                                  capacity * 2);
+   if (syms == NULL) {
+      _mesa_error_no_memory(__func__);
+      return false;
+   }
+
+   if (slot->overflow == NULL)
+      memcpy(syms, slot->syms, sizeof(slot->syms));
+
+   slot->overflow = syms;
+   slot->capacity = capacity * 2;
+   return true;
+}
+
+
 void
 _mesa_symbol_table_pop_scope(struct _mesa_symbol_table *table)
 {
-    struct scope_level *const scope = table->current_scope;
-    struct symbol *sym = scope->symbols;
+    const unsigned mark = table->scope_marks[table->depth];
+
+    while (table->undo_length > mark) {
+       const char *const name = table->undo[--table->undo_length];
+       struct symbol_slot *const slot = find_slot(table, name);
+
+       /* Declarations in this scope are on top of the stack of their name.
+        * Globals added from inside the scope go to the bottom instead, and
+        * aren't logged.
+        */
+       assert(slot->count > 0 &&
+              slot_syms(slot)[slot->count - 1].depth == table->depth);
+       slot->count--;
+    }
 
-    table->current_scope = scope->next;
     table->depth--;
 
-    free(scope);
-
-    while (sym != NULL) {
-        struct symbol *const next = sym->next_with_same_scope;
-        struct hash_entry *hte = _mesa_hash_table_search(table->ht,
-                                                         sym->name);
-        if (sym->next_with_same_name) {
-           /* If there is a symbol with this name in an outer scope update
-            * the hash table to point to it.
-            */
-           hte->key = sym->next_with_same_name->name;
-           hte->data = sym->next_with_same_name;
-        } else {
-           _mesa_hash_table_remove(table->ht, hte);
-           free(sym->name);
-        }
-
-        free(sym);
-        sym = next;
+    /* Closing the outer-most scope also drops the global symbols. */
+    if (table->depth == 0) {
+       for (unsigned i = 0; i < table->size; i++)
+          table->slots[i].count = 0;
     }
 }
 
@@ -118,23 +348,42 @@ _mesa_symbol_table_pop_scope(struct _mesa_symbol_table *table)
 void
 _mesa_symbol_table_push_scope(struct _mesa_symbol_table *table)
 {
-    struct scope_level *const scope = calloc(1, sizeof(*scope));
-    if (scope == NULL) {
-       _mesa_error_no_memory(__func__);
-       return;
+    if (table->depth + 1 >= table->scope_capacity) {
+       const unsigned capacity = MAX2(table->scope_capacity * 2, 16);
+       unsigned *marks = reralloc(table, table->scope_marks, unsigned,
+                                  capacity);
+       if (marks == NULL) {
+          _mesa_error_no_memory(__func__);
+          return;
+       }
+
+       table->scope_marks = marks;
+       table->scope_capacity = capacity;
     }
 
-    scope->next = table->current_scope;
-    table->current_scope = scope;
     table->depth++;
+    table->scope_marks[table->depth] = table->undo_length;
 }
 
 
 static struct symbol *
 find_symbol(struct _mesa_symbol_table *table, const char *name)
 {
-   struct hash_entry *entry = _mesa_hash_table_search(table->ht, name);
-   return entry ? (struct symbol *) entry->data : NULL;
+   struct symbol_slot *slot = find_slot(table, name);
+
+   /* Names that come from the lexer are already atoms, and are found with a
+    * single pointer lookup.  Other copies of the string have to be mapped to
+    * the atom first.
+    */
+   if (slot->name == NULL) {
+      const char *atom = _mesa_atom_table_find(table->atoms, name);
+      if (atom == NULL || atom == name)
+         return NULL;
+
+      slot = find_slot(table, atom);
+   }
+
+   return slot->count != 0 ? &slot_syms(slot)[slot->count - 1] : NULL;
 }
 
 
@@ -177,38 +426,34 @@ int
 _mesa_symbol_table_add_symbol(struct _mesa_symbol_table *table,
                               const char *name, void *declaration)
 {
-   struct symbol *new_sym;
    struct symbol *sym = find_symbol(table, name);
 
    if (sym && sym->depth == table->depth)
       return -1;
 
-   new_sym = calloc(1, sizeof(*sym));
-   if (new_sym == NULL) {
-      _mesa_error_no_memory(__func__);
-      return -1;
-   }
-
-   if (sym) {
-      /* Store link to symbol in outer scope with the same name */
-      new_sym->next_with_same_name = sym;
-      new_sym->name = sym->name;
-   } else {
-      new_sym->name = strdup(name);
-      if (new_sym->name == NULL) {
-         free(new_sym);
+   if (table->undo_length == table->undo_capacity) {
+      const unsigned capacity = MAX2(table->undo_capacity * 2, 64);
+      const char **undo = reralloc(table, table->undo, const char *,
+                                   capacity);
+      if (undo == NULL) {
          _mesa_error_no_memory(__func__);
          return -1;
       }
+
+      table->undo = undo;
+      table->undo_capacity = capacity;
    }
 
-   new_sym->next_with_same_scope = table->current_scope->symbols;
-   new_sym->data = declaration;
-   new_sym->depth = table->depth;
+   const char *const atom = intern_name(table->atoms, name);
+   struct symbol_slot *const slot = get_slot(table, atom);
+   if (slot == NULL || !grow_slot(table, slot))
+      return -1;
 
-   table->current_scope->symbols = new_sym;
+   sym = &slot_syms(slot)[slot->count++];
+   sym->depth = table->depth;
+   sym->data = declaration;
 
-   _mesa_hash_table_insert(table->ht, new_sym->name, new_sym);
+   table->undo[table->undo_length++] = atom;
 
    return 0;
 }
@@ -232,54 +477,26 @@ int
 _mesa_symbol_table_add_global_symbol(struct _mesa_symbol_table *table,
                                      const char *name, void *declaration)
 {
-   struct scope_level *top_scope;
-   struct symbol *inner_sym = NULL;
-   struct symbol *sym = find_symbol(table, name);
-
-   while (sym) {
-      if (sym->depth == 0)
-         return -1;
-
-      inner_sym = sym;
-
-      /* Get symbol from the outer scope with the same name */
-      sym = sym->next_with_same_name;
-   }
-
-   /* Find the top-level scope */
-   for (top_scope = table->current_scope; top_scope->next != NULL;
-        top_scope = top_scope->next) {
-      /* empty */
-   }
-
-   sym = calloc(1, sizeof(*sym));
-   if (sym == NULL) {
-      _mesa_error_no_memory(__func__);
+   const char *const atom = intern_name(table->atoms, name);
+   struct symbol_slot *const slot = get_slot(table, atom);
+   if (slot == NULL)
       return -1;
-   }
 
-   if (inner_sym) {
-      /* In case we add the global out of order store a link to the global
-       * symbol in global.
-       */
-      inner_sym->next_with_same_name = sym;
-
-      sym->name = inner_sym->name;
-   } else {
-      sym->name = strdup(name);
-      if (sym->name == NULL) {
-         free(sym);
-         _mesa_error_no_memory(__func__);
-         return -1;
-      }
-   }
+   /* Globals are at the bottom of the stack, below any declarations of the
+    * same name in the scopes that are open.
+    */
+   if (slot->count != 0 && slot_syms(slot)[0].depth == 0)
+      return -1;
 
-   sym->next_with_same_scope = top_scope->symbols;
-   sym->data = declaration;
+   if (!grow_slot(table, slot))
+      return -1;
 
-   top_scope->symbols = sym;
+   struct symbol *const syms = slot_syms(slot);
+   memmove(&syms[1], &syms[0], slot->count * sizeof(*syms));
+   slot->count++;
 
-   _mesa_hash_table_insert(table->ht, sym->name, sym);
+   syms[0].depth = 0;
+   syms[0].data = declaration;
 
    return 0;
 }
@@ -289,11 +506,23 @@ _mesa_symbol_table_add_global_symbol(struct _mesa_symbol_table *table,
 struct _mesa_symbol_table *
 _mesa_symbol_table_ctor(void)
 {
-    struct _mesa_symbol_table *table = calloc(1, sizeof(*table));
+    return _mesa_symbol_table_ctor_with_atoms(NULL);
+}
+
+
+struct _mesa_symbol_table *
+_mesa_symbol_table_ctor_with_atoms(struct _mesa_atom_table *atoms)
+{
+    struct _mesa_symbol_table *table = rzalloc(NULL, struct _mesa_symbol_table);
 
     if (table != NULL) {
-       table->ht = _mesa_hash_table_create(NULL, _mesa_hash_string,
-                                           _mesa_key_string_equal);
+       table->size = 32;
+       table->slots = rzalloc_array(table, struct symbol_slot, table->size);
+
+       /* A table without a shared atom table gets a private one, which goes
+        * away with it.
+        */
+       table->atoms = atoms != NULL ? atoms : _mesa_atom_table_ctor(table);
 
        _mesa_symbol_table_push_scope(table);
     }
@@ -305,10 +534,5 @@ _mesa_symbol_table_ctor(void)
 void
 _mesa_symbol_table_dtor(struct _mesa_symbol_table *table)
 {
-   while (table->current_scope != NULL) {
-      _mesa_symbol_table_pop_scope(table);
-   }
-
-   _mesa_hash_table_destroy(table->ht, NULL);
-   free(table);
+   ralloc_free(table);
 }
@@ -23,12 +23,55 @@
 #ifndef MESA_SYMBOL_TABLE_H
 #define MESA_SYMBOL_TABLE_H
 
+#include <stdbool.h>
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 struct _mesa_symbol_table;
 
+/**
+ * Set of interned identifier strings ("atoms")
+ *
+ * Every distinct string is stored once, so atoms can be hashed and compared
+ * by address.  Symbol tables key their symbols on atoms; a table can share
+ * its atom table with the lexer so that identifiers are looked up without
+ * hashing their characters again.
+ */
+struct _mesa_atom_table;
+
+extern struct _mesa_atom_table *_mesa_atom_table_ctor(void *mem_ctx);
+
+/**
+ * Return the atom for the \c len characters at \c str, adding a copy of
+ * them if there is none yet.  \c str needn't be NUL-terminated.
+ */
+extern const char *_mesa_atom_table_intern(struct _mesa_atom_table *atoms,
+                                           const char *str, size_t len);
+
+/**
+ * Return the atom for \c str, or NULL if it was never interned.
+ */
+extern const char *_mesa_atom_table_find(struct _mesa_atom_table *atoms,
+                                         const char *str);
+
+/**
+ * Whether \c str is an atom that \c atoms added itself, rather than one it
+ * found in its parent.
+ */
+extern bool _mesa_atom_table_owns(const struct _mesa_atom_table *atoms,
+                                  const char *str);
+
+/**
+ * Make \c atoms return the atoms of \c parent for the strings it holds.
+ * \c parent is only read, so it may be shared by several tables.
+ */
+extern void
+_mesa_atom_table_set_parent(struct _mesa_atom_table *atoms,
+                            const struct _mesa_atom_table *parent);
+
 extern void _mesa_symbol_table_push_scope(struct _mesa_symbol_table *table);
 
 extern void _mesa_symbol_table_pop_scope(struct _mesa_symbol_table *table);
@@ -53,6 +96,9 @@ extern void *_mesa_symbol_table_find_symbol(struct _mesa_symbol_table *symtab,
 
 extern struct _mesa_symbol_table *_mesa_symbol_table_ctor(void);
 
+extern struct _mesa_symbol_table *
+_mesa_symbol_table_ctor_with_atoms(struct _mesa_atom_table *atoms);
+
 extern void _mesa_symbol_table_dtor(struct _mesa_symbol_table *);
 
 #ifdef __cplusplus
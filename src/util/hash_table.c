@@ -125,6 +125,23 @@ entry_is_present(const struct hash_table *ht, struct hash_entry *entry)
    return entry->key != NULL && entry->key != ht->deleted_key;
 }
 
+/**
+ * Whether the keys of \p ht are counted strings (see
+ * _mesa_string_hash_table_create()), whose lengths are kept in the entries
+ * so that a search can skip keys of another length without looking at them.
+ */
+static bool
+has_string_keys(const struct hash_table *ht)
+{
+   return ht->key_hash_function == _mesa_hash_counted_string;
+}
+
+static uint32_t
+key_length(const struct hash_table *ht, const void *key)
+{
+   return has_string_keys(ht) ? strlen((const char *) key) : 0;
+}
+
 bool
 _mesa_hash_table_init(struct hash_table *ht,
                       void *mem_ctx,
@@ -307,13 +324,69 @@ _mesa_hash_table_search_pre_hashed(struct hash_table *ht, uint32_t hash,
    return hash_table_search(ht, hash, key);
 }
 
+static struct hash_entry *
+hash_table_search_string(struct hash_table *ht, uint32_t hash,
+                         const char *key, unsigned length)
+{
+   assert(has_string_keys(ht));
+
+   uint32_t size = ht->size;
+   uint32_t start_hash_address = util_fast_urem32(hash, size, ht->size_magic);
+   uint32_t double_hash = 1 + util_fast_urem32(hash, ht->rehash,
+                                               ht->rehash_magic);
+   uint32_t hash_address = start_hash_address;
+
+   do {
+      struct hash_entry *entry = ht->table + hash_address;
+
+      if (entry_is_free(entry)) {
+         return NULL;
+      } else if (entry->hash == hash && entry->key_length == length &&
+                 entry_is_present(ht, entry) &&
+                 memcmp(entry->key, key, length) == 0) {
+         return entry;
+      }
+
+      hash_address += double_hash;
+      if (hash_address >= size)
+         hash_address -= size;
+   } while (hash_address != start_hash_address);
+
+   return NULL;
+}
+
+/**
+ * Finds the entry of a string key, given as the \p length characters at
+ * \p key, which needn't be NUL-terminated.
+ *
+ * The table must have been created with _mesa_string_hash_table_create().
+ * Only entries whose hash and length both match have their key compared.
+ */
+struct hash_entry *
+_mesa_hash_table_search_string(struct hash_table *ht, const char *key,
+                               unsigned length)
+{
+   return hash_table_search_string(ht,
+                                   _mesa_hash_string_with_length(key, length),
+                                   key, length);
+}
+
+struct hash_entry *
+_mesa_hash_table_search_string_pre_hashed(struct hash_table *ht,
+                                          uint32_t hash, const char *key,
+                                          unsigned length)
+{
+   assert(hash == _mesa_hash_string_with_length(key, length));
+   return hash_table_search_string(ht, hash, key, length);
+}
+
 static struct hash_entry *
 hash_table_insert(struct hash_table *ht, uint32_t hash,
                   const void *key, void *data);
 
 static void
 hash_table_insert_rehash(struct hash_table *ht, uint32_t hash,
-                         const void *key, void *data)
+                         uint32_t key_length, const void *key, void *data)
 {
    uint32_t size = ht->size;
    uint32_t start_hash_address = util_fast_urem32(hash, size, ht->size_magic);
@@ -325,6 +398,7 @@ hash_table_insert_rehash(struct hash_table *ht, uint32_t hash,
 
       if (likely(entry->key == NULL)) {
          entry->hash = hash;
+         entry->key_length = key_length;
          entry->key = key;
          entry->data = data;
          return;
@@ -363,7 +437,8 @@ _mesa_hash_table_rehash(struct hash_table *ht, unsigned new_size_index)
    ht->deleted_entries = 0;
 
    hash_table_foreach(&old_ht, entry) {
-      hash_table_insert_rehash(ht, entry->hash, entry->key, entry->data);
+      hash_table_insert_rehash(ht, entry->hash, entry->key_length,
+                               entry->key, entry->data);
    }
 
    ht->entries = old_ht.entries;
@@ -429,6 +504,7 @@ hash_table_insert(struct hash_table *ht, uint32_t hash,
       if (entry_is_deleted(ht, available_entry))
          ht->deleted_entries--;
       available_entry->hash = hash;
+      available_entry->key_length = key_length(ht, key);
       available_entry->key = key;
       available_entry->data = data;
       ht->entries++;
@@ -588,6 +664,48 @@ _mesa_hash_string(const void *_key)
    return hash;
 }
 
+/* Strings shorter than this are hashed with FNV-1a, which costs less than
+ * xxHash's setup for the identifiers that most keys are.
+ */
+#define SHORT_STRING_LENGTH 16
+
+/**
+ * Hash of the \p length characters at \p key, which needn't be
+ * NUL-terminated.  Short strings are hashed with FNV-1a, like
+ * _mesa_hash_string() does, and longer ones with xxHash, which takes them a
+ * word at a time.
+ */
+uint32_t
+_mesa_hash_string_with_length(const void *_key, unsigned length)
+{
+   const char *key = _key;
+
+   if (length < SHORT_STRING_LENGTH) {
+      uint32_t hash = _mesa_fnv32_1a_offset_bias;
+
+      for (unsigned i = 0; i < length; i++)
+         hash = _mesa_fnv32_1a_accumulate(hash, key[i]);
+
+      return hash;
+   }
+
+#if defined(_WIN64) || defined(__x86_64__)
+   return (uint32_t) XXH64(key, length, 0);
+#else
+   return XXH32(key, length, 0);
+#endif
+}
+
+/**
+ * Key hash function of tables of counted strings: the hash
+ * _mesa_hash_string_with_length() gives the same characters.
+ */
+uint32_t
+_mesa_hash_counted_string(const void *key)
+{
+   return _mesa_hash_string_with_length(key, strlen((const char *) key));
+}
+
 uint32_t
 _mesa_hash_pointer(const void *pointer)
 {
@@ -640,6 +758,22 @@ _mesa_pointer_hash_table_create(void *mem_ctx)
                                   _mesa_key_pointer_equal);
 }
 
+/**
+ * Helper to create a hash table of counted strings.
+ *
+ * The keys are kept with their length as well as their hash, so they can
+ * be looked up with _mesa_hash_table_search_string().  Tables that are only
+ * searched by NUL-terminated keys, like glcpp's macro table, gain nothing
+ * from that and should hash them with _mesa_hash_string() instead, which
+ * needn't measure the key first.
+ */
+struct hash_table *
+_mesa_string_hash_table_create(void *mem_ctx)
+{
+   return _mesa_hash_table_create(mem_ctx, _mesa_hash_counted_string,
+                                  _mesa_key_string_equal);
+}
+
 /**
  * Hash table wrapper which supports 64-bit keys.
  *
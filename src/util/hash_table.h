@@ -41,6 +41,13 @@ extern "C" {
 
 struct hash_entry {
    uint32_t hash;
+
+   /**
+    * Length of the key in tables of strings (see
+    * _mesa_string_hash_table_create()), zero in other tables.
+    */
+   uint32_t key_length;
+
    const void *key;
    void *data;
 };
@@ -97,6 +104,13 @@ _mesa_hash_table_search(struct hash_table *ht, const void *key);
 struct hash_entry *
 _mesa_hash_table_search_pre_hashed(struct hash_table *ht, uint32_t hash,
                                   const void *key);
+struct hash_entry *
+_mesa_hash_table_search_string(struct hash_table *ht, const char *key,
+                               unsigned length);
+struct hash_entry *
+_mesa_hash_table_search_string_pre_hashed(struct hash_table *ht,
+                                          uint32_t hash, const char *key,
+                                          unsigned length);
 void _mesa_hash_table_remove(struct hash_table *ht,
                              struct hash_entry *entry);
 void _mesa_hash_table_remove_key(struct hash_table *ht,
@@ -114,6 +128,8 @@ uint32_t _mesa_hash_int(const void *key);
 uint32_t _mesa_hash_uint(const void *key);
 uint32_t _mesa_hash_u32(const void *key);
 uint32_t _mesa_hash_string(const void *key);
+uint32_t _mesa_hash_string_with_length(const void *key, unsigned length);
+uint32_t _mesa_hash_counted_string(const void *key);
 uint32_t _mesa_hash_pointer(const void *pointer);
 
 bool _mesa_key_int_equal(const void *a, const void *b);
@@ -125,6 +141,9 @@ bool _mesa_key_pointer_equal(const void *a, const void *b);
 struct hash_table *
 _mesa_pointer_hash_table_create(void *mem_ctx);
 
+struct hash_table *
+_mesa_string_hash_table_create(void *mem_ctx);
+
 /**
  * This foreach function is safe against deletion (which just replaces
  * an entry's data with the deleted marker), but not against insertion
@@ -0,0 +1,174 @@
+/*
+ * Copyright © 2026 xxGLSLCompiler contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "os_file.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+char *
+os_read_file(const char *filename, size_t *size)
+{
+   FILE *fp = fopen(filename, "rb");
+   if (fp == NULL)
+      return NULL;
+
+   char *buf = NULL;
+   long len = -1;
+
+   if (fseek(fp, 0L, SEEK_END) == 0)
+      len = ftell(fp);
+
+   if (len >= 0 && fseek(fp, 0L, SEEK_SET) == 0) {
+      buf = malloc(len + 1);
+      if (buf != NULL && fread(buf, 1, len, fp) != (size_t) len) {
+         free(buf);
+         buf = NULL;
+      } else if (buf != NULL) {
+         buf[len] = '\0';
+         if (size)
+            *size = len;
+      }
+   }
+
+   fclose(fp);
+
+   return buf;
+}
+
+#ifdef _WIN32
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+const char *
+os_map_text_file(const char *filename, size_t *size)
+{
+   HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+                             OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+   if (file == INVALID_HANDLE_VALUE)
+      return NULL;
+
+   const char *data = NULL;
+   LARGE_INTEGER length;
+   SYSTEM_INFO info;
+   GetSystemInfo(&info);
+
+   if (GetFileSizeEx(file, &length) && length.QuadPart > 0 &&
+       (ULONGLONG) length.QuadPart <= (SIZE_T) -1 &&
+       length.QuadPart % info.dwPageSize != 0) {
+      HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0,
+                                          NULL);
+      if (mapping != NULL) {
+         data = (const char *) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+         /* The view keeps the mapping object alive. */
+         CloseHandle(mapping);
+      }
+   }
+
+   CloseHandle(file);
+
+   if (data != NULL)
+      *size = (size_t) length.QuadPart;
+
+   return data;
+}
+
+void
+os_unmap_file(const char *data, size_t size)
+{
+   (void) size;
+   UnmapViewOfFile(data);
+}
+
+char *
+os_read_executable(size_t *size)
+{
+   char path[MAX_PATH];
+   DWORD length = GetModuleFileNameA(NULL, path, sizeof(path));
+
+   if (length == 0 || length == sizeof(path))
+      return NULL;
+
+   return os_read_file(path, size);
+}
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __APPLE__
+#include <mach-o/dyld.h>
+#endif
+
+const char *
+os_map_text_file(const char *filename, size_t *size)
+{
+   int fd = open(filename, O_RDONLY);
+   if (fd < 0)
+      return NULL;
+
+   const char *data = NULL;
+   struct stat st;
+   long page_size = sysconf(_SC_PAGESIZE);
+
+   if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 &&
+       page_size > 0 && st.st_size % page_size != 0) {
+      void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map != MAP_FAILED)
+         data = (const char *) map;
+   }
+
+   close(fd);
+
+   if (data != NULL)
+      *size = st.st_size;
+
+   return data;
+}
+
+void
+os_unmap_file(const char *data, size_t size)
+{
+   munmap((void *) data, size);
+}
+
+char *
+os_read_executable(size_t *size)
+{
+#ifdef __APPLE__
+   char path[4096];
+   uint32_t length = sizeof(path);
+
+   if (_NSGetExecutablePath(path, &length) != 0)
+      return NULL;
+
+   return os_read_file(path, size);
+#else
+   return os_read_file("/proc/self/exe", size);
+#endif
+}
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * Copyright © 2026 xxGLSLCompiler contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * \file os_file.h
+ *
+ * Reading whole files, mapped read-only or into memory.
+ */
+
+#ifndef _OS_FILE_H
+#define _OS_FILE_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Map the whole of \p filename read-only, storing its length in \p size.
+ *
+ * The mapping is only made when the last page of the file has room left
+ * after the final byte.  The system fills the rest of that page with zeros,
+ * so the returned text is always NUL-terminated.  Returns NULL if the file
+ * can't be opened or mapped, is empty, or ends exactly on a page boundary;
+ * the caller is expected to fall back to reading it.
+ */
+const char *
+os_map_text_file(const char *filename, size_t *size);
+
+/**
+ * Release a mapping made by os_map_text_file().
+ */
+void
+os_unmap_file(const char *data, size_t size);
+
+/**
+ * Read the whole of \p filename as binary into a buffer that the caller
+ * must free(), storing its length in \p size if that isn't NULL.
+ *
+ * The buffer has a NUL terminator after the last byte of the file.  Returns
+ * NULL if the file can't be opened or read.
+ */
+char *
+os_read_file(const char *filename, size_t *size);
+
+/**
+ * Read the executable of the running process like os_read_file(), or return
+ * NULL if it can't be found.
+ */
+char *
+os_read_executable(size_t *size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _OS_FILE_H */
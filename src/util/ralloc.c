@@ -35,6 +35,7 @@ _CRTIMP int _vscprintf(const char *format, va_list argptr);
 #endif
 
 #include "ralloc.h"
+#include "simple_mtx.h"
 
 #ifndef va_copy
 #ifdef __va_copy
@@ -45,6 +46,8 @@ _CRTIMP int _vscprintf(const char *format, va_list argptr);
 #endif
 
 #define CANARY 0x5A1106
+#define TRACKED_CANARY 0x5A1107
+#define ARENA_CANARY 0xA7E4A
 
 /* Align the header's size so that ralloc() allocations will return with the
  * same alignment as a libc malloc would have (8 on 32-bit GLIBC, 16 on
@@ -61,11 +64,6 @@ struct
 #endif
    ralloc_header
 {
-#ifndef NDEBUG
-   /* A canary value used to determine whether a pointer is ralloc'd. */
-   unsigned canary;
-#endif
-
    struct ralloc_header *parent;
 
    /* The first child (head of a linked list) */
@@ -76,24 +74,117 @@ struct
    struct ralloc_header *next;
 
    void (*destructor)(void *);
+
+   /* A canary value used to determine whether a pointer is ralloc'd.  It
+    * must be the last field, right in front of the allocation: the 32 bits
+    * there are never ARENA_CANARY, whatever the byte order.
+    */
+   uintptr_t canary;
 };
 
 typedef struct ralloc_header ralloc_header;
 
+/* Header of an allocation carved out of an arena's linear buffers.  It only
+ * remembers the parent it was allocated with, so ralloc_parent() and
+ * ralloc_steal() keep working, but there are no child or sibling links:
+ * nothing is freed before the arena is.  Destructors are rare, so they are
+ * kept in a list of the arena's, and only flagged in the size.
+ */
+struct arena_header
+{
+   const void *parent;
+   struct ralloc_arena *arena;
+   uint32_t size;
+   uint32_t canary;
+};
+
+#define ARENA_SIZE_MASK 0x7fffffffu
+#define ARENA_HAS_DESTRUCTOR 0x80000000u
+
+typedef struct arena_header arena_header;
+
+/* Blocks allocated while accounting is enabled are preceded by this, and
+ * their header has TRACKED_CANARY.  It keeps the header's alignment.
+ */
+struct
+#ifdef _MSC_VER
+ __declspec(align(8))
+#elif defined(__LP64__)
+ __attribute__((aligned(16)))
+#else
+ __attribute__((aligned(8)))
+#endif
+   ralloc_tracking
+{
+   size_t size;
+   const char *site;
+
+   /* Only set on blocks without a parent. */
+   struct ralloc_root *root;
+};
+
+typedef struct ralloc_tracking ralloc_tracking;
+
+#define TRACKING(info) (((ralloc_tracking *) (info)) - 1)
+
 static void unlink_block(ralloc_header *info);
 static void unsafe_free(ralloc_header *info);
 
+static struct ralloc_arena *find_arena(const void *ctx);
+static void *arena_alloc(struct ralloc_arena *arena, const void *parent,
+                         size_t size);
+static void *arena_resize(void *ptr, size_t size);
+static void arena_steal(const void *new_ctx, void *ptr);
+static void arena_set_destructor(void *ptr, void(*destructor)(void *));
+static void arena_free(void *ptr);
+static struct arena_destructor *find_destructor(struct ralloc_arena *arena,
+                                                const arena_header *info);
+static void destroy_arena(void *ptr);
+
+static bool stats_enabled;
+static void track_block(ralloc_header *info, size_t size);
+static void track_resize(ralloc_header *info, size_t old_size);
+static void track_move(ralloc_header *info, const ralloc_header *new_parent);
+static void track_free(ralloc_header *info);
+static void track_arena_alloc(struct ralloc_arena *arena);
+
+static bool
+is_arena_child(const void *ptr)
+{
+   STATIC_ASSERT(offsetof(ralloc_header, canary) + sizeof(uintptr_t) ==
+                 sizeof(ralloc_header));
+   STATIC_ASSERT(offsetof(arena_header, canary) + sizeof(uint32_t) ==
+                 sizeof(arena_header));
+
+   return ((const uint32_t *) ptr)[-1] == ARENA_CANARY;
+}
+
+#define ARENA_HEADER(ptr) (((arena_header *) (ptr)) - 1)
+
 static ralloc_header *
 get_header(const void *ptr)
 {
    ralloc_header *info = (ralloc_header *) (((char *) ptr) -
 					    sizeof(ralloc_header));
-   assert(info->canary == CANARY);
+   assert(info->canary == CANARY || info->canary == TRACKED_CANARY);
    return info;
 }
 
 #define PTR_FROM_HEADER(info) (((char *) info) + sizeof(ralloc_header))
 
+static bool
+is_tracked(const ralloc_header *info)
+{
+   return info->canary == TRACKED_CANARY;
+}
+
+/* The start of the malloc'ed block holding \p info. */
+static void *
+block_of(ralloc_header *info)
+{
+   return is_tracked(info) ? (void *) TRACKING(info) : (void *) info;
+}
+
 static void
 add_child(ralloc_header *parent, ralloc_header *info)
 {
@@ -113,17 +204,20 @@ ralloc_context(const void *ctx)
    return ralloc_size(ctx, 0);
 }
 
-void *
-ralloc_size(const void *ctx, size_t size)
+static void *
+ralloc_block(ralloc_header *parent, size_t size)
 {
-   void *block = malloc(size + sizeof(ralloc_header));
+   const bool tracked = stats_enabled;
+   void *block;
    ralloc_header *info;
-   ralloc_header *parent;
 
+   block = malloc(size + sizeof(ralloc_header) +
+                  (tracked ? sizeof(ralloc_tracking) : 0));
    if (unlikely(block == NULL))
       return NULL;
 
-   info = (ralloc_header *) block;
+   info = tracked ? (ralloc_header *) ((ralloc_tracking *) block + 1) :
+                    (ralloc_header *) block;
    /* measurements have shown that calloc is slower (because of
     * the multiplication overflow checking?), so clear things
     * manually
@@ -134,17 +228,27 @@ ralloc_size(const void *ctx, size_t size)
    info->next = NULL;
    info->destructor = NULL;
 
-   parent = ctx != NULL ? get_header(ctx) : NULL;
-
    add_child(parent, info);
 
-#ifndef NDEBUG
-   info->canary = CANARY;
-#endif
+   info->canary = tracked ? TRACKED_CANARY : CANARY;
+   if (tracked)
+      track_block(info, size);
 
    return PTR_FROM_HEADER(info);
 }
 
+void *
+ralloc_size(const void *ctx, size_t size)
+{
+   if (ctx != NULL) {
+      struct ralloc_arena *arena = find_arena(ctx);
+      if (arena != NULL)
+         return arena_alloc(arena, ctx, size);
+   }
+
+   return ralloc_block(ctx != NULL ? get_header(ctx) : NULL, size);
+}
+
 void *
 rzalloc_size(const void *ctx, size_t size)
 {
@@ -161,9 +265,26 @@ static void *
 resize(void *ptr, size_t size)
 {
    ralloc_header *child, *old, *info;
+   size_t old_size = 0;
+
+   if (is_arena_child(ptr))
+      return arena_resize(ptr, size);
 
    old = get_header(ptr);
-   info = realloc(old, size + sizeof(ralloc_header));
+   if (is_tracked(old)) {
+      ralloc_tracking *block;
+
+      old_size = TRACKING(old)->size;
+      block = realloc(TRACKING(old), sizeof(ralloc_tracking) +
+                                     sizeof(ralloc_header) + size);
+      if (block == NULL)
+         return NULL;
+
+      block->size = size;
+      info = (ralloc_header *) (block + 1);
+   } else {
+      info = realloc(old, size + sizeof(ralloc_header));
+   }
 
    if (info == NULL)
       return NULL;
@@ -184,6 +305,9 @@ resize(void *ptr, size_t size)
    for (child = info->child; child != NULL; child = child->next)
       child->parent = info;
 
+   if (is_tracked(info))
+      track_resize(info, old_size);
+
    return PTR_FROM_HEADER(info);
 }
 
@@ -257,7 +381,14 @@ ralloc_free(void *ptr)
    if (ptr == NULL)
       return;
 
+   if (is_arena_child(ptr)) {
+      arena_free(ptr);
+      return;
+   }
+
    info = get_header(ptr);
+   if (stats_enabled)
+      track_free(info);
    unlink_block(info);
    unsafe_free(info);
 }
@@ -286,6 +417,15 @@ unsafe_free(ralloc_header *info)
 {
    /* Recursively free any children...don't waste time unlinking them. */
    ralloc_header *temp;
+
+   /* An arena runs the destructors of what was allocated from it, which
+    * lives in the buffers that are its children, so it goes first.
+    */
+   if (info->destructor == destroy_arena) {
+      info->destructor = NULL;
+      destroy_arena(PTR_FROM_HEADER(info));
+   }
+
    while (info->child != NULL) {
       temp = info->child;
       info->child = temp->next;
@@ -296,7 +436,7 @@ unsafe_free(ralloc_header *info)
    if (info->destructor != NULL)
       info->destructor(PTR_FROM_HEADER(info));
 
-   free(info);
+   free(block_of(info));
 }
 
 void
@@ -307,9 +447,21 @@ ralloc_steal(const void *new_ctx, void *ptr)
    if (unlikely(ptr == NULL))
       return;
 
+   if (is_arena_child(ptr)) {
+      arena_steal(new_ctx, ptr);
+      return;
+   }
+
+   /* A block stolen into an arena hangs off the arena itself. */
+   if (new_ctx != NULL && is_arena_child(new_ctx))
+      new_ctx = ARENA_HEADER(new_ctx)->arena;
+
    info = get_header(ptr);
    parent = new_ctx ? get_header(new_ctx) : NULL;
 
+   if (stats_enabled)
+      track_move(info, parent);
+
    unlink_block(info);
 
    add_child(parent, info);
@@ -323,6 +475,12 @@ ralloc_adopt(const void *new_ctx, void *old_ctx)
    if (unlikely(old_ctx == NULL))
       return;
 
+   /* Arena children don't keep track of what was allocated off of them. */
+   assert(!is_arena_child(old_ctx));
+
+   if (is_arena_child(new_ctx))
+      new_ctx = ARENA_HEADER(new_ctx)->arena;
+
    old_info = get_header(old_ctx);
    new_info = get_header(new_ctx);
 
@@ -330,6 +488,11 @@ ralloc_adopt(const void *new_ctx, void *old_ctx)
    if (unlikely(old_info->child == NULL))
       return;
 
+   if (stats_enabled) {
+      for (child = old_info->child; child != NULL; child = child->next)
+         track_move(child, new_info);
+   }
+
    /* Set all the children's parent to new_ctx; get a pointer to the last child. */
    for (child = old_info->child; child->next != NULL; child = child->next) {
       child->parent = new_info;
@@ -352,6 +515,9 @@ ralloc_parent(const void *ptr)
    if (unlikely(ptr == NULL))
       return NULL;
 
+   if (is_arena_child(ptr))
+      return (void *) ARENA_HEADER(ptr)->parent;
+
    info = get_header(ptr);
    return info->parent ? PTR_FROM_HEADER(info->parent) : NULL;
 }
@@ -359,7 +525,14 @@ ralloc_parent(const void *ptr)
 void
 ralloc_set_destructor(const void *ptr, void(*destructor)(void *))
 {
-   ralloc_header *info = get_header(ptr);
+   ralloc_header *info;
+
+   if (is_arena_child(ptr)) {
+      arena_set_destructor((void *) ptr, destructor);
+      return;
+   }
+
+   info = get_header(ptr);
    info->destructor = destructor;
 }
 
@@ -635,7 +808,12 @@ create_linear_node(void *ralloc_ctx, unsigned min_size)
    if (likely(min_size < MIN_LINEAR_BUFSIZE))
       min_size = MIN_LINEAR_BUFSIZE;
 
-   node = ralloc_size(ralloc_ctx, sizeof(linear_header) + min_size);
+   /* An arena's own buffers are plain children of it. */
+   if (ralloc_ctx != NULL && find_arena(ralloc_ctx) == ralloc_ctx)
+      node = ralloc_block(get_header(ralloc_ctx),
+                          sizeof(linear_header) + min_size);
+   else
+      node = ralloc_size(ralloc_ctx, sizeof(linear_header) + min_size);
    if (unlikely(!node))
       return NULL;
 
@@ -918,3 +1096,696 @@ linear_strcat(void *parent, char **dest, const char *str)
 {
    return linear_cat(parent, dest, str, strlen(str));
 }
+
+/***************************************************************************
+ * Arena contexts, for allocations that die together.
+ ***************************************************************************
+ *
+ * Everything allocated off of an arena, or off of anything allocated from
+ * it, is suballocated from the arena's linear buffers.  The per-allocation
+ * header only records the parent and a destructor, and ralloc_free() of an
+ * arena child merely runs its destructor: the memory is released all at
+ * once, one buffer at a time, when the arena itself is freed.
+ */
+
+struct arena_destructor {
+   struct arena_destructor *next;
+   arena_header *info;
+   void (*destructor)(void *);
+};
+
+struct ralloc_arena {
+   void *linear;
+   struct arena_destructor *destructors;
+
+   /* The latest allocation, and the linear block that it was carved from.
+    * As long as nothing was carved after it, it can grow in place.
+    */
+   void *last;
+   void *last_block;
+};
+
+/* Called by unsafe_free() before the arena's buffers are released. */
+static void
+destroy_arena(void *ptr)
+{
+   struct ralloc_arena *arena = (struct ralloc_arena *) ptr;
+
+   for (struct arena_destructor *d = arena->destructors; d; d = d->next) {
+      void (*destructor)(void *) = d->destructor;
+
+      d->destructor = NULL;
+      if (destructor != NULL)
+         destructor(&d->info[1]);
+   }
+}
+
+void *
+ralloc_arena_context(const void *ctx)
+{
+   struct ralloc_arena *arena;
+
+   /* Arenas don't nest; the new one would only be freed with the outer. */
+   assert(ctx == NULL || find_arena(ctx) == NULL);
+
+   arena = ralloc_size(ctx, sizeof(*arena));
+   if (unlikely(arena == NULL))
+      return NULL;
+
+   arena->destructors = NULL;
+   arena->last = NULL;
+   arena->last_block = NULL;
+   ralloc_set_destructor(arena, destroy_arena);
+
+   arena->linear = linear_alloc_parent(arena, 0);
+   if (unlikely(arena->linear == NULL)) {
+      ralloc_free(arena);
+      return NULL;
+   }
+
+   return arena;
+}
+
+static struct ralloc_arena *
+find_arena(const void *ctx)
+{
+   if (is_arena_child(ctx))
+      return ARENA_HEADER(ctx)->arena;
+
+   if (get_header(ctx)->destructor == destroy_arena)
+      return (struct ralloc_arena *) ctx;
+
+   return NULL;
+}
+
+/* Arena allocations are aligned like ralloc_header, so that they have the
+ * alignment of a malloc'ed block just like any other ralloc allocation.
+ */
+#if !defined(_MSC_VER) && defined(__LP64__)
+#define ARENA_ALIGNMENT 16
+#else
+#define ARENA_ALIGNMENT 8
+#endif
+
+static void *
+arena_alloc(struct ralloc_arena *arena, const void *parent, size_t size)
+{
+   arena_header *info;
+   char *block;
+
+   if (unlikely(size > ARENA_SIZE_MASK))
+      return NULL;
+
+   /* Linear suballocations are only SUBALLOC_ALIGNMENT aligned, so leave
+    * room to push the allocation up to the next ARENA_ALIGNMENT boundary.
+    */
+   block = linear_alloc_child(arena->linear,
+                              (unsigned) (sizeof(arena_header) + size +
+                                          ARENA_ALIGNMENT -
+                                          SUBALLOC_ALIGNMENT));
+   if (unlikely(block == NULL))
+      return NULL;
+
+   info = ARENA_HEADER(ALIGN_POT((uintptr_t) block + sizeof(arena_header),
+                                 ARENA_ALIGNMENT));
+   info->parent = parent;
+   info->arena = arena;
+   info->size = (uint32_t) size;
+   info->canary = ARENA_CANARY;
+
+   arena->last = &info[1];
+   arena->last_block = block;
+
+   if (stats_enabled)
+      track_arena_alloc(arena);
+
+   return &info[1];
+}
+
+/* Resize the latest allocation of the arena in place, moving the end of
+ * the used part of its linear buffer, if the buffer has room for it.
+ */
+static bool
+arena_resize_last(struct ralloc_arena *arena, size_t size)
+{
+   linear_header *first = LINEAR_PARENT_TO_HEADER(arena->linear);
+   linear_header *latest = first->latest;
+   linear_size_chunk *chunk = ((linear_size_chunk *) arena->last_block) - 1;
+   char *buffer = (char *) &latest[1];
+   size_t block_size;
+
+   assert((char *) arena->last_block + chunk->size == buffer + latest->offset);
+
+   block_size = ALIGN_POT((char *) arena->last + size -
+                          (char *) arena->last_block, SUBALLOC_ALIGNMENT);
+   if ((char *) arena->last_block + block_size > buffer + latest->size)
+      return false;
+
+   latest->offset = (unsigned) ((char *) arena->last_block + block_size -
+                                buffer);
+   chunk->size = (unsigned) block_size;
+   return true;
+}
+
+static void *
+arena_resize(void *ptr, size_t size)
+{
+   arena_header *info = ARENA_HEADER(ptr);
+   struct ralloc_arena *arena = info->arena;
+   uint32_t flags = info->size & ~ARENA_SIZE_MASK;
+   void *new_ptr;
+
+   if (unlikely(size > ARENA_SIZE_MASK))
+      return NULL;
+
+   /* Strings that are appended to over and over, like info logs, are the
+    * latest allocation of their arena most of the time.
+    */
+   if (ptr == arena->last && arena_resize_last(arena, size)) {
+      info->size = (uint32_t) size | flags;
+      return ptr;
+   }
+
+   /* Memory isn't given back before the arena is freed anyway. */
+   if (size <= (info->size & ARENA_SIZE_MASK)) {
+      info->size = (uint32_t) size | flags;
+      return ptr;
+   }
+
+   /* The block moves, and the memory it had stays with the arena.  Leave it
+    * room to double in place, so that growing it in steps costs a linear
+    * amount of memory and copying rather than a quadratic one.
+    */
+   new_ptr = arena_alloc(arena, info->parent, 2 * size);
+   if (unlikely(new_ptr == NULL))
+      return NULL;
+
+   arena_resize_last(arena, size);
+   ARENA_HEADER(new_ptr)->size = (uint32_t) size | flags;
+
+   /* The destructor goes along with the block. */
+   if (flags & ARENA_HAS_DESTRUCTOR)
+      find_destructor(arena, info)->info = ARENA_HEADER(new_ptr);
+
+   memcpy(new_ptr, ptr, info->size & ARENA_SIZE_MASK);
+   return new_ptr;
+}
+
+/* Whether \p ctx is in \p arena, or is one of the arena's parents, and
+ * thus doesn't outlive it.
+ */
+static bool
+outlived_by_arena(const void *ctx, const struct ralloc_arena *arena)
+{
+   const ralloc_header *owner, *node;
+
+   if (ctx == NULL)
+      return false;
+
+   if (find_arena(ctx) == arena)
+      return true;
+
+   if (is_arena_child(ctx))
+      return false;
+
+   owner = get_header(ctx);
+   for (node = get_header(arena); node != NULL; node = node->parent) {
+      if (node == owner)
+         return true;
+   }
+   return false;
+}
+
+static void
+arena_steal(const void *new_ctx, void *ptr)
+{
+   arena_header *info = ARENA_HEADER(ptr);
+
+   /* The memory can't leave the arena, so the new parent mustn't outlive
+    * it: it has to be in the same arena, or be one of the arena's parents.
+    * Anything else would leave the new parent with a dangling child once
+    * the arena is freed, so it is refused in every build.
+    */
+   if (unlikely(!outlived_by_arena(new_ctx, info->arena))) {
+      fprintf(stderr, "ralloc: cannot steal %p out of its arena\n", ptr);
+      abort();
+   }
+
+   info->parent = new_ctx;
+}
+
+static struct arena_destructor *
+find_destructor(struct ralloc_arena *arena, const arena_header *info)
+{
+   struct arena_destructor *d;
+
+   for (d = arena->destructors; d->info != info; d = d->next)
+      ;
+
+   return d;
+}
+
+static void
+arena_set_destructor(void *ptr, void(*destructor)(void *))
+{
+   arena_header *info = ARENA_HEADER(ptr);
+   struct ralloc_arena *arena = info->arena;
+   struct arena_destructor *d;
+
+   if (info->size & ARENA_HAS_DESTRUCTOR) {
+      d = find_destructor(arena, info);
+   } else {
+      if (destructor == NULL)
+         return;
+
+      d = linear_alloc_child(arena->linear, sizeof(*d));
+
+      /* Nothing can grow in place over the list entry. */
+      arena->last = NULL;
+
+      d->info = info;
+      d->next = arena->destructors;
+      arena->destructors = d;
+      info->size |= ARENA_HAS_DESTRUCTOR;
+   }
+
+   d->destructor = destructor;
+}
+
+/* Arena memory goes away with the arena, but the destructor is still due
+ * now.
+ */
+static void
+arena_free(void *ptr)
+{
+   arena_header *info = ARENA_HEADER(ptr);
+   struct arena_destructor *d;
+   void (*destructor)(void *);
+
+   if (!(info->size & ARENA_HAS_DESTRUCTOR))
+      return;
+
+   d = find_destructor(info->arena, info);
+   destructor = d->destructor;
+
+   d->destructor = NULL;
+   if (destructor != NULL)
+      destructor(ptr);
+}
+
+/***************************************************************************
+ * Memory accounting.
+ ***************************************************************************
+ *
+ * Once enabled, every new block records its size and the site it was
+ * allocated at: the phase, or the pass within it that the caller named.
+ * Each root (a block without a parent) gets a ralloc_root
+ * with the live bytes, live blocks and peak bytes of its whole tree, and
+ * the number of allocations made in it, arena suballocations included.
+ * Blocks from before accounting was enabled are ignored.
+ *
+ * Compiles and links may run on several threads at once, so the counters
+ * and the list of roots are only touched with stats_mutex held.  The phase
+ * and the site are those of the calling thread, so that each thread's
+ * allocations are attributed to its own passes; the totals and the phase
+ * peak cover all threads.
+ */
+
+#if defined(_MSC_VER)
+#define STATS_THREAD_LOCAL __declspec(thread)
+#else
+#define STATS_THREAD_LOCAL __thread
+#endif
+
+struct ralloc_root {
+   struct ralloc_root *prev, *next;
+   unsigned serial;
+   const char *site;
+   size_t live, peak;
+   unsigned long blocks, allocs;
+};
+
+static struct {
+   FILE *out;
+   size_t live, peak, phase_peak;
+   unsigned long blocks, allocs;
+   unsigned roots;
+   struct ralloc_root *first;
+} stats;
+
+static simple_mtx_t stats_mutex = _SIMPLE_MTX_INITIALIZER_NP;
+static STATS_THREAD_LOCAL const char *stats_phase;
+static STATS_THREAD_LOCAL const char *stats_site;
+
+static const char *
+site_name(const char *site)
+{
+   return site != NULL ? site : "startup";
+}
+
+static struct ralloc_root *
+root_of(const ralloc_header *info)
+{
+   while (info->parent != NULL)
+      info = info->parent;
+
+   return is_tracked(info) ? TRACKING(info)->root : NULL;
+}
+
+static void
+usage_of(const ralloc_header *info, size_t *bytes, unsigned long *blocks)
+{
+   if (is_tracked(info)) {
+      *bytes += TRACKING(info)->size;
+      (*blocks)++;
+   }
+
+   for (const ralloc_header *child = info->child; child; child = child->next)
+      usage_of(child, bytes, blocks);
+}
+
+static void
+account(struct ralloc_root *root, size_t bytes, unsigned long blocks,
+        bool add)
+{
+   if (add) {
+      stats.live += bytes;
+      stats.blocks += blocks;
+      stats.peak = MAX2(stats.peak, stats.live);
+      stats.phase_peak = MAX2(stats.phase_peak, stats.live);
+   } else {
+      stats.live -= bytes;
+      stats.blocks -= blocks;
+   }
+
+   if (root == NULL)
+      return;
+
+   if (add) {
+      root->live += bytes;
+      root->blocks += blocks;
+      root->peak = MAX2(root->peak, root->live);
+   } else {
+      root->live -= bytes;
+      root->blocks -= blocks;
+   }
+}
+
+static struct ralloc_root *
+create_root(void)
+{
+   struct ralloc_root *root = calloc(1, sizeof(*root));
+   if (unlikely(root == NULL))
+      return NULL;
+
+   root->serial = stats.roots++;
+   root->site = stats_site;
+   root->next = stats.first;
+   if (stats.first != NULL)
+      stats.first->prev = root;
+   stats.first = root;
+
+   return root;
+}
+
+static void
+destroy_root(struct ralloc_root *root)
+{
+   if (root == NULL)
+      return;
+
+   if (root->prev != NULL)
+      root->prev->next = root->next;
+   else
+      stats.first = root->next;
+   if (root->next != NULL)
+      root->next->prev = root->prev;
+
+   free(root);
+}
+
+static void
+track_block(ralloc_header *info, size_t size)
+{
+   ralloc_tracking *tracking = TRACKING(info);
+   struct ralloc_root *root;
+
+   tracking->size = size;
+   tracking->site = stats_site;
+
+   simple_mtx_lock(&stats_mutex);
+   tracking->root = info->parent == NULL ? create_root() : NULL;
+
+   root = root_of(info);
+   account(root, size, 1, true);
+   if (root != NULL)
+      root->allocs++;
+   stats.allocs++;
+   simple_mtx_unlock(&stats_mutex);
+}
+
+static void
+track_resize(ralloc_header *info, size_t old_size)
+{
+   const size_t size = TRACKING(info)->size;
+
+   simple_mtx_lock(&stats_mutex);
+   if (size > old_size)
+      account(root_of(info), size - old_size, 0, true);
+   else
+      account(root_of(info), old_size - size, 0, false);
+   simple_mtx_unlock(&stats_mutex);
+}
+
+/* Moves the usage of \p info's tree to the root of \p new_parent, or to a
+ * root of its own when \p new_parent is NULL.
+ */
+static void
+track_move(ralloc_header *info, const ralloc_header *new_parent)
+{
+   struct ralloc_root *old_root = root_of(info);
+   struct ralloc_root *new_root;
+   size_t bytes = 0;
+   unsigned long blocks = 0;
+
+   simple_mtx_lock(&stats_mutex);
+   if (new_parent != NULL) {
+      new_root = root_of(new_parent);
+   } else if (is_tracked(info)) {
+      new_root = TRACKING(info)->root;
+      if (new_root == NULL)
+         new_root = TRACKING(info)->root = create_root();
+   } else {
+      new_root = NULL;
+   }
+
+   if (new_root != old_root) {
+      usage_of(info, &bytes, &blocks);
+      account(old_root, bytes, blocks, false);
+      account(new_root, bytes, blocks, true);
+
+      /* Stats of a root that gets a parent are folded into the new root. */
+      if (new_parent != NULL && info->parent == NULL && is_tracked(info)) {
+         destroy_root(TRACKING(info)->root);
+         TRACKING(info)->root = NULL;
+      }
+   }
+   simple_mtx_unlock(&stats_mutex);
+}
+
+static void
+track_free(ralloc_header *info)
+{
+   size_t bytes = 0;
+   unsigned long blocks = 0;
+
+   usage_of(info, &bytes, &blocks);
+
+   simple_mtx_lock(&stats_mutex);
+   account(root_of(info), bytes, blocks, false);
+
+   if (info->parent == NULL && is_tracked(info))
+      destroy_root(TRACKING(info)->root);
+   simple_mtx_unlock(&stats_mutex);
+}
+
+static void
+track_arena_alloc(struct ralloc_arena *arena)
+{
+   struct ralloc_root *root = root_of(get_header(arena));
+
+   simple_mtx_lock(&stats_mutex);
+   if (root != NULL)
+      root->allocs++;
+   stats.allocs++;
+   simple_mtx_unlock(&stats_mutex);
+}
+
+void
+ralloc_stats_enable(FILE *out)
+{
+   stats.out = out;
+   stats_enabled = true;
+}
+
+static int
+compare_roots(const void *a, const void *b)
+{
+   const struct ralloc_root *ra = *(const struct ralloc_root *const *) a;
+   const struct ralloc_root *rb = *(const struct ralloc_root *const *) b;
+
+   if (ra->live != rb->live)
+      return ra->live < rb->live ? 1 : -1;
+   return ra->serial < rb->serial ? -1 : ra->serial > rb->serial;
+}
+
+#define STATS_MAX_ROOTS 8
+
+void
+ralloc_stats_phase(const char *phase)
+{
+   struct ralloc_root **roots;
+   unsigned count = 0;
+
+   if (!stats_enabled)
+      return;
+
+   simple_mtx_lock(&stats_mutex);
+   fprintf(stats.out,
+           "ralloc: after %s: %zu bytes live in %lu blocks, peak %zu in "
+           "phase, %zu overall, %lu allocations\n",
+           site_name(stats_phase), stats.live, stats.blocks,
+           stats.phase_peak, stats.peak, stats.allocs);
+
+   for (struct ralloc_root *r = stats.first; r != NULL; r = r->next)
+      count++;
+
+   roots = malloc(count * sizeof(*roots));
+   if (roots != NULL) {
+      unsigned i = 0;
+
+      for (struct ralloc_root *r = stats.first; r != NULL; r = r->next)
+         roots[i++] = r;
+      qsort(roots, count, sizeof(*roots), compare_roots);
+
+      fprintf(stats.out, "  %10s %10s %8s %8s  root\n",
+              "live", "peak", "blocks", "allocs");
+      for (i = 0; i < count && i < STATS_MAX_ROOTS; i++) {
+         fprintf(stats.out, "  %10zu %10zu %8lu %8lu  #%u (%s)\n",
+                 roots[i]->live, roots[i]->peak, roots[i]->blocks,
+                 roots[i]->allocs, roots[i]->serial,
+                 site_name(roots[i]->site));
+      }
+      if (count > STATS_MAX_ROOTS) {
+         size_t rest = 0;
+
+         for (; i < count; i++)
+            rest += roots[i]->live;
+         fprintf(stats.out, "  %10zu %10s %8s %8s  %u more roots\n",
+                 rest, "", "", "", count - STATS_MAX_ROOTS);
+      }
+      free(roots);
+   }
+
+   stats.phase_peak = stats.live;
+   simple_mtx_unlock(&stats_mutex);
+
+   stats_phase = phase;
+   stats_site = phase;
+}
+
+void
+ralloc_stats_site(const char *site)
+{
+   if (stats_enabled)
+      stats_site = site;
+}
+
+/* Sites are compared by name, since the same string literal needn't have
+ * the same address in two translation units.
+ */
+static bool
+same_site(const char *a, const char *b)
+{
+   return a == b || (a != NULL && b != NULL && strcmp(a, b) == 0);
+}
+
+/* Prints the blocks in \p nodes grouped by the site they were allocated
+ * at, then recurses into the children of each group.
+ */
+static void
+print_tree_level(FILE *out, const ralloc_header **nodes, unsigned count,
+                 unsigned depth)
+{
+   bool *done = calloc(count, sizeof(*done));
+   const ralloc_header **group = malloc(count * sizeof(*group));
+
+   if (done == NULL || group == NULL)
+      goto out;
+
+   for (unsigned i = 0; i < count; i++) {
+      const char *site;
+      unsigned group_count = 0, children = 0;
+      size_t own = 0, total = 0;
+      unsigned long blocks = 0;
+
+      if (done[i])
+         continue;
+
+      site = is_tracked(nodes[i]) ? TRACKING(nodes[i])->site : NULL;
+      for (unsigned j = i; j < count; j++) {
+         const char *other =
+            is_tracked(nodes[j]) ? TRACKING(nodes[j])->site : NULL;
+
+         if (done[j] || !same_site(other, site))
+            continue;
+
+         done[j] = true;
+         group[group_count++] = nodes[j];
+         if (is_tracked(nodes[j]))
+            own += TRACKING(nodes[j])->size;
+         usage_of(nodes[j], &total, &blocks);
+         for (const ralloc_header *c = nodes[j]->child; c; c = c->next)
+            children++;
+      }
+
+      fprintf(out, "%*s%s: %u blocks, %zu bytes (%zu in %lu blocks with "
+              "children)\n", depth * 2 + 2, "",
+              is_tracked(group[0]) ? site_name(site) : "untracked",
+              group_count, own, total, blocks);
+
+      if (children > 0 && depth < 8) {
+         const ralloc_header **next = malloc(children * sizeof(*next));
+         unsigned n = 0;
+
+         if (next == NULL)
+            continue;
+
+         for (unsigned j = 0; j < group_count; j++) {
+            for (const ralloc_header *c = group[j]->child; c; c = c->next)
+               next[n++] = c;
+         }
+         print_tree_level(out, next, n, depth + 1);
+         free(next);
+      }
+   }
+
+out:
+   free(group);
+   free(done);
+}
+
+void
+ralloc_stats_print_tree(FILE *out, const void *ctx)
+{
+   const ralloc_header *info;
+
+   if (ctx == NULL)
+      return;
+
+   if (is_arena_child(ctx))
+      ctx = ARENA_HEADER(ctx)->arena;
+
+   info = get_header(ctx);
+   print_tree_level(out, &info, 1, 0);
+}
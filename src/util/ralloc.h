@@ -49,6 +49,7 @@
 #include <stddef.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdio.h>
 
 #include "macros.h"
 
@@ -91,6 +92,26 @@ extern "C" {
  */
 void *ralloc_context(const void *ctx);
 
+/**
+ * Allocate a new arena context.
+ *
+ * Anything allocated off of an arena, or off of one of its allocations, is
+ * suballocated from the arena's linear buffers instead of getting its own
+ * malloc block and ralloc header.  ralloc_parent(), ralloc_steal() and
+ * destructors keep working, but the memory itself is only released when
+ * the arena is freed, so this suits objects that mostly die together, such
+ * as the IR of a compile.
+ *
+ * reralloc() grows the latest allocation of an arena in place.  Any other
+ * block that grows is copied, and the memory it had stays in use until the
+ * arena is freed.
+ *
+ * An arena child can only be stolen by a context in the same arena or by
+ * one of the arena's parents, and stealing it anywhere else aborts; use
+ * ralloc_steal() on the arena to move all of it.
+ */
+void *ralloc_arena_context(const void *ctx);
+
 /**
  * Allocate memory chained off of the given context.
  *
@@ -478,6 +499,46 @@ bool ralloc_asprintf_append (char **str, const char *fmt, ...)
 bool ralloc_vasprintf_append(char **str, const char *fmt, va_list args);
 /// @}
 
+/**
+ * \name Memory accounting
+ *
+ * Once enabled, every block allocated from then on records its size and the
+ * site it was allocated at, and each root context (one without a parent)
+ * keeps its live bytes, peak bytes and allocation count.  Accounting can't
+ * be turned off again, and has to be enabled before any other thread
+ * allocates.  Threads may then allocate concurrently, as long as they don't
+ * share a context, the same as without accounting.
+ * @{
+ */
+
+/**
+ * Enable accounting.  Snapshots from ralloc_stats_phase() go to \p out.
+ */
+void ralloc_stats_enable(FILE *out);
+
+/**
+ * Print a snapshot of the phase that just ended, and attribute the blocks
+ * that the calling thread allocates from now on to \p phase.  The totals
+ * in the snapshot cover all threads.  Does nothing unless accounting is
+ * enabled.
+ */
+void ralloc_stats_phase(const char *phase);
+
+/**
+ * Attribute the blocks that the calling thread allocates from now on to
+ * \p site, such as the name of a pass, until the next site or phase.  Unlike ralloc_stats_phase(), no
+ * snapshot is printed.  \p site must outlive the accounting.
+ */
+void ralloc_stats_site(const char *site);
+
+/**
+ * Print the tree of blocks under \p ctx, with siblings allocated at the
+ * same site grouped together.
+ */
+void ralloc_stats_print_tree(FILE *out, const void *ctx);
+
+/** @} */
+
 /**
  * Declare C++ new and delete operators which use ralloc.
  *
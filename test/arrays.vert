@@ -0,0 +1,47 @@
+#version 450
+
+struct Bone
+{
+    mat4 transform;
+    float weights[4];
+};
+
+layout(location = 0) uniform Bone bones[16];
+layout(location = 100) uniform vec4 offsets[8][2];
+
+layout(location = 0) in vec4 inPosition;
+layout(location = 1) in ivec4 inBones;
+layout(location = 2) in vec4 inWeights;
+
+layout(location = 0) out vec4 outColor[2];
+
+float sum(float values[4])
+{
+    float total = 0.0;
+    for (int i = 0; i < values.length(); i++)
+        total += values[i];
+    return total;
+}
+
+void main()
+{
+    vec4 position = vec4(0.0);
+    float weights[4];
+
+    for (int i = 0; i < 4; i++)
+        weights[i] = inWeights[i];
+
+    for (int i = 0; i < 4; i++) {
+        Bone bone = bones[inBones[i]];
+        position += weights[i] * (bone.transform * inPosition);
+        position.w += sum(bone.weights);
+    }
+
+    vec4 corners[2][2];
+    corners[0] = offsets[inBones.x];
+    corners[1] = offsets[inBones.y];
+
+    outColor[0] = corners[0][0] + corners[1][1];
+    outColor[1] = corners[0][1] + corners[1][0];
+    gl_Position = position;
+}
@@ -0,0 +1,53 @@
+#version 450
+
+struct Light
+{
+    vec3 position;
+    vec3 direction;
+    vec3 color;
+    float intensity;
+    float range;
+};
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec2 inTexCoord;
+
+layout(location = 0) out vec3 outColor;
+layout(location = 1) out vec2 outTexCoord;
+
+uniform mat4 modelMatrix;
+uniform mat4 viewMatrix;
+uniform mat4 projectionMatrix;
+uniform Light lights[4];
+uniform vec3 ambientColor;
+
+float attenuation(Light light, vec3 worldPosition)
+{
+    float distanceToLight = length(light.position - worldPosition);
+    float rangeFactor = clamp(1.0 - distanceToLight / light.range, 0.0, 1.0);
+    return light.intensity * rangeFactor * rangeFactor;
+}
+
+vec3 shade(Light light, vec3 worldPosition, vec3 worldNormal)
+{
+    vec3 lightDirection = normalize(light.position - worldPosition);
+    float diffuseFactor = max(dot(worldNormal, lightDirection), 0.0);
+    float spotFactor = max(dot(-lightDirection, light.direction), 0.0);
+    return light.color * diffuseFactor * spotFactor *
+           attenuation(light, worldPosition);
+}
+
+void main()
+{
+    vec4 worldPosition = modelMatrix * vec4(inPosition, 1.0);
+    vec3 worldNormal = normalize(mat3(modelMatrix) * inNormal);
+    vec3 litColor = ambientColor;
+    litColor += shade(lights[0], worldPosition.xyz, worldNormal);
+    litColor += shade(lights[1], worldPosition.xyz, worldNormal);
+    litColor += shade(lights[2], worldPosition.xyz, worldNormal);
+    litColor += shade(lights[3], worldPosition.xyz, worldNormal);
+    outColor = litColor;
+    outTexCoord = inTexCoord;
+    gl_Position = projectionMatrix * viewMatrix * worldPosition;
+}
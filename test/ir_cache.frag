@@ -0,0 +1,16 @@
+#version 150
+
+uniform sampler2D diffuse;
+uniform vec4 fogColor;
+
+in Iface {
+    vec2 texcoord;
+    float fog;
+} i;
+
+out vec4 color;
+
+void main()
+{
+    color = mix(texture(diffuse, i.texcoord), fogColor, i.fog);
+}
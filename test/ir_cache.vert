@@ -0,0 +1,18 @@
+#version 150
+
+uniform mat4 mvp;
+
+in vec4 position;
+in vec2 uv;
+
+out Iface {
+    vec2 texcoord;
+    float fog;
+} o;
+
+void main()
+{
+    gl_Position = mvp * position;
+    o.texcoord = uv;
+    o.fog = clamp(length(gl_Position.xyz) / 100.0, 0.0, 1.0);
+}
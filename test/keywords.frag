@@ -0,0 +1,45 @@
+#version 450
+
+layout(location = 0) flat in ivec2 inIndex;
+layout(location = 1) noperspective in vec2 inTexCoord;
+layout(location = 2) centroid in vec3 inNormal;
+
+layout(location = 0) out vec4 outColor;
+
+layout(binding = 0) uniform sampler2DArrayShadow shadowMap;
+layout(binding = 1) uniform isamplerBuffer indices;
+layout(binding = 2) uniform usampler2DMS samples;
+
+uniform mat2 transform;
+uniform uvec4 flags;
+uniform bool lit;
+
+/* Words that only start like keywords are plain identifiers. */
+float input_;
+int layouts;
+bool trueish;
+bool falsey;
+
+void main()
+{
+    precise float depth = texture(shadowMap, vec4(inTexCoord, 0.0, 0.5));
+    int index = texelFetch(indices, inIndex.x).x;
+    uint sampleValue = texelFetch(samples, inIndex, 0).x;
+    vec2 position = transform * inTexCoord;
+
+    for (int i = 0; i < index; i++) {
+        if (i == 2)
+            continue;
+        if (i == 4)
+            break;
+        depth *= float(sampleValue);
+    }
+    depth += position.x;
+
+    if (lit || false) {
+        if (flags.x != 0u && true)
+            outColor = vec4(inNormal * depth, 1.0);
+    } else {
+        discard;
+    }
+}
@@ -0,0 +1,17 @@
+#version 450
+
+#define SHADE(n, l) \
+    max(dot(normalize(n), \
+            normalize(l)), 0.0)
+
+layout(location = 0) in vec3 inNormal;
+layout(location = 1) in vec3 inLight;
+
+layout(location = 0) out vec4 outColor;
+
+void main()
+{
+    float d = SHADE(inNormal, \
+                    inLight);
+    outColor = vec4(vec3(d), 1.0);
+}
@@ -0,0 +1,12 @@
+#version 140
+#extension GL_ARB_shading_language_420pack : require
+
+layout(binding = 0) uniform sampler2D diffuse;
+
+in vec2 texcoord;
+in vec4 vertexColor;
+
+void main()
+{
+    gl_FragColor = texture(diffuse, texcoord) * vertexColor;
+}
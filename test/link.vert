@@ -0,0 +1,21 @@
+#version 140
+
+uniform mat4 mvp;
+uniform mat3 normalMatrix;
+
+in vec4 position;
+in vec3 normal;
+in vec2 uv;
+in vec4 color;
+
+out vec2 texcoord;
+out vec3 viewNormal;
+out vec4 vertexColor;
+
+void main()
+{
+    gl_Position = mvp * position;
+    texcoord = uv;
+    viewNormal = normalize(normalMatrix * normal);
+    vertexColor = color;
+}
@@ -0,0 +1,33 @@
+#version 450
+
+#define LIGHT_COUNT 4
+#define LIGHT_INTENSITY_SCALE 0.25
+#define LIGHT_INTENSITY(i) (float(i) * LIGHT_INTENSITY_SCALE)
+#define SHADE(color, i) ((color) * LIGHT_INTENSITY(i))
+
+#ifdef LIGHT_COUNT
+#define HAS_LIGHTS
+#endif
+
+#undef LIGHT_INTENSITY_SCALE
+#define LIGHT_INTENSITY_SCALE 0.5
+
+#undef HAS_LIGHTS
+#ifndef HAS_LIGHTS
+#define HAS_NO_LIGHTS
+#endif
+
+layout(location = 0) in vec3 inColor;
+layout(location = 0) out vec4 outColor;
+
+void main()
+{
+    vec3 color = vec3(0.0);
+    for (int i = 0; i < LIGHT_COUNT; i++)
+        color += SHADE(inColor, i);
+#if defined(HAS_NO_LIGHTS) && !defined(HAS_LIGHTS)
+    outColor = vec4(color, 1.0);
+#else
+    outColor = vec4(0.0);
+#endif
+}
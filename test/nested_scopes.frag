@@ -0,0 +1,75 @@
+#version 450
+
+layout(location = 0) in vec4 inColor;
+layout(location = 1) in vec2 inTexCoord;
+
+layout(location = 0) out vec4 outColor;
+
+uniform vec4 tint;
+uniform float threshold;
+
+vec4 blend(vec4 color, float weight)
+{
+    vec4 result = color;
+    {
+        float weight = clamp(weight, 0.0, 1.0);
+        {
+            vec4 color = result * weight;
+            {
+                float weight = weight * 0.5;
+                {
+                    vec4 color = color + vec4(weight);
+                    {
+                        vec4 result = color * tint;
+                        {
+                            float weight = dot(result, vec4(0.25));
+                            if (weight > threshold) {
+                                vec4 color = result - vec4(weight);
+                                result = color;
+                            }
+                            color = result;
+                        }
+                    }
+                    result = color;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+vec4 shade(vec4 color)
+{
+    vec4 result = vec4(0.0);
+    for (int i = 0; i < 4; i++) {
+        vec4 color = blend(color, float(i) * 0.25);
+        for (int j = 0; j < 2; j++) {
+            float i = float(j) + 1.0;
+            {
+                vec4 result = color / i;
+                color = result;
+            }
+        }
+        result += color;
+    }
+    return result;
+}
+
+void main()
+{
+    vec4 color = inColor;
+    {
+        vec2 inTexCoord = fract(inTexCoord * 2.0);
+        {
+            vec4 color = color * vec4(inTexCoord, 1.0, 1.0);
+            {
+                vec4 shaded = shade(color);
+                {
+                    vec4 color = shaded * 0.5;
+                    outColor = color;
+                }
+            }
+        }
+    }
+    outColor += color * 0.25;
+}
@@ -0,0 +1,23 @@
+#version 140
+
+uniform mat4 model;
+uniform vec3 light[4];
+uniform sampler2D tex;
+
+in vec3 normal;
+in vec3 position;
+in vec2 uv;
+
+void main()
+{
+    vec3 n = normalize(normal);
+    float diffuse = 0.0;
+    for (int i = 0; i < 4; i++) {
+        diffuse += max(dot(normalize(normal), normalize(light[i] - (model * vec4(position, 1.0)).xyz)), 0.0);
+    }
+    vec4 albedo = texture(tex, uv);
+    if (diffuse > 0.5) {
+        albedo += texture(tex, uv) * dot(n, normalize(normal));
+    }
+    gl_FragColor = albedo * diffuse + vec4((model * vec4(position, 1.0)).xyz, 0.0);
+}
@@ -0,0 +1,23 @@
+#version 140
+
+uniform int count;
+uniform mat4 model;
+uniform vec3 light[8];
+uniform vec3 eye;
+
+in vec3 normal;
+in vec3 position;
+
+void main()
+{
+    vec3 color = vec3(0.0);
+    for (int i = 0; i < count; i++) {
+        vec3 world = (model * vec4(position, 1.0)).xyz;
+        vec3 l = normalize(light[i] - world);
+        vec3 h = normalize(l + normalize(eye - world));
+        color += vec3(max(dot(normalize(normal), l), 0.0) + pow(max(dot(normalize(normal), h), 0.0), 16.0));
+        float t;
+        color += vec3(t * 2.0 + float(count));
+    }
+    gl_FragColor = vec4(color, 1.0);
+}
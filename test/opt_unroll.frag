@@ -0,0 +1,27 @@
+#version 140
+
+uniform sampler2D image;
+uniform vec2 texel;
+uniform mat4 bones[16];
+uniform vec4 weights;
+uniform float kernel[5];
+
+in vec2 uv;
+in vec4 position;
+
+void main()
+{
+    vec4 color = texture(image, uv) * kernel[0];
+    for (int i = 1; i < 5; i++) {
+        color += texture(image, uv + vec2(texel.x * float(i), 0.0)) * kernel[i];
+        color += texture(image, uv - vec2(texel.x * float(i), 0.0)) * kernel[i];
+    }
+
+    vec4 skinned = vec4(0.0);
+    for (int i = 0; i < 16; i++) {
+        vec4 p = bones[i] * position;
+        skinned += normalize(p) * dot(p, weights) + inverse(bones[i])[3] * weights.x;
+    }
+
+    gl_FragColor = color + skinned;
+}
@@ -0,0 +1,11 @@
+#version 450
+in float a;
+in vec2 b;
+in float c;
+in vec3 d;
+in float e;
+out vec4 color;
+void main()
+{
+    color = vec4(a + b.x, b.y * c, d.x + e, d.y + d.z);
+}
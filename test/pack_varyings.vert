@@ -0,0 +1,12 @@
+#version 450
+in vec4 position;
+out float a;
+out vec2 b;
+out float c;
+out vec3 d;
+out float e;
+void main()
+{
+    a = position.x; b = position.yz; c = position.w; d = position.xyz * 2.0; e = a + c;
+    gl_Position = position;
+}
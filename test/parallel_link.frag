@@ -0,0 +1,19 @@
+#version 450
+
+uniform sampler2D diffuse;
+uniform vec3 lightDirections[4];
+uniform vec3 lightColors[4];
+
+in vec3 geomNormal;
+in vec4 geomColor;
+
+out vec4 fragColor;
+
+void main()
+{
+    vec3 normal = normalize(geomNormal);
+    vec3 light = vec3(0.0);
+    for (int i = 0; i < 4; i++)
+        light += lightColors[i] * max(dot(normal, lightDirections[i]), 0.0);
+    fragColor = texture(diffuse, normal.xy * 0.5 + 0.5) * geomColor * vec4(light, 1.0);
+}
@@ -0,0 +1,27 @@
+#version 450
+
+uniform mat4 world;
+uniform mat4 bones[32];
+
+in vec4 position;
+in vec3 normal;
+in vec4 weights;
+in ivec4 indices;
+
+out vec3 vertexNormal;
+out vec4 vertexColor;
+
+vec4 skin(vec4 v)
+{
+    vec4 result = vec4(0.0);
+    for (int i = 0; i < 4; i++)
+        result += bones[indices[i]] * v * weights[i];
+    return result;
+}
+
+void main()
+{
+    gl_Position = world * skin(position);
+    vertexNormal = normalize(mat3(world) * skin(vec4(normal, 0.0)).xyz);
+    vertexColor = vec4(vertexNormal * 0.5 + 0.5, 1.0);
+}
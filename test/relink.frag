@@ -0,0 +1,13 @@
+#version 140
+#extension GL_ARB_shading_language_420pack : require
+
+layout(binding = 1) uniform sampler2D diffuse;
+
+in vec2 texcoord;
+in vec4 vertexColor;
+
+void main()
+{
+    vec4 color = texture(diffuse, texcoord);
+    gl_FragColor = vec4(color.rgb * vertexColor.rgb, color.a);
+}
@@ -0,0 +1,18 @@
+#version 140
+
+uniform mat4 mvp;
+uniform sampler2D diffuse;
+
+in vec4 position;
+in vec2 uv;
+in vec4 color;
+
+out vec2 texcoord;
+out vec4 vertexColor;
+
+void main()
+{
+    gl_Position = mvp * position;
+    texcoord = uv;
+    vertexColor = color * textureLod(diffuse, uv, 0.0).a;
+}
@@ -0,0 +1,45 @@
+#version 450
+
+layout(std140) uniform;
+
+uniform Material
+{
+    vec4 albedo;
+    float roughness;
+};
+
+layout(location = 0) in vec3 inNormal;
+layout(location = 1) in vec2 inTexCoord;
+
+layout(location = 0) out vec4 outColor;
+
+float lambert(vec3 n, vec3 l);
+
+vec3 lightDirection()
+{
+    return normalize(vec3(0.5, 1.0, 0.25));
+}
+
+uniform Lighting
+{
+    vec4 lightColor;
+    vec4 ambient;
+};
+
+float shade(vec3 n)
+{
+    float diffuse = lambert(n, lightDirection());
+    return mix(diffuse, diffuse * diffuse, roughness);
+}
+
+float lambert(vec3 n, vec3 l)
+{
+    return max(dot(n, l), 0.0);
+}
+
+void main()
+{
+    vec3 n = normalize(inNormal);
+    vec4 base = albedo * vec4(inTexCoord, 1.0, 1.0);
+    outColor = base * (ambient + lightColor * shade(n));
+}
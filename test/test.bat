@@ -1,3 +1,27 @@
 @for %%s in (*.vert) do ..\bin\xxGLSLCompiler.Release.x64.exe --dump-spirv-validation --version 450 %%s
 @for %%s in (*.frag) do ..\bin\xxGLSLCompiler.Release.x64.exe --dump-spirv-validation --version 450 %%s
+@..\bin\xxGLSLCompiler.Release.x64.exe --dump-spirv-validation --unroll-budget=0 --version 450 opt_unroll.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --dump-spirv-validation --stream-hir --version 450 stream_hir.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --dump-spirv-validation --link --version 450 link.vert link.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --reflect=link.json --reflect-binary=link.reflect --link --version 450 link.vert link.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --dump-uniform-layout --version 450 uniform_layout.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --dump-spirv-validation --push-constants=32 --version 450 uniform_layout.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --dump-spirv-validation --pack-varyings --link --version 450 pack_varyings.vert pack_varyings.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --dump-spirv-validation --link --version 450 parallel_link.vert parallel_link.tesc parallel_link.tese parallel_link.geom parallel_link.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --bench 50 --threads 8 --version 450 arrays.vert
+@..\bin\xxGLSLCompiler.Release.x64.exe --bench 50 --link --version 450 uniforms.vert
+@..\bin\xxGLSLCompiler.Release.x64.exe --bench 50 --link --version 450 varyings.vert varyings.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --bench 50 --parallel-link --link --version 450 parallel_link.vert parallel_link.tesc parallel_link.tese parallel_link.geom parallel_link.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --bench 50 --mem-stats --link --version 450 uniform_storage.vert
+@..\bin\xxGLSLCompiler.Release.x64.exe --bench 10 --threads 4 --mem-stats --parallel-link --link --version 450 parallel_link.vert parallel_link.tesc parallel_link.tese parallel_link.geom parallel_link.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --dump-spirv-validation --relink=relink.frag --link --version 450 link.vert link.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --dump-spirv-validation --relink=relink.frag --link --version 450 relink.vert link.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --ir-cache . --link --version 450 ir_cache.vert ir_cache.frag
+@..\bin\xxGLSLCompiler.Release.x64.exe --ir-cache . --link --version 450 ir_cache.vert ir_cache.frag
+@if exist ir_cache_cold rmdir /s /q ir_cache_cold
+@mkdir ir_cache_cold
+@..\bin\xxGLSLCompiler.Release.x64.exe --ir-cache ir_cache_cold --dump-spirv --link --version 450 pack_varyings.vert pack_varyings.frag
+@copy /y output.frag.spv output.frag.cold.spv > nul
+@..\bin\xxGLSLCompiler.Release.x64.exe --ir-cache ir_cache_cold --dump-spirv --link --version 450 pack_varyings.vert pack_varyings.frag
+@fc /b output.frag.cold.spv output.frag.spv > nul || echo IR cache: a cache hit links differently from a compile
 @pause
\ No newline at end of file
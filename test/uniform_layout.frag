@@ -0,0 +1,23 @@
+#version 450
+
+uniform float exposure;
+uniform vec3 lightColor;
+uniform float gamma;
+uniform vec4 tint;
+uniform mat4 unused;
+uniform vec3 lightDir;
+uniform vec2 scale;
+uniform float ambient;
+
+in vec3 normal;
+in vec2 uv;
+
+out vec4 color;
+
+void main()
+{
+    float diffuse = max(dot(normalize(normal), -lightDir), 0.0) + ambient;
+    vec3 c = lightColor * diffuse * exposure * tint.rgb;
+    c += vec3(uv * scale, 0.0);
+    color = vec4(pow(c, vec3(1.0 / gamma)), tint.a);
+}
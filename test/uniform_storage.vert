@@ -0,0 +1,27 @@
+#version 450
+
+struct Item {
+    float a;
+    float b;
+    float c;
+    float d;
+};
+
+layout(std140) uniform Items {
+    Item items[2500];
+};
+
+uniform int count;
+
+in vec4 position;
+
+out float sum;
+
+void main()
+{
+    float s = 0.0;
+    for (int i = 0; i < count; i++)
+        s += items[i].a * items[i].b + items[i].c * items[i].d;
+    sum = s;
+    gl_Position = position;
+}
@@ -0,0 +1,24 @@
+#version 450
+
+struct Light {
+    vec3 position;
+    float range;
+};
+
+uniform Light lights[128];
+uniform mat4 mvp;
+uniform int count;
+
+in vec4 position;
+
+out float intensity;
+
+void main()
+{
+    float sum = 0.0;
+    for (int i = 0; i < count; i++)
+        sum += max(lights[i].range - distance(lights[i].position, position.xyz), 0.0);
+
+    intensity = sum;
+    gl_Position = mvp * position;
+}
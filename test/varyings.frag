@@ -0,0 +1,114 @@
+#version 450
+
+in float v0;
+in float v3;
+in float v6;
+in float v9;
+in float v12;
+in float v15;
+in float v18;
+in float v21;
+in float v24;
+in float v27;
+in float v30;
+in float v33;
+in float v36;
+in float v39;
+in float v42;
+in float v45;
+in float v48;
+in float v51;
+in float v54;
+in float v57;
+in float v60;
+in float v63;
+in float v66;
+in float v69;
+in float v72;
+in float v75;
+in float v78;
+in float v81;
+in float v84;
+in float v87;
+in float v90;
+in float v93;
+
+in Block0
+{
+    float m0;
+    float m1;
+    float m2;
+    float m3;
+    float m4;
+    float m5;
+    float m6;
+    float m7;
+} block0;
+
+in Block2
+{
+    float m0;
+    float m1;
+    float m2;
+    float m3;
+    float m4;
+    float m5;
+    float m6;
+    float m7;
+} block2;
+
+out vec4 color;
+
+void main()
+{
+    float sum = 0.0;
+    sum += v0;
+    sum += v3;
+    sum += v6;
+    sum += v9;
+    sum += v12;
+    sum += v15;
+    sum += v18;
+    sum += v21;
+    sum += v24;
+    sum += v27;
+    sum += v30;
+    sum += v33;
+    sum += v36;
+    sum += v39;
+    sum += v42;
+    sum += v45;
+    sum += v48;
+    sum += v51;
+    sum += v54;
+    sum += v57;
+    sum += v60;
+    sum += v63;
+    sum += v66;
+    sum += v69;
+    sum += v72;
+    sum += v75;
+    sum += v78;
+    sum += v81;
+    sum += v84;
+    sum += v87;
+    sum += v90;
+    sum += v93;
+    sum += block0.m0;
+    sum += block0.m1;
+    sum += block0.m2;
+    sum += block0.m3;
+    sum += block0.m4;
+    sum += block0.m5;
+    sum += block0.m6;
+    sum += block0.m7;
+    sum += block2.m0;
+    sum += block2.m1;
+    sum += block2.m2;
+    sum += block2.m3;
+    sum += block2.m4;
+    sum += block2.m5;
+    sum += block2.m6;
+    sum += block2.m7;
+    color = vec4(sum);
+}
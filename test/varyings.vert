@@ -0,0 +1,279 @@
+#version 450
+in vec4 position;
+out float v0;
+out float v1;
+out float v2;
+out float v3;
+out float v4;
+out float v5;
+out float v6;
+out float v7;
+out float v8;
+out float v9;
+out float v10;
+out float v11;
+out float v12;
+out float v13;
+out float v14;
+out float v15;
+out float v16;
+out float v17;
+out float v18;
+out float v19;
+out float v20;
+out float v21;
+out float v22;
+out float v23;
+out float v24;
+out float v25;
+out float v26;
+out float v27;
+out float v28;
+out float v29;
+out float v30;
+out float v31;
+out float v32;
+out float v33;
+out float v34;
+out float v35;
+out float v36;
+out float v37;
+out float v38;
+out float v39;
+out float v40;
+out float v41;
+out float v42;
+out float v43;
+out float v44;
+out float v45;
+out float v46;
+out float v47;
+out float v48;
+out float v49;
+out float v50;
+out float v51;
+out float v52;
+out float v53;
+out float v54;
+out float v55;
+out float v56;
+out float v57;
+out float v58;
+out float v59;
+out float v60;
+out float v61;
+out float v62;
+out float v63;
+out float v64;
+out float v65;
+out float v66;
+out float v67;
+out float v68;
+out float v69;
+out float v70;
+out float v71;
+out float v72;
+out float v73;
+out float v74;
+out float v75;
+out float v76;
+out float v77;
+out float v78;
+out float v79;
+out float v80;
+out float v81;
+out float v82;
+out float v83;
+out float v84;
+out float v85;
+out float v86;
+out float v87;
+out float v88;
+out float v89;
+out float v90;
+out float v91;
+out float v92;
+out float v93;
+out float v94;
+out float v95;
+
+out Block0
+{
+    float m0;
+    float m1;
+    float m2;
+    float m3;
+    float m4;
+    float m5;
+    float m6;
+    float m7;
+} block0;
+
+out Block1
+{
+    float m0;
+    float m1;
+    float m2;
+    float m3;
+    float m4;
+    float m5;
+    float m6;
+    float m7;
+} block1;
+
+out Block2
+{
+    float m0;
+    float m1;
+    float m2;
+    float m3;
+    float m4;
+    float m5;
+    float m6;
+    float m7;
+} block2;
+
+out Block3
+{
+    float m0;
+    float m1;
+    float m2;
+    float m3;
+    float m4;
+    float m5;
+    float m6;
+    float m7;
+} block3;
+
+void main()
+{
+    gl_Position = position;
+    v0 = position.x * 1.0;
+    v1 = position.y * 2.0;
+    v2 = position.z * 3.0;
+    v3 = position.w * 4.0;
+    v4 = position.x * 5.0;
+    v5 = position.y * 6.0;
+    v6 = position.z * 7.0;
+    v7 = position.w * 8.0;
+    v8 = position.x * 9.0;
+    v9 = position.y * 10.0;
+    v10 = position.z * 11.0;
+    v11 = position.w * 12.0;
+    v12 = position.x * 13.0;
+    v13 = position.y * 14.0;
+    v14 = position.z * 15.0;
+    v15 = position.w * 16.0;
+    v16 = position.x * 17.0;
+    v17 = position.y * 18.0;
+    v18 = position.z * 19.0;
+    v19 = position.w * 20.0;
+    v20 = position.x * 21.0;
+    v21 = position.y * 22.0;
+    v22 = position.z * 23.0;
+    v23 = position.w * 24.0;
+    v24 = position.x * 25.0;
+    v25 = position.y * 26.0;
+    v26 = position.z * 27.0;
+    v27 = position.w * 28.0;
+    v28 = position.x * 29.0;
+    v29 = position.y * 30.0;
+    v30 = position.z * 31.0;
+    v31 = position.w * 32.0;
+    v32 = position.x * 33.0;
+    v33 = position.y * 34.0;
+    v34 = position.z * 35.0;
+    v35 = position.w * 36.0;
+    v36 = position.x * 37.0;
+    v37 = position.y * 38.0;
+    v38 = position.z * 39.0;
+    v39 = position.w * 40.0;
+    v40 = position.x * 41.0;
+    v41 = position.y * 42.0;
+    v42 = position.z * 43.0;
+    v43 = position.w * 44.0;
+    v44 = position.x * 45.0;
+    v45 = position.y * 46.0;
+    v46 = position.z * 47.0;
+    v47 = position.w * 48.0;
+    v48 = position.x * 49.0;
+    v49 = position.y * 50.0;
+    v50 = position.z * 51.0;
+    v51 = position.w * 52.0;
+    v52 = position.x * 53.0;
+    v53 = position.y * 54.0;
+    v54 = position.z * 55.0;
+    v55 = position.w * 56.0;
+    v56 = position.x * 57.0;
+    v57 = position.y * 58.0;
+    v58 = position.z * 59.0;
+    v59 = position.w * 60.0;
+    v60 = position.x * 61.0;
+    v61 = position.y * 62.0;
+    v62 = position.z * 63.0;
+    v63 = position.w * 64.0;
+    v64 = position.x * 65.0;
+    v65 = position.y * 66.0;
+    v66 = position.z * 67.0;
+    v67 = position.w * 68.0;
+    v68 = position.x * 69.0;
+    v69 = position.y * 70.0;
+    v70 = position.z * 71.0;
+    v71 = position.w * 72.0;
+    v72 = position.x * 73.0;
+    v73 = position.y * 74.0;
+    v74 = position.z * 75.0;
+    v75 = position.w * 76.0;
+    v76 = position.x * 77.0;
+    v77 = position.y * 78.0;
+    v78 = position.z * 79.0;
+    v79 = position.w * 80.0;
+    v80 = position.x * 81.0;
+    v81 = position.y * 82.0;
+    v82 = position.z * 83.0;
+    v83 = position.w * 84.0;
+    v84 = position.x * 85.0;
+    v85 = position.y * 86.0;
+    v86 = position.z * 87.0;
+    v87 = position.w * 88.0;
+    v88 = position.x * 89.0;
+    v89 = position.y * 90.0;
+    v90 = position.z * 91.0;
+    v91 = position.w * 92.0;
+    v92 = position.x * 93.0;
+    v93 = position.y * 94.0;
+    v94 = position.z * 95.0;
+    v95 = position.w * 96.0;
+    block0.m0 = position.x + 0.0;
+    block0.m1 = position.y + 1.0;
+    block0.m2 = position.z + 2.0;
+    block0.m3 = position.w + 3.0;
+    block0.m4 = position.x + 4.0;
+    block0.m5 = position.y + 5.0;
+    block0.m6 = position.z + 6.0;
+    block0.m7 = position.w + 7.0;
+    block1.m0 = position.x + 8.0;
+    block1.m1 = position.y + 9.0;
+    block1.m2 = position.z + 10.0;
+    block1.m3 = position.w + 11.0;
+    block1.m4 = position.x + 12.0;
+    block1.m5 = position.y + 13.0;
+    block1.m6 = position.z + 14.0;
+    block1.m7 = position.w + 15.0;
+    block2.m0 = position.x + 16.0;
+    block2.m1 = position.y + 17.0;
+    block2.m2 = position.z + 18.0;
+    block2.m3 = position.w + 19.0;
+    block2.m4 = position.x + 20.0;
+    block2.m5 = position.y + 21.0;
+    block2.m6 = position.z + 22.0;
+    block2.m7 = position.w + 23.0;
+    block3.m0 = position.x + 24.0;
+    block3.m1 = position.y + 25.0;
+    block3.m2 = position.z + 26.0;
+    block3.m3 = position.w + 27.0;
+    block3.m4 = position.x + 28.0;
+    block3.m5 = position.y + 29.0;
+    block3.m6 = position.z + 30.0;
+    block3.m7 = position.w + 31.0;
+}